@@ -0,0 +1,225 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Utilities/detail/ContainerIterator.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+template <bool read_only>
+class BoundTrackParametersProxy;
+
+/// Mutable proxy to bound track parameters allowing modification
+using MutableBoundTrackParametersProxy = BoundTrackParametersProxy<false>;
+/// Const proxy to bound track parameters for read-only access
+using ConstBoundTrackParametersProxy = BoundTrackParametersProxy<true>;
+
+/// A container of bound track parameters in structure-of-arrays layout.
+///
+/// Each parameter component is stored in its own contiguous column so that
+/// operations on many parameters can be vectorized. Covariances are stored
+/// as packed upper triangles and reference surfaces are deduplicated into a
+/// surface table which is addressed via index. Individual parameters are
+/// addressed via index. A proxy object simplifies the handling.
+class BoundTrackParametersContainer {
+ public:
+  /// Type alias for the parameters index type
+  using Index = std::uint32_t;
+  /// Type alias for the surface index type
+  using SurfaceIndex = std::uint32_t;
+  /// Type alias for mutable parameters proxy
+  using MutableProxy = MutableBoundTrackParametersProxy;
+  /// Type alias for const parameters proxy
+  using ConstProxy = ConstBoundTrackParametersProxy;
+
+  /// Number of independent entries of a bound covariance matrix
+  static constexpr std::size_t kPackedCovarianceSize =
+      eBoundSize * (eBoundSize + 1) / 2;
+  /// Type alias for a packed covariance, i.e. the row-major upper triangle
+  using PackedCovariance = std::array<double, kPackedCovarianceSize>;
+
+  /// Constructs an empty container.
+  BoundTrackParametersContainer() noexcept;
+
+  /// Constructs a container from a range of bound track parameters.
+  /// @param parameters The bound track parameters to convert.
+  explicit BoundTrackParametersContainer(
+      std::span<const BoundTrackParameters> parameters);
+
+  /// Returns the number of parameters in the container.
+  /// @return The number of parameters in the container.
+  Index size() const noexcept { return m_size; }
+
+  /// Checks if the container is empty.
+  /// @return True if the container is empty, false otherwise.
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  /// Reserves space for the given number of parameters.
+  /// @param size The number of parameters to reserve space for.
+  void reserve(Index size) noexcept;
+
+  /// Clears the container, removing all parameters and surfaces.
+  void clear() noexcept;
+
+  /// Creates new parameters at the end of the container.
+  /// @param surface The reference surface of the parameters.
+  /// @param parameters The bound parameters vector.
+  /// @param covariance The optional bound covariance matrix.
+  /// @param particleHypothesis The particle hypothesis.
+  /// @return A mutable proxy to the newly created parameters.
+  MutableProxy createParameters(std::shared_ptr<const Surface> surface,
+                                const BoundVector &parameters,
+                                const std::optional<BoundMatrix> &covariance,
+                                const ParticleHypothesis &particleHypothesis);
+
+  /// Creates new parameters at the end of the container as a copy of the
+  /// given bound track parameters.
+  /// @param parameters The bound track parameters to copy.
+  /// @return A mutable proxy to the newly created parameters.
+  MutableProxy createParameters(const BoundTrackParameters &parameters);
+
+  /// Converts all parameters in the container to bound track parameters.
+  /// @return The bound track parameters in container order.
+  std::vector<BoundTrackParameters> toBoundTrackParameters() const;
+
+  /// Adds a surface to the surface table if not already present.
+  /// @param surface The surface to add.
+  /// @return The index of the surface in the surface table.
+  SurfaceIndex addSurface(std::shared_ptr<const Surface> surface);
+
+  /// Returns the surface table of the container.
+  /// @return The deduplicated reference surfaces.
+  std::span<const std::shared_ptr<const Surface>> surfaces() const noexcept {
+    return m_surfaces;
+  }
+
+  /// Returns the contiguous column of the given parameter component.
+  /// @param component The bound parameter component.
+  /// @return A mutable span over the component of all parameters.
+  std::span<double> parameterColumn(BoundIndices component) noexcept {
+    return m_parameters[component];
+  }
+  /// Returns the contiguous column of the given parameter component.
+  /// @param component The bound parameter component.
+  /// @return A const span over the component of all parameters.
+  std::span<const double> parameterColumn(
+      BoundIndices component) const noexcept {
+    return m_parameters[component];
+  }
+
+  /// Returns the packed covariances of all parameters. Entries of parameters
+  /// without covariance are unspecified.
+  /// @return A mutable span over the packed covariances.
+  std::span<PackedCovariance> covarianceColumn() noexcept {
+    return m_covariances;
+  }
+  /// Returns the packed covariances of all parameters. Entries of parameters
+  /// without covariance are unspecified.
+  /// @return A const span over the packed covariances.
+  std::span<const PackedCovariance> covarianceColumn() const noexcept {
+    return m_covariances;
+  }
+
+  /// Returns the surface table indices of all parameters.
+  /// @return A const span over the surface indices.
+  std::span<const SurfaceIndex> surfaceIndexColumn() const noexcept {
+    return m_surfaceIndices;
+  }
+
+  /// Packs the upper triangle of a bound covariance matrix.
+  /// @param covariance The covariance matrix to pack.
+  /// @return The packed covariance.
+  static PackedCovariance packCovariance(const BoundMatrix &covariance);
+
+  /// Unpacks a packed covariance into a symmetric bound covariance matrix.
+  /// @param packed The packed covariance.
+  /// @return The symmetric covariance matrix.
+  static BoundMatrix unpackCovariance(const PackedCovariance &packed);
+
+  /// Returns a mutable proxy to the parameters at the given index.
+  /// If the index is out of range, an exception is thrown.
+  /// @param index The index of the parameters to access.
+  /// @return A mutable proxy to the parameters at the given index.
+  /// @throws std::out_of_range if the index is out of range.
+  MutableProxy at(Index index);
+
+  /// Returns a const proxy to the parameters at the given index.
+  /// If the index is out of range, an exception is thrown.
+  /// @param index The index of the parameters to access.
+  /// @return A const proxy to the parameters at the given index.
+  /// @throws std::out_of_range if the index is out of range.
+  ConstProxy at(Index index) const;
+
+  /// Returns a mutable proxy to the parameters at the given index.
+  /// @param index The index of the parameters to access.
+  /// @return A mutable proxy to the parameters at the given index.
+  MutableProxy operator[](Index index) noexcept;
+
+  /// Returns a const proxy to the parameters at the given index.
+  /// @param index The index of the parameters to access.
+  /// @return A const proxy to the parameters at the given index.
+  ConstProxy operator[](Index index) const noexcept;
+
+  /// Type alias for iterator template over the container
+  template <bool read_only>
+  using Iterator = detail::ContainerIterator<
+      BoundTrackParametersContainer,
+      std::conditional_t<read_only, ConstProxy, MutableProxy>, Index,
+      read_only>;
+
+  /// Type alias for mutable iterator over parameters
+  using iterator = Iterator<false>;
+  /// Type alias for const iterator over parameters
+  using const_iterator = Iterator<true>;
+
+  /// Get mutable iterator to the beginning of the parameters
+  /// @return Mutable iterator to the first parameters
+  iterator begin() noexcept { return {*this, 0}; }
+  /// Get mutable iterator to the end of the parameters
+  /// @return Mutable iterator past the last parameters
+  iterator end() noexcept { return {*this, size()}; }
+
+  /// Get const iterator to the beginning of the parameters
+  /// @return Const iterator to the first parameters
+  const_iterator begin() const noexcept { return {*this, 0}; }
+  /// Get const iterator to the end of the parameters
+  /// @return Const iterator past the last parameters
+  const_iterator end() const noexcept { return {*this, size()}; }
+
+ private:
+  template <bool>
+  friend class BoundTrackParametersProxy;
+
+  Index m_size{0};
+  std::array<std::vector<double>, eBoundSize> m_parameters;
+  std::vector<PackedCovariance> m_covariances;
+  std::vector<std::uint8_t> m_hasCovariance;
+  std::vector<SurfaceIndex> m_surfaceIndices;
+  std::vector<ParticleHypothesis> m_particleHypotheses;
+
+  std::vector<std::shared_ptr<const Surface>> m_surfaces;
+  std::unordered_map<const Surface *, SurfaceIndex> m_surfaceLookup;
+};
+
+}  // namespace Acts
+
+#include "Acts/EventData/BoundTrackParametersContainer.ipp"
@@ -0,0 +1,47 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/BoundTrackParametersContainer.hpp"
+
+#include "Acts/EventData/BoundTrackParametersProxy.hpp"
+
+#include <stdexcept>
+
+namespace Acts {
+
+inline MutableBoundTrackParametersProxy BoundTrackParametersContainer::at(
+    Index index) {
+  if (index >= size()) {
+    throw std::out_of_range(
+        "Index out of range in BoundTrackParametersContainer");
+  }
+  return MutableProxy(*this, index);
+}
+
+inline ConstBoundTrackParametersProxy BoundTrackParametersContainer::at(
+    Index index) const {
+  if (index >= size()) {
+    throw std::out_of_range(
+        "Index out of range in BoundTrackParametersContainer");
+  }
+  return ConstProxy(*this, index);
+}
+
+inline MutableBoundTrackParametersProxy
+BoundTrackParametersContainer::operator[](Index index) noexcept {
+  return MutableProxy(*this, index);
+}
+
+inline ConstBoundTrackParametersProxy BoundTrackParametersContainer::operator[](
+    Index index) const noexcept {
+  return ConstProxy(*this, index);
+}
+
+}  // namespace Acts
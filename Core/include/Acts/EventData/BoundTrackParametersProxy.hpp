@@ -0,0 +1,199 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/BoundTrackParametersContainer.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
+
+#include <memory>
+#include <optional>
+
+namespace Acts {
+
+/// A proxy class for accessing individual bound track parameters stored in a
+/// @ref BoundTrackParametersContainer.
+template <bool read_only>
+class BoundTrackParametersProxy {
+ public:
+  /// Indicates whether this proxy is read-only or if it can be modified
+  static constexpr bool ReadOnly = read_only;
+
+  /// Type alias for the parameters index type
+  using IndexType = BoundTrackParametersContainer::Index;
+
+  /// Type alias for container type (const if read-only)
+  using ContainerType = const_if_t<ReadOnly, BoundTrackParametersContainer>;
+
+  /// Constructs a proxy for the given container and index.
+  /// @param container The container holding the parameters.
+  /// @param index The index of the parameters in the container.
+  BoundTrackParametersProxy(ContainerType &container, IndexType index) noexcept
+      : m_container{&container}, m_index{index} {}
+
+  /// Copy construct a proxy.
+  /// @param other The proxy to copy.
+  BoundTrackParametersProxy(const BoundTrackParametersProxy &other) noexcept =
+      default;
+
+  /// Copy construct a const proxy from a mutable proxy.
+  /// @param other The mutable proxy to copy.
+  explicit BoundTrackParametersProxy(
+      const BoundTrackParametersProxy<false> &other) noexcept
+    requires ReadOnly
+      : m_container(&other.container()), m_index(other.index()) {}
+
+  /// Copy assign a proxy.
+  /// @param other The proxy to copy.
+  /// @return Reference to this proxy after assignment.
+  BoundTrackParametersProxy &operator=(
+      const BoundTrackParametersProxy &other) noexcept = default;
+
+  /// Returns a const proxy of the parameters.
+  /// @return A const proxy of the parameters.
+  BoundTrackParametersProxy<true> asConst() const noexcept
+    requires(!ReadOnly)
+  {
+    return {*m_container, m_index};
+  }
+
+  /// Gets the container holding the parameters.
+  /// @return A reference to the container holding the parameters.
+  BoundTrackParametersContainer &container() noexcept
+    requires(!ReadOnly)
+  {
+    return *m_container;
+  }
+
+  /// Gets the container holding the parameters.
+  /// @return A const reference to the container holding the parameters.
+  const BoundTrackParametersContainer &container() const noexcept {
+    return *m_container;
+  }
+
+  /// Gets the index of the parameters in the container.
+  /// @return The index of the parameters in the container.
+  IndexType index() const noexcept { return m_index; }
+
+  /// Mutable access to a single parameter component.
+  /// @param component The bound parameter component.
+  /// @return A mutable reference to the component.
+  double &parameter(BoundIndices component) const noexcept
+    requires(!ReadOnly)
+  {
+    return m_container->m_parameters[component][m_index];
+  }
+
+  /// Const access to a single parameter component.
+  /// @param component The bound parameter component.
+  /// @return The value of the component.
+  double parameter(BoundIndices component) const noexcept {
+    return m_container->m_parameters[component][m_index];
+  }
+
+  /// Gathers the bound parameters vector.
+  /// @return The bound parameters vector.
+  BoundVector parameters() const noexcept {
+    BoundVector result;
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      result[i] = m_container->m_parameters[i][m_index];
+    }
+    return result;
+  }
+
+  /// Scatters the bound parameters vector into the parameter columns.
+  /// @param parameters The bound parameters vector.
+  void setParameters(const BoundVector &parameters) const noexcept
+    requires(!ReadOnly)
+  {
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      m_container->m_parameters[i][m_index] = parameters[i];
+    }
+  }
+
+  /// Checks if the parameters have a covariance.
+  /// @return True if a covariance is stored, false otherwise.
+  bool hasCovariance() const noexcept {
+    return m_container->m_hasCovariance[m_index] != 0;
+  }
+
+  /// Unpacks the covariance of the parameters.
+  /// @return The covariance matrix, or no value if none is stored.
+  std::optional<BoundMatrix> covariance() const {
+    if (!hasCovariance()) {
+      return std::nullopt;
+    }
+    return BoundTrackParametersContainer::unpackCovariance(
+        m_container->m_covariances[m_index]);
+  }
+
+  /// Sets or removes the covariance of the parameters.
+  /// @param covariance The covariance matrix, or no value to remove it.
+  void setCovariance(const std::optional<BoundMatrix> &covariance) const
+    requires(!ReadOnly)
+  {
+    m_container->m_hasCovariance[m_index] = covariance.has_value() ? 1 : 0;
+    if (covariance.has_value()) {
+      m_container->m_covariances[m_index] =
+          BoundTrackParametersContainer::packCovariance(*covariance);
+    }
+  }
+
+  /// Gets the index of the reference surface in the surface table.
+  /// @return The index of the reference surface.
+  BoundTrackParametersContainer::SurfaceIndex surfaceIndex() const noexcept {
+    return m_container->m_surfaceIndices[m_index];
+  }
+
+  /// Gets the reference surface of the parameters.
+  /// @return A const reference to the reference surface.
+  const Surface &referenceSurface() const noexcept {
+    return *m_container->m_surfaces[surfaceIndex()];
+  }
+
+  /// Sets the reference surface of the parameters.
+  /// @param surface The new reference surface.
+  void setReferenceSurface(std::shared_ptr<const Surface> surface) const
+    requires(!ReadOnly)
+  {
+    m_container->m_surfaceIndices[m_index] =
+        m_container->addSurface(std::move(surface));
+  }
+
+  /// Mutable access to the particle hypothesis.
+  /// @return A mutable reference to the particle hypothesis.
+  ParticleHypothesis &particleHypothesis() const noexcept
+    requires(!ReadOnly)
+  {
+    return m_container->m_particleHypotheses[m_index];
+  }
+
+  /// Const access to the particle hypothesis.
+  /// @return A const reference to the particle hypothesis.
+  const ParticleHypothesis &particleHypothesis() const noexcept {
+    return m_container->m_particleHypotheses[m_index];
+  }
+
+  /// Converts the parameters to bound track parameters.
+  /// @return The bound track parameters.
+  BoundTrackParameters toBoundTrackParameters() const {
+    return BoundTrackParameters(m_container->m_surfaces[surfaceIndex()],
+                                parameters(), covariance(),
+                                particleHypothesis());
+  }
+
+ private:
+  ContainerType *m_container{};
+  IndexType m_index{};
+};
+
+}  // namespace Acts
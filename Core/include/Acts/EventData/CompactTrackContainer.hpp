@@ -0,0 +1,595 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/SubspaceHelpers.hpp"
+#include "Acts/EventData/TrackContainerFrontendConcept.hpp"
+#include "Acts/EventData/TrackProxyConcept.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/TrackStateType.hpp"
+#include "Acts/EventData/Types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+namespace detail {
+
+/// Number of independent elements of a symmetric matrix
+/// @param size The number of rows of the matrix
+/// @return The number of elements in the upper triangle including the diagonal
+constexpr std::size_t packedSymmetricSize(std::size_t size) {
+  return size * (size + 1) / 2;
+}
+
+/// Pack the upper triangle of a symmetric matrix row by row into single
+/// precision
+/// @param matrix The symmetric matrix to pack
+/// @param packed The output buffer of size @c packedSymmetricSize
+template <typename matrix_t>
+void packSymmetric(const Eigen::MatrixBase<matrix_t>& matrix, float* packed) {
+  assert(matrix.rows() == matrix.cols() && "Matrix is not square");
+  for (Eigen::Index i = 0; i < matrix.rows(); ++i) {
+    for (Eigen::Index j = i; j < matrix.cols(); ++j) {
+      *packed++ = static_cast<float>(matrix(i, j));
+    }
+  }
+}
+
+/// Unpack a symmetric matrix stored by @c packSymmetric
+/// @tparam size The number of rows of the matrix
+/// @param packed The packed upper triangle
+/// @return The symmetric matrix in double precision
+template <std::size_t size>
+SquareMatrix<size> unpackSymmetric(const float* packed) {
+  SquareMatrix<size> matrix;
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = i; j < size; ++j) {
+      matrix(i, j) = matrix(j, i) = *packed++;
+    }
+  }
+  return matrix;
+}
+
+}  // namespace detail
+
+/// Compact single precision storage for fitted tracks and their track states.
+///
+/// Parameters, jacobians and measurements are stored as floats and symmetric
+/// covariance matrices are packed into their upper triangles, which reduces
+/// the memory of a track state to less than half of the one used by
+/// @c VectorMultiTrajectory. Only the track states reachable from the tip of
+/// every track are kept and they are stored contiguously, so discarded
+/// branches of the combinatorial track finding do not take up space.
+///
+/// This is a storage container for finished tracks, e.g. for output, and not
+/// a @c MultiTrajectory backend: the backend interface hands out Eigen maps
+/// to double precision storage, so the values are converted when they are
+/// accessed. Tracks can be expanded into a regular track container again with
+/// @c copyTo.
+///
+/// @note Dynamic columns are not stored.
+/// @ingroup eventdata_tracks
+class CompactTrackContainer {
+ public:
+  /// Type alias for the track and track state index type
+  using IndexType = TrackIndexType;
+
+  /// Number of floats of a packed bound covariance matrix
+  static constexpr std::size_t kPackedCovarianceSize =
+      detail::packedSymmetricSize(eBoundSize);
+
+  /// Create an empty container
+  /// @param components The track state components to store. Jacobians are
+  ///                   rarely needed after the fit and are skipped by default.
+  explicit CompactTrackContainer(
+      TrackStatePropMask components = TrackStatePropMask::All &
+                                      ~TrackStatePropMask::Jacobian)
+      : m_components(components) {}
+
+  /// Track state components stored by this container
+  /// @return The mask of stored components
+  TrackStatePropMask components() const { return m_components; }
+
+  /// Reserve space for tracks and track states
+  /// @param nTracks The number of tracks
+  /// @param nTrackStates The number of track states
+  void reserve(std::size_t nTracks, std::size_t nTrackStates);
+
+  /// Remove all tracks and track states
+  void clear();
+
+  /// Number of stored tracks
+  /// @return The number of tracks
+  std::size_t size() const { return m_tracks.size(); }
+
+  /// Number of stored track states
+  /// @return The number of track states
+  std::size_t nTrackStates() const { return m_states.size(); }
+
+  /// Memory used by the stored quantities, excluding the source links'
+  /// payloads and the surfaces
+  /// @return The number of bytes in use
+  std::size_t memoryUsage() const;
+
+  /// @name Filling
+  /// @{
+
+  /// Add a copy of a track and its track states
+  /// @param track The track to copy
+  /// @return The index of the new track
+  template <TrackProxyConcept track_proxy_t>
+  IndexType addTrack(const track_proxy_t& track);
+
+  /// Add copies of all tracks of a track container
+  /// @param tracks The tracks to copy
+  template <TrackContainerFrontend track_container_t>
+  void addTracks(const track_container_t& tracks) {
+    for (const auto& track : tracks) {
+      addTrack(track);
+    }
+  }
+
+  /// @}
+
+  /// @name Expansion
+  /// @{
+
+  /// Copy a stored track into a track of a regular track container. The track
+  /// states are appended to the track, which is linked forward afterwards.
+  /// @param itrack The index of the stored track
+  /// @param track The destination track
+  template <MutableTrackProxyConcept track_proxy_t>
+  void copyTrackTo(IndexType itrack, track_proxy_t& track) const;
+
+  /// Copy all stored tracks into a regular track container
+  /// @param tracks The destination track container
+  template <TrackContainerFrontend track_container_t>
+  void copyTo(track_container_t& tracks) const {
+    for (IndexType itrack = 0; itrack < size(); ++itrack) {
+      auto track = tracks.makeTrack();
+      copyTrackTo(itrack, track);
+    }
+  }
+
+  /// @}
+
+  /// @name Track access
+  /// @{
+
+  /// @param itrack The track index
+  /// @return The reference surface or nullptr
+  const Surface* referenceSurface(IndexType itrack) const {
+    return m_trackSurfaces[itrack].get();
+  }
+
+  /// @param itrack The track index
+  /// @return The bound parameters at the reference surface
+  BoundVector parameters(IndexType itrack) const;
+
+  /// @param itrack The track index
+  /// @return The bound covariance at the reference surface
+  BoundMatrix covariance(IndexType itrack) const;
+
+  /// @param itrack The track index
+  /// @return The particle hypothesis
+  const ParticleHypothesis& particleHypothesis(IndexType itrack) const {
+    return m_tracks[itrack].particleHypothesis;
+  }
+
+  /// @param itrack The track index
+  /// @return The number of measurements
+  unsigned int nMeasurements(IndexType itrack) const {
+    return m_tracks[itrack].nMeasurements;
+  }
+
+  /// @param itrack The track index
+  /// @return The number of holes
+  unsigned int nHoles(IndexType itrack) const {
+    return m_tracks[itrack].nHoles;
+  }
+
+  /// @param itrack The track index
+  /// @return The number of outliers
+  unsigned int nOutliers(IndexType itrack) const {
+    return m_tracks[itrack].nOutliers;
+  }
+
+  /// @param itrack The track index
+  /// @return The number of shared hits
+  unsigned int nSharedHits(IndexType itrack) const {
+    return m_tracks[itrack].nSharedHits;
+  }
+
+  /// @param itrack The track index
+  /// @return The chi2 of the track
+  float chi2(IndexType itrack) const { return m_tracks[itrack].chi2; }
+
+  /// @param itrack The track index
+  /// @return The number of degrees of freedom
+  unsigned int nDoF(IndexType itrack) const { return m_tracks[itrack].nDoF; }
+
+  /// Range of the track states of a track, ordered from the innermost to the
+  /// outermost one
+  /// @param itrack The track index
+  /// @return The first and one past the last track state index
+  std::pair<IndexType, IndexType> trackStateRange(IndexType itrack) const {
+    return {m_tracks[itrack].stateBegin, m_tracks[itrack].stateEnd};
+  }
+
+  /// @}
+
+  /// @name Track state access
+  /// @{
+
+  /// @param istate The track state index
+  /// @return The components stored for this track state
+  TrackStatePropMask trackStateMask(IndexType istate) const;
+
+  /// @param istate The track state index
+  /// @param component One of predicted, filtered and smoothed
+  /// @return The bound parameters of the requested component
+  BoundVector trackStateParameters(IndexType istate,
+                                   TrackStatePropMask component) const;
+
+  /// @param istate The track state index
+  /// @param component One of predicted, filtered and smoothed
+  /// @return The bound covariance of the requested component
+  BoundMatrix trackStateCovariance(IndexType istate,
+                                   TrackStatePropMask component) const;
+
+  /// @param istate The track state index
+  /// @return The transport jacobian
+  BoundMatrix jacobian(IndexType istate) const;
+
+  /// @param istate The track state index
+  /// @return The dimension of the calibrated measurement
+  std::size_t calibratedSize(IndexType istate) const {
+    return m_states[istate].measdim;
+  }
+
+  /// @param istate The track state index
+  /// @return The calibrated measurement with @c calibratedSize entries
+  std::span<const float> calibrated(IndexType istate) const {
+    const auto& state = m_states[istate];
+    return {m_meas.data() + state.imeas, state.measdim};
+  }
+
+  /// @tparam measdim The dimension of the calibrated measurement
+  /// @param istate The track state index
+  /// @return The calibrated measurement covariance
+  template <std::size_t measdim>
+  SquareMatrix<measdim> calibratedCovariance(IndexType istate) const {
+    const auto& state = m_states[istate];
+    assert(state.measdim == measdim && "Measurement dimension mismatch");
+    return detail::unpackSymmetric<measdim>(m_meas.data() + state.imeas +
+                                            measdim);
+  }
+
+  /// @param istate The track state index
+  /// @return The bound subspace of the calibrated measurement
+  BoundSubspaceIndices projectorSubspaceIndices(IndexType istate) const {
+    return deserializeSubspaceIndices<eBoundSize>(m_states[istate].projector);
+  }
+
+  /// @param istate The track state index
+  /// @return The uncalibrated source link if set
+  const std::optional<SourceLink>& uncalibratedSourceLink(
+      IndexType istate) const {
+    return m_sourceLinks[istate];
+  }
+
+  /// @param istate The track state index
+  /// @return The reference surface or nullptr
+  const Surface* trackStateReferenceSurface(IndexType istate) const {
+    return m_stateSurfaces[istate].get();
+  }
+
+  /// @param istate The track state index
+  /// @return The chi2 contribution of the track state
+  float trackStateChi2(IndexType istate) const {
+    return m_states[istate].chi2;
+  }
+
+  /// @param istate The track state index
+  /// @return The path length of the track state
+  float pathLength(IndexType istate) const {
+    return m_states[istate].pathLength;
+  }
+
+  /// @param istate The track state index
+  /// @return The type flags of the track state
+  TrackStateType typeFlags(IndexType istate) const {
+    return TrackStateType{m_states[istate].typeFlags};
+  }
+
+  /// @}
+
+ private:
+  using Parameters = std::array<float, eBoundSize>;
+  using PackedCovariance = std::array<float, kPackedCovarianceSize>;
+  using Jacobian = std::array<float, eBoundSize * eBoundSize>;
+
+  static constexpr IndexType kInvalid = kTrackIndexInvalid;
+
+  struct TrackData {
+    IndexType stateBegin = 0;
+    IndexType stateEnd = 0;
+    ParticleHypothesis particleHypothesis = ParticleHypothesis::pion();
+    unsigned int nMeasurements = 0;
+    unsigned int nHoles = 0;
+    unsigned int nOutliers = 0;
+    unsigned int nSharedHits = 0;
+    float chi2 = 0;
+    unsigned int nDoF = 0;
+  };
+
+  struct TrackStateData {
+    // indices into the parameter and covariance pools, components shared
+    // within a track state refer to the same entry
+    IndexType ipredicted = kInvalid;
+    IndexType ifiltered = kInvalid;
+    IndexType ismoothed = kInvalid;
+    IndexType ijacobian = kInvalid;
+    IndexType imeas = kInvalid;
+    std::uint8_t measdim = 0;
+
+    float chi2 = 0;
+    float pathLength = 0;
+    TrackStateType::raw_type typeFlags{};
+    SerializedSubspaceIndices projector{};
+  };
+
+  IndexType addParameters(const auto& parameters, const auto& covariance) {
+    auto& params = m_params.emplace_back();
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      params[i] = static_cast<float>(parameters[i]);
+    }
+    detail::packSymmetric(covariance, m_cov.emplace_back().data());
+    return static_cast<IndexType>(m_params.size() - 1);
+  }
+
+  BoundVector unpackParameters(IndexType index) const;
+
+  TrackStatePropMask m_components;
+
+  std::vector<TrackData> m_tracks;
+  std::vector<Parameters> m_trackParams;
+  std::vector<PackedCovariance> m_trackCov;
+  std::vector<std::shared_ptr<const Surface>> m_trackSurfaces;
+
+  std::vector<TrackStateData> m_states;
+  std::vector<Parameters> m_params;
+  std::vector<PackedCovariance> m_cov;
+  std::vector<Jacobian> m_jac;
+  // calibrated measurements followed by their packed covariance
+  std::vector<float> m_meas;
+  std::vector<std::optional<SourceLink>> m_sourceLinks;
+  std::vector<std::shared_ptr<const Surface>> m_stateSurfaces;
+};
+
+template <TrackProxyConcept track_proxy_t>
+CompactTrackContainer::IndexType CompactTrackContainer::addTrack(
+    const track_proxy_t& track) {
+  using PM = TrackStatePropMask;
+
+  TrackData& data = m_tracks.emplace_back();
+  data.particleHypothesis = track.particleHypothesis();
+  data.nMeasurements = track.nMeasurements();
+  data.nHoles = track.nHoles();
+  data.nOutliers = track.nOutliers();
+  data.nSharedHits = track.nSharedHits();
+  data.chi2 = track.chi2();
+  data.nDoF = track.nDoF();
+
+  auto& params = m_trackParams.emplace_back();
+  auto& cov = m_trackCov.emplace_back();
+  if (track.hasReferenceSurface()) {
+    m_trackSurfaces.push_back(track.referenceSurface().getSharedPtr());
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      params[i] = static_cast<float>(track.parameters()[i]);
+    }
+    detail::packSymmetric(track.covariance(), cov.data());
+  } else {
+    m_trackSurfaces.emplace_back();
+    params.fill(0);
+    cov.fill(0);
+  }
+
+  // the track states are collected from the tip and reversed afterwards
+  data.stateBegin = static_cast<IndexType>(m_states.size());
+  for (const auto& ts : track.trackStatesReversed()) {
+    TrackStateData& state = m_states.emplace_back();
+    state.chi2 = ts.chi2();
+    state.pathLength = static_cast<float>(ts.pathLength());
+    state.typeFlags = ts.typeFlags().raw();
+
+    const PM mask = ts.getMask() & m_components;
+    if (ACTS_CHECK_BIT(mask, PM::Predicted)) {
+      state.ipredicted =
+          addParameters(ts.predicted(), ts.predictedCovariance());
+    }
+    if (ACTS_CHECK_BIT(mask, PM::Filtered)) {
+      state.ifiltered =
+          ACTS_CHECK_BIT(mask, PM::Predicted) &&
+                  ts.filtered().data() == ts.predicted().data()
+              ? state.ipredicted
+              : addParameters(ts.filtered(), ts.filteredCovariance());
+    }
+    if (ACTS_CHECK_BIT(mask, PM::Smoothed)) {
+      if (ACTS_CHECK_BIT(mask, PM::Filtered) &&
+          ts.smoothed().data() == ts.filtered().data()) {
+        state.ismoothed = state.ifiltered;
+      } else if (ACTS_CHECK_BIT(mask, PM::Predicted) &&
+                 ts.smoothed().data() == ts.predicted().data()) {
+        state.ismoothed = state.ipredicted;
+      } else {
+        state.ismoothed = addParameters(ts.smoothed(), ts.smoothedCovariance());
+      }
+    }
+    if (ACTS_CHECK_BIT(mask, PM::Jacobian)) {
+      auto& jac = m_jac.emplace_back();
+      for (std::size_t i = 0; i < jac.size(); ++i) {
+        jac[i] = static_cast<float>(ts.jacobian().data()[i]);
+      }
+      state.ijacobian = static_cast<IndexType>(m_jac.size() - 1);
+    }
+    if (ACTS_CHECK_BIT(mask, PM::Calibrated)) {
+      const std::size_t measdim = ts.calibratedSize();
+      state.measdim = static_cast<std::uint8_t>(measdim);
+      state.imeas = static_cast<IndexType>(m_meas.size());
+      state.projector = serializeSubspaceIndices(ts.projectorSubspaceIndices());
+      m_meas.resize(m_meas.size() + measdim +
+                    detail::packedSymmetricSize(measdim));
+      float* meas = m_meas.data() + state.imeas;
+      visit_measurement(measdim, [&](auto N) {
+        constexpr std::size_t kMeasurementSize = decltype(N)::value;
+        const auto calibrated = ts.template calibrated<kMeasurementSize>();
+        for (std::size_t i = 0; i < kMeasurementSize; ++i) {
+          meas[i] = static_cast<float>(calibrated[i]);
+        }
+        detail::packSymmetric(
+            ts.template calibratedCovariance<kMeasurementSize>(),
+            meas + kMeasurementSize);
+      });
+    }
+
+    if (ts.hasUncalibratedSourceLink()) {
+      m_sourceLinks.emplace_back(ts.getUncalibratedSourceLink());
+    } else {
+      m_sourceLinks.emplace_back(std::nullopt);
+    }
+    m_stateSurfaces.push_back(ts.hasReferenceSurface()
+                                  ? ts.referenceSurface().getSharedPtr()
+                                  : nullptr);
+  }
+  data.stateEnd = static_cast<IndexType>(m_states.size());
+
+  std::reverse(m_states.begin() + data.stateBegin, m_states.end());
+  std::reverse(m_sourceLinks.begin() + data.stateBegin, m_sourceLinks.end());
+  std::reverse(m_stateSurfaces.begin() + data.stateBegin,
+               m_stateSurfaces.end());
+
+  return static_cast<IndexType>(m_tracks.size() - 1);
+}
+
+template <MutableTrackProxyConcept track_proxy_t>
+void CompactTrackContainer::copyTrackTo(IndexType itrack,
+                                        track_proxy_t& track) const {
+  using PM = TrackStatePropMask;
+
+  const TrackData& data = m_tracks[itrack];
+  track.setParticleHypothesis(data.particleHypothesis);
+  track.setReferenceSurface(m_trackSurfaces[itrack]);
+  if (m_trackSurfaces[itrack] != nullptr) {
+    track.parameters() = parameters(itrack);
+    track.covariance() = covariance(itrack);
+  }
+  track.nMeasurements() = data.nMeasurements;
+  track.nHoles() = data.nHoles;
+  track.nOutliers() = data.nOutliers;
+  track.nSharedHits() = data.nSharedHits;
+  track.chi2() = data.chi2;
+  track.nDoF() = data.nDoF;
+
+  for (IndexType istate = data.stateBegin; istate < data.stateEnd; ++istate) {
+    const TrackStateData& state = m_states[istate];
+
+    // shared components are allocated once and shared afterwards
+    PM allocate = PM::None;
+    if (state.ipredicted != kInvalid) {
+      allocate |= PM::Predicted;
+    }
+    if (state.ifiltered != kInvalid && state.ifiltered != state.ipredicted) {
+      allocate |= PM::Filtered;
+    }
+    if (state.ismoothed != kInvalid && state.ismoothed != state.ifiltered &&
+        state.ismoothed != state.ipredicted) {
+      allocate |= PM::Smoothed;
+    }
+    if (state.ijacobian != kInvalid) {
+      allocate |= PM::Jacobian;
+    }
+    if (state.imeas != kInvalid) {
+      allocate |= PM::Calibrated;
+    }
+
+    auto ts = track.appendTrackState(allocate);
+    if (ACTS_CHECK_BIT(allocate, PM::Predicted)) {
+      ts.predicted() = unpackParameters(state.ipredicted);
+      ts.predictedCovariance() =
+          detail::unpackSymmetric<eBoundSize>(m_cov[state.ipredicted].data());
+    }
+    if (ACTS_CHECK_BIT(allocate, PM::Filtered)) {
+      ts.filtered() = unpackParameters(state.ifiltered);
+      ts.filteredCovariance() =
+          detail::unpackSymmetric<eBoundSize>(m_cov[state.ifiltered].data());
+    } else if (state.ifiltered != kInvalid) {
+      ts.shareFrom(PM::Predicted, PM::Filtered);
+    }
+    if (ACTS_CHECK_BIT(allocate, PM::Smoothed)) {
+      ts.smoothed() = unpackParameters(state.ismoothed);
+      ts.smoothedCovariance() =
+          detail::unpackSymmetric<eBoundSize>(m_cov[state.ismoothed].data());
+    } else if (state.ismoothed != kInvalid) {
+      ts.shareFrom(state.ismoothed == state.ifiltered ? PM::Filtered
+                                                       : PM::Predicted,
+                   PM::Smoothed);
+    }
+    if (ACTS_CHECK_BIT(allocate, PM::Jacobian)) {
+      ts.jacobian() = jacobian(istate);
+    }
+    if (ACTS_CHECK_BIT(allocate, PM::Calibrated)) {
+      const float* meas = m_meas.data() + state.imeas;
+      visit_measurement(state.measdim, [&](auto N) {
+        constexpr std::size_t kMeasurementSize = decltype(N)::value;
+        Vector<kMeasurementSize> calibrated;
+        for (std::size_t i = 0; i < kMeasurementSize; ++i) {
+          calibrated[i] = meas[i];
+        }
+        ts.allocateCalibrated(calibrated,
+                              detail::unpackSymmetric<kMeasurementSize>(
+                                  meas + kMeasurementSize));
+      });
+      const BoundSubspaceIndices subspace = projectorSubspaceIndices(istate);
+      ts.setProjectorSubspaceIndices(
+          std::span(subspace.begin(), state.measdim));
+    }
+
+    ts.chi2() = state.chi2;
+    ts.pathLength() = state.pathLength;
+    ts.typeFlags() = TrackStateType{state.typeFlags};
+    if (m_sourceLinks[istate].has_value()) {
+      ts.setUncalibratedSourceLink(SourceLink{*m_sourceLinks[istate]});
+    }
+    if (m_stateSurfaces[istate] != nullptr) {
+      ts.setReferenceSurface(m_stateSurfaces[istate]);
+    }
+  }
+
+  track.linkForward();
+}
+
+}  // namespace Acts
@@ -0,0 +1,437 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/MultiTrajectoryBackendConcept.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackContainerBackendConcept.hpp"
+#include "Acts/EventData/Types.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <any>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+class TrackingGeometry;
+class MappedMultiTrajectory;
+class MappedTrackContainer;
+
+/// Value type of a column in the flat binary track container format
+enum class FlatColumnType : std::uint8_t {
+  Fixed = 0,
+  UInt32,
+  UInt64,
+  Int32,
+  Int64,
+  Float,
+  Double,
+  Bool,
+};
+
+namespace detail {
+
+/// Header at the start of a flat binary track container file
+struct FlatFileHeader {
+  static constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S',
+                                                 'F', 'T', 'C', '\0'};
+  static constexpr std::uint32_t kVersion = 1;
+  static constexpr std::uint32_t kByteOrder = 0x01020304;
+
+  std::array<char, 8> magic = kMagic;
+  std::uint32_t version = kVersion;
+  std::uint32_t byteOrder = kByteOrder;
+  std::uint64_t nTracks = 0;
+  std::uint64_t nTrackStates = 0;
+  std::uint64_t nColumns = 0;
+};
+
+/// Location of a column in a flat binary track container file. The column
+/// table directly follows the file header.
+struct FlatColumnHeader {
+  /// Scope of a column
+  enum class Scope : std::uint8_t {
+    Tracks = 0,
+    TrackStates = 1,
+    DynamicTracks = 2,
+    DynamicTrackStates = 3,
+    Surfaces = 4,
+  };
+
+  std::uint64_t key = 0;
+  Scope scope = Scope::Tracks;
+  FlatColumnType type = FlatColumnType::Fixed;
+  std::uint16_t reserved = 0;
+  std::uint32_t elementSize = 0;
+  /// Offset of the first element from the start of the file
+  std::uint64_t offset = 0;
+  /// Number of elements
+  std::uint64_t count = 0;
+};
+
+/// Entry of the reference surface table of a flat binary track container
+/// file. Surfaces without geometry identifier are perigee surfaces.
+struct FlatSurfaceEntry {
+  std::uint64_t geometryId = 0;
+  std::array<double, 3> center = {};
+};
+
+/// Dynamic column of a mapped track container
+struct FlatDynamicColumn {
+  HashedString key{};
+  FlatColumnType type = FlatColumnType::Fixed;
+  const std::byte* data = nullptr;
+
+  /// Pointer to an element as expected by the proxy accessors
+  /// @param index The row index
+  /// @return The type-erased const pointer to the element
+  std::any get(std::size_t index) const;
+};
+
+/// Memory mapped flat binary track container file. Holds the mapping, the
+/// column locations and the reference surfaces.
+class MappedFlatTrackFile {
+ public:
+  using Scope = FlatColumnHeader::Scope;
+
+  /// Map a file and validate its layout
+  /// @param path The file to map
+  /// @param trackingGeometry Geometry used to resolve the reference surfaces
+  ///                         with a geometry identifier, can be nullptr
+  MappedFlatTrackFile(const std::filesystem::path& path,
+                      const TrackingGeometry* trackingGeometry);
+
+  MappedFlatTrackFile(const MappedFlatTrackFile&) = delete;
+  MappedFlatTrackFile& operator=(const MappedFlatTrackFile&) = delete;
+
+  ~MappedFlatTrackFile();
+
+  /// @return The number of tracks
+  std::size_t nTracks() const { return m_header->nTracks; }
+
+  /// @return The number of track states
+  std::size_t nTrackStates() const { return m_header->nTrackStates; }
+
+  /// Find a fixed column
+  /// @tparam T The element type of the column
+  /// @param scope The scope of the column
+  /// @param name The name of the column
+  /// @return Pointer to the first element
+  template <typename T>
+  const T* column(Scope scope, std::string_view name) const {
+    return reinterpret_cast<const T*>(
+        fixedColumn(scope, hashStringDynamic(name), sizeof(T)));
+  }
+
+  /// @param scope Either dynamic tracks or dynamic track states
+  /// @return The dynamic columns of the scope
+  std::vector<FlatDynamicColumn> dynamicColumns(Scope scope) const;
+
+  /// @param index The index into the surface table
+  /// @return The surface or nullptr
+  const Surface* surface(TrackIndexType index) const {
+    return index == kTrackIndexInvalid ? nullptr : m_surfaces[index];
+  }
+
+ private:
+  const FlatColumnHeader& findColumn(Scope scope, HashedString key,
+                                     std::size_t elementSize) const;
+
+  const std::byte* fixedColumn(Scope scope, HashedString key,
+                               std::size_t elementSize) const;
+
+  /// Check the column sizes and that all stored indices are in range
+  void validate(const std::filesystem::path& path) const;
+
+  void* m_data = nullptr;
+  std::size_t m_size = 0;
+
+  const FlatFileHeader* m_header = nullptr;
+  std::span<const FlatColumnHeader> m_columns;
+
+  std::vector<const Surface*> m_surfaces;
+  std::vector<std::shared_ptr<const Surface>> m_ownedSurfaces;
+};
+
+/// Access to the columns of the vector backends for the flat binary format
+struct FlatTrackContainerAccess {
+  using IndexData = detail_vmt::VectorMultiTrajectoryBase::IndexData;
+
+  static void write(std::ostream& os, const GeometryContext& gctx,
+                    const VectorTrackContainer& tracks,
+                    const VectorMultiTrajectory& trackStates,
+                    bool dropSourceLinks);
+};
+
+}  // namespace detail
+
+template <>
+struct IsReadOnlyMultiTrajectory<MappedMultiTrajectory> : std::true_type {};
+
+/// Read-only track state backend on top of a memory mapped flat binary file
+/// written by @ref writeFlatTrackContainer. The columns are used in place
+/// without deserialization.
+/// @note Source links are not stored and are not available
+/// @ingroup eventdata_tracks
+class MappedMultiTrajectory final
+    : public MultiTrajectory<MappedMultiTrajectory> {
+#ifndef DOXYGEN
+  friend MultiTrajectory<MappedMultiTrajectory>;
+#endif
+
+ public:
+  /// Create the backend for the track states of a mapped file
+  /// @param file The mapped file
+  explicit MappedMultiTrajectory(
+      std::shared_ptr<const detail::MappedFlatTrackFile> file);
+
+  // BEGIN INTERFACE
+  /// @cond
+
+  ConstTrackStateProxy::ConstParameters parameters_impl(
+      IndexType parIdx) const {
+    return ConstTrackStateProxy::ConstParameters{m_params[parIdx].data()};
+  }
+
+  ConstTrackStateProxy::ConstCovariance covariance_impl(
+      IndexType parIdx) const {
+    return ConstTrackStateProxy::ConstCovariance{m_cov[parIdx].data()};
+  }
+
+  ConstTrackStateProxy::ConstCovariance jacobian_impl(IndexType istate) const {
+    return ConstTrackStateProxy::ConstCovariance{
+        m_jac[m_index[istate].ijacobian].data()};
+  }
+
+  template <std::size_t measdim>
+  ConstTrackStateProxy::ConstCalibrated<measdim> calibrated_impl(
+      IndexType istate) const {
+    return ConstTrackStateProxy::ConstCalibrated<measdim>{
+        m_meas + m_measOffset[istate]};
+  }
+
+  template <std::size_t measdim>
+  ConstTrackStateProxy::ConstCalibratedCovariance<measdim>
+  calibratedCovariance_impl(IndexType istate) const {
+    return ConstTrackStateProxy::ConstCalibratedCovariance<measdim>{
+        m_measCov + m_measCovOffset[istate]};
+  }
+
+  IndexType calibratedSize_impl(IndexType istate) const {
+    return m_index[istate].measdim;
+  }
+
+  SourceLink getUncalibratedSourceLink_impl(IndexType /*istate*/) const {
+    throw std::runtime_error("Mapped track states have no source links");
+  }
+
+  const Surface* referenceSurface_impl(IndexType istate) const {
+    return m_file->surface(m_surfaces[istate]);
+  }
+
+  bool has_impl(HashedString key, IndexType istate) const;
+
+  IndexType size_impl() const { return m_size; }
+
+  std::any component_impl(HashedString key, IndexType istate) const;
+
+  bool hasColumn_impl(HashedString key) const;
+
+  std::span<const HashedString> dynamicKeys_impl() const {
+    return m_dynamicKeys;
+  }
+
+  /// @endcond
+  // END INTERFACE
+
+ private:
+  using IndexData = detail::FlatTrackContainerAccess::IndexData;
+  using Coefficients = detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients;
+  using Covariance = detail_tsp::FixedSizeTypes<eBoundSize>::Covariance;
+
+  std::shared_ptr<const detail::MappedFlatTrackFile> m_file;
+  IndexType m_size = 0;
+
+  const IndexData* m_index = nullptr;
+  const IndexType* m_previous = nullptr;
+  const IndexType* m_next = nullptr;
+  const Coefficients* m_params = nullptr;
+  const Covariance* m_cov = nullptr;
+  const double* m_meas = nullptr;
+  const IndexType* m_measOffset = nullptr;
+  const double* m_measCov = nullptr;
+  const IndexType* m_measCovOffset = nullptr;
+  const Covariance* m_jac = nullptr;
+  const SerializedSubspaceIndices* m_projectors = nullptr;
+  const IndexType* m_surfaces = nullptr;
+
+  std::vector<detail::FlatDynamicColumn> m_dynamic;
+  std::vector<HashedString> m_dynamicKeys;
+};
+
+static_assert(
+    ConstMultiTrajectoryBackend<MappedMultiTrajectory>,
+    "MappedMultiTrajectory does not fulfill ConstMultiTrajectoryBackend");
+
+template <>
+struct IsReadOnlyTrackContainer<MappedTrackContainer> : std::true_type {};
+
+/// Read-only track backend on top of a memory mapped flat binary file written
+/// by @ref writeFlatTrackContainer. The columns are used in place without
+/// deserialization.
+/// @ingroup eventdata_tracks
+class MappedTrackContainer final {
+ public:
+  /// Type alias for the track index type
+  using IndexType = TrackIndexType;
+  /// Type alias for the const parameters map
+  using ConstParameters =
+      typename detail_tsp::FixedSizeTypes<eBoundSize, true>::CoefficientsMap;
+  /// Type alias for the const covariance map
+  using ConstCovariance =
+      typename detail_tsp::FixedSizeTypes<eBoundSize, true>::CovarianceMap;
+
+  /// Create the backend for the tracks of a mapped file
+  /// @param file The mapped file
+  explicit MappedTrackContainer(
+      std::shared_ptr<const detail::MappedFlatTrackFile> file);
+
+  // BEGIN INTERFACE
+  /// @cond
+
+  std::size_t size_impl() const { return m_size; }
+
+  std::any component_impl(HashedString key, IndexType itrack) const;
+
+  ConstParameters parameters(IndexType itrack) const {
+    return ConstParameters{m_params[itrack].data()};
+  }
+
+  ConstCovariance covariance(IndexType itrack) const {
+    return ConstCovariance{m_cov[itrack].data()};
+  }
+
+  bool hasColumn_impl(HashedString key) const;
+
+  const Surface* referenceSurface_impl(IndexType itrack) const {
+    return m_file->surface(m_surfaces[itrack]);
+  }
+
+  ParticleHypothesis particleHypothesis_impl(IndexType itrack) const {
+    return m_particleHypothesis[itrack];
+  }
+
+  std::span<const HashedString> dynamicKeys_impl() const {
+    return m_dynamicKeys;
+  }
+
+  /// @endcond
+  // END INTERFACE
+
+ private:
+  using Coefficients = detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients;
+  using Covariance = detail_tsp::FixedSizeTypes<eBoundSize>::Covariance;
+
+  std::shared_ptr<const detail::MappedFlatTrackFile> m_file;
+  std::size_t m_size = 0;
+
+  const IndexType* m_tipIndex = nullptr;
+  const IndexType* m_stemIndex = nullptr;
+  const ParticleHypothesis* m_particleHypothesis = nullptr;
+  const Coefficients* m_params = nullptr;
+  const Covariance* m_cov = nullptr;
+  const IndexType* m_surfaces = nullptr;
+  const unsigned int* m_nMeasurements = nullptr;
+  const unsigned int* m_nHoles = nullptr;
+  const float* m_chi2 = nullptr;
+  const unsigned int* m_ndf = nullptr;
+  const unsigned int* m_nOutliers = nullptr;
+  const unsigned int* m_nSharedHits = nullptr;
+
+  std::vector<detail::FlatDynamicColumn> m_dynamic;
+  std::vector<HashedString> m_dynamicKeys;
+};
+
+static_assert(TrackContainerBackend<MappedTrackContainer>,
+              "MappedTrackContainer does not fulfill TrackContainerBackend");
+
+/// Track container reading a memory mapped flat binary file
+using MappedFlatTrackContainer =
+    TrackContainer<MappedTrackContainer, MappedMultiTrajectory,
+                   std::shared_ptr>;
+
+/// Write tracks and track states in the flat binary format.
+///
+/// The column vectors of the backends are written as they are behind a small
+/// header, such that they can be used in place after mapping the file with
+/// @ref mapFlatTrackContainer. Reference surfaces are stored by geometry
+/// identifier, surfaces without one are only supported for perigee surfaces.
+/// Dynamic columns of arithmetic type and bool are written, others are
+/// skipped. Source links are type-erased and cannot be stored, track states
+/// with source links are rejected unless dropping them is requested.
+///
+/// @note The format depends on the byte order and the layout of the backend
+///       columns, it is meant for checkpoints between job stages and not for
+///       long term storage.
+/// @param os The binary output stream
+/// @param gctx The geometry context to evaluate free perigee surfaces
+/// @param tracks The tracks to write
+/// @param trackStates The track states to write
+/// @param dropSourceLinks Write track states with source links without them
+///                        instead of throwing
+void writeFlatTrackContainer(std::ostream& os, const GeometryContext& gctx,
+                             const VectorTrackContainer& tracks,
+                             const VectorMultiTrajectory& trackStates,
+                             bool dropSourceLinks = false);
+
+/// Write a track container in the flat binary format
+/// @param os The binary output stream
+/// @param gctx The geometry context to evaluate free perigee surfaces
+/// @param tracks The track container to write
+/// @param dropSourceLinks Write track states with source links without them
+///                        instead of throwing
+template <template <typename> class holder_t>
+void writeFlatTrackContainer(
+    std::ostream& os, const GeometryContext& gctx,
+    const TrackContainer<VectorTrackContainer, VectorMultiTrajectory, holder_t>&
+        tracks,
+    bool dropSourceLinks = false) {
+  writeFlatTrackContainer(os, gctx, tracks.container(),
+                          tracks.trackStateContainer(), dropSourceLinks);
+}
+
+/// Map a file written by @ref writeFlatTrackContainer
+/// @param path The file to map
+/// @param trackingGeometry Geometry used to resolve the reference surfaces
+///                         with a geometry identifier. Without a geometry
+///                         these surfaces are not available.
+/// @return A read-only track container using the mapped columns in place
+MappedFlatTrackContainer mapFlatTrackContainer(
+    const std::filesystem::path& path,
+    const TrackingGeometry* trackingGeometry = nullptr);
+
+}  // namespace Acts
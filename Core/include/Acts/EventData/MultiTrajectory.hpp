@@ -781,6 +781,23 @@ class MultiTrajectory {
       self().copyDynamicFrom_impl(dstIdx, key, srcPtr);
     }
   }
+
+  template <typename T>
+  void copyReferenceSurfaceFrom(IndexType dstIdx, const T& src,
+                                IndexType srcIdx)
+    requires(!ReadOnly)
+  {
+    // Backends can copy their stored surface without an ownership check
+    if constexpr (requires {
+                    self().copyReferenceSurfaceFrom_impl(dstIdx, src.self(),
+                                                         srcIdx);
+                  }) {
+      self().copyReferenceSurfaceFrom_impl(dstIdx, src.self(), srcIdx);
+    } else {
+      setReferenceSurface(dstIdx,
+                          src.referenceSurface(srcIdx)->getSharedPtr());
+    }
+  }
 };
 
 }  // namespace Acts
@@ -11,7 +11,11 @@
 #include "Acts/EventData/TrackProxy.hpp"
 #include "Acts/EventData/TrackStateProxy.hpp"
 #include "Acts/Utilities/HashedString.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
 
+#include <cassert>
+#include <span>
+#include <string>
 #include <type_traits>
 
 namespace Acts::detail {
@@ -119,4 +123,60 @@ using ProxyAccessor = ProxyAccessorBase<T, false>;
 /// @details Provides read-only access to proxy data with const-qualified member functions
 template <typename T>
 using ConstProxyAccessor = ProxyAccessorBase<T, true>;
+
+/// Utility class that accesses a dynamic column which is resolved once to the
+/// typed column storage of a container backend, e.g. @c VectorMultiTrajectory
+/// or @c VectorTrackContainer. Unlike @ref ProxyAccessorBase this avoids the
+/// key lookup and the type-erased access for every element.
+/// @note The accessor is invalidated when rows are added to or removed from
+///       the backend, and it can only be used with proxies of that backend.
+/// @tparam T the type of the value to access
+/// @tparam ReadOnly true if this is a const accessor
+template <typename T, bool ReadOnly>
+struct ResolvedProxyAccessorBase {
+  /// Type of the accessed values
+  using value_type = const_if_t<ReadOnly, T>;
+
+  /// Values of the column, indexed like the proxies
+  std::span<value_type> values;
+
+  /// Resolve the column of a backend from an already-hashed string key
+  /// @tparam backend_t the type of the backend
+  /// @param backend the backend holding the column
+  /// @param key the key
+  template <typename backend_t>
+  ResolvedProxyAccessorBase(backend_t& backend, HashedString key)
+      : values{backend.template dynamicColumn<T>(key)} {}
+
+  /// Resolve the column of a backend from a string key
+  /// @tparam backend_t the type of the backend
+  /// @param backend the backend holding the column
+  /// @param key the key
+  template <typename backend_t>
+  ResolvedProxyAccessorBase(backend_t& backend, const std::string& key)
+      : ResolvedProxyAccessorBase(backend, hashStringDynamic(key)) {}
+
+  /// Access the column value of the proxy given as an argument
+  /// @tparam proxy_t the type of the proxy
+  /// @param proxy the proxy to access
+  /// @return reference to the column value, const for const accessors
+  template <detail::ProxyType proxy_t>
+  value_type& operator()(const proxy_t& proxy) const {
+    static_assert(ReadOnly || !proxy_t::ReadOnly,
+                  "Cannot get mutable ref for const proxy");
+    assert(proxy.index() < values.size() && "Proxy index out of bounds");
+    return values[proxy.index()];
+  }
+};
+
+/// @brief Type alias for a mutable resolved proxy accessor
+/// @tparam T The type of the component being accessed
+template <typename T>
+using ResolvedProxyAccessor = ResolvedProxyAccessorBase<T, false>;
+
+/// @brief Type alias for a const resolved proxy accessor
+/// @tparam T The type of the component being accessed
+template <typename T>
+using ConstResolvedProxyAccessor = ResolvedProxyAccessorBase<T, true>;
+
 }  // namespace Acts
@@ -0,0 +1,49 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace Acts {
+
+class Surface;
+class TrackingGeometry;
+
+/// Ownership of the reference surfaces stored by the track and track state
+/// containers
+/// @ingroup eventdata_tracks
+enum class ReferenceSurfaceStorage : std::uint8_t {
+  /// Every track or track state shares the ownership of its surface
+  Shared,
+  /// Surfaces of the tracking geometry given to the container are referenced
+  /// without taking ownership, so copying, overwriting and removing them does
+  /// not update their reference count. A surface only counts as part of the
+  /// geometry if the geometry finds it by its identifier, all other surfaces,
+  /// e.g. perigee surfaces, remain shared. The container keeps the tracking
+  /// geometry alive.
+  NonOwningGeometry,
+};
+
+namespace detail {
+
+/// Convert a reference surface into the representation stored by a container
+/// that references the surfaces of the given tracking geometry without
+/// taking ownership. Whether the surface belongs to the geometry is checked
+/// through the geometry registered on the surface, without a lookup.
+/// @param surface The reference surface to store
+/// @param geometry The tracking geometry, nullptr if all surfaces are shared
+/// @return The pointer to store, an aliasing pointer without control block
+///         if the surface belongs to the geometry
+std::shared_ptr<const Surface> storedReferenceSurface(
+    std::shared_ptr<const Surface> surface, const TrackingGeometry* geometry);
+
+}  // namespace detail
+
+}  // namespace Acts
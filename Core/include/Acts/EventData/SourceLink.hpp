@@ -26,6 +26,10 @@ namespace Acts {
 
 /// @ingroup eventdata_measurement
 /// Type-erased source link wrapper.
+///
+/// @note Payloads which are trivially copyable and fit into
+///       @c ACTS_SOURCELINK_SBO_SIZE bytes are copied, moved and destroyed
+///       as raw bytes without dispatching to type-erased handlers.
 class SourceLink final {
   using any_type = AnyBase<ACTS_SOURCELINK_SBO_SIZE>;
 
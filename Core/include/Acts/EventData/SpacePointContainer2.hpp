@@ -13,6 +13,7 @@
 #include "Acts/EventData/SpacePointColumns.hpp"
 #include "Acts/EventData/Types.hpp"
 #include "Acts/EventData/detail/SpacePointContainer2Column.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
 #include "Acts/Utilities/Zip.hpp"
 #include "Acts/Utilities/detail/ContainerIterator.hpp"
 #include "Acts/Utilities/detail/ContainerRange.hpp"
@@ -21,8 +22,10 @@
 #include <cassert>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -41,6 +44,45 @@ using MutableSpacePointProxy2 = SpacePointProxy2<false>;
 /// Const proxy to a space point for read-only access
 using ConstSpacePointProxy2 = SpacePointProxy2<true>;
 
+/// Non-owning views of contiguous space point columns used to import into
+/// and export from a space point container in bulk. Empty spans denote
+/// columns which are not transferred.
+template <bool read_only>
+struct SpacePointColumnSpans2 {
+  /// Flag indicating whether the spans are read-only
+  constexpr static bool ReadOnly = read_only;
+  /// Type alias for a span over column values
+  template <typename T>
+  using Span = std::span<const_if_t<ReadOnly, T>>;
+
+  /// The x coordinates
+  Span<float> x;
+  /// The y coordinates
+  Span<float> y;
+  /// The z coordinates
+  Span<float> z;
+  /// The r coordinates, derived from x and y on import if empty
+  Span<float> r;
+  /// The phi coordinates, derived from x and y on import if empty
+  Span<float> phi;
+  /// The times
+  Span<float> time;
+  /// The variances in z direction
+  Span<float> varianceZ;
+  /// The variances in r direction
+  Span<float> varianceR;
+  /// The flattened source links of all space points
+  Span<SourceLink> sourceLinks;
+  /// The number of source links per space point. If empty on import every
+  /// space point has exactly one source link.
+  Span<std::uint8_t> sourceLinkCounts;
+};
+
+/// Read-only column spans used to import space points in bulk
+using ConstSpacePointColumnSpans2 = SpacePointColumnSpans2<true>;
+/// Mutable column spans used to export space points in bulk
+using MutableSpacePointColumnSpans2 = SpacePointColumnSpans2<false>;
+
 /// A container for space points, which can hold additional columns of data
 /// and allows for efficient access to space points and their associated source
 /// links. Individual space points are addressed via index. A proxy object
@@ -66,13 +108,26 @@ class SpacePointContainer2 {
 
   /// Constructs and empty space point container.
   /// @param columns The columns to create in the container.
+  /// @param memoryResource The memory resource used for all column and
+  ///        source link allocations, e.g. a per-event arena.
   explicit SpacePointContainer2(
-      SpacePointColumns columns = SpacePointColumns::None) noexcept;
+      SpacePointColumns columns = SpacePointColumns::None,
+      std::pmr::memory_resource *memoryResource =
+          std::pmr::get_default_resource()) noexcept;
 
   /// Constructs a copy of the given space point container.
+  /// @note Following the `std::pmr` conventions the copy uses the default
+  ///       memory resource.
   /// @param other The space point container to copy.
   SpacePointContainer2(const SpacePointContainer2 &other) noexcept;
 
+  /// Constructs a copy of the given space point container using the given
+  /// memory resource.
+  /// @param other The space point container to copy.
+  /// @param memoryResource The memory resource used by the copy.
+  SpacePointContainer2(const SpacePointContainer2 &other,
+                       std::pmr::memory_resource *memoryResource) noexcept;
+
   /// Move constructs a space point container.
   /// @param other The space point container to move.
   SpacePointContainer2(SpacePointContainer2 &&other) noexcept;
@@ -81,15 +136,24 @@ class SpacePointContainer2 {
   ~SpacePointContainer2() noexcept = default;
 
   /// Assignment operator for copying a space point container.
+  /// The container keeps its memory resource.
   /// @param other The space point container to copy.
   /// @return A reference to this space point container.
   SpacePointContainer2 &operator=(const SpacePointContainer2 &other) noexcept;
 
   /// Move assignment operator for a space point container.
+  /// The container keeps its memory resource, the content is copied if the
+  /// memory resources of the containers differ.
   /// @param other The space point container to move.
   /// @return A reference to this space point container.
   SpacePointContainer2 &operator=(SpacePointContainer2 &&other) noexcept;
 
+  /// Returns the memory resource used by the container.
+  /// @return The memory resource used for all allocations of the container.
+  std::pmr::memory_resource *memoryResource() const noexcept {
+    return m_memoryResource;
+  }
+
   /// Returns the number of space points in the container.
   /// @return The number of space points in the container.
   std::uint32_t size() const noexcept { return m_size; }
@@ -110,6 +174,36 @@ class SpacePointContainer2 {
   /// @return A mutable proxy to the newly created space point.
   MutableProxy createSpacePoint() noexcept;
 
+  /// Creates the given number of space points at the end of the container
+  /// and fills their columns from the given spans in one go.
+  ///
+  /// Non-empty spans have to match the number of space points and the
+  /// corresponding columns have to exist. The r and phi columns as well as
+  /// the packed columns are derived from the other inputs if they are not
+  /// given explicitly. Columns without input keep their default values.
+  /// @param count The number of space points to create.
+  /// @param columns The column data of the new space points.
+  /// @return The index range of the newly created space points.
+  /// @throws std::invalid_argument if the span sizes are inconsistent.
+  /// @throws std::logic_error if a column with input does not exist.
+  IndexRange createSpacePoints(std::uint32_t count,
+                               const ConstSpacePointColumnSpans2 &columns);
+
+  /// Copies the columns of a range of space points into the given spans.
+  ///
+  /// Non-empty spans have to match the size of the range, except for the
+  /// source links span which has to be large enough to hold all source links
+  /// of the range.
+  /// @param range The index range of the space points to export.
+  /// @param columns The destination spans.
+  /// @return The number of source links written.
+  /// @throws std::out_of_range if the range exceeds the container.
+  /// @throws std::invalid_argument if the span sizes are inconsistent.
+  /// @throws std::logic_error if a requested column does not exist.
+  std::size_t exportSpacePoints(
+      const IndexRange &range,
+      const MutableSpacePointColumnSpans2 &columns) const;
+
   /// Copies the specified columns from another space point to this space point
   /// @param index The index of the space point to copy to in this container.
   /// @param otherContainer The space point container to copy from.
@@ -617,6 +711,8 @@ class SpacePointContainer2 {
   template <typename T>
   using ColumnHolder = detail::sp::ColumnHolder<T>;
 
+  std::pmr::memory_resource *m_memoryResource{};
+
   std::uint32_t m_size{0};
 
   std::unordered_map<std::string, ColumnHolderBase *> m_allColumns;
@@ -624,7 +720,7 @@ class SpacePointContainer2 {
   std::unordered_map<std::string, std::unique_ptr<ColumnHolderBase>>
       m_dynamicColumns;
 
-  std::vector<SourceLink> m_sourceLinks;
+  std::pmr::vector<SourceLink> m_sourceLinks;
 
   std::optional<ColumnHolder<std::uint32_t>> m_sourceLinkOffsetColumn;
   std::optional<ColumnHolder<std::uint8_t>> m_sourceLinkCountColumn;
@@ -713,7 +809,7 @@ class SpacePointContainer2 {
     if (hasColumn(name)) {
       throw std::runtime_error("Column already exists: " + name);
     }
-    auto holder = std::make_unique<Holder>();
+    auto holder = std::make_unique<Holder>(m_memoryResource);
     holder->resize(size());
     auto proxy = holder->proxy(*this);
     m_allColumns.try_emplace(name, holder.get());
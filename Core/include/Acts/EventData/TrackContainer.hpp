@@ -486,6 +486,23 @@ class TrackContainer {
     }
   }
 
+  template <typename T>
+  void copyReferenceSurfaceFrom(IndexType dstIdx, const T& src,
+                                IndexType srcIdx)
+    requires(!ReadOnly)
+  {
+    // Backends can copy their stored surface without an ownership check
+    if constexpr (requires {
+                    container().copyReferenceSurfaceFrom_impl(dstIdx, src,
+                                                              srcIdx);
+                  }) {
+      container().copyReferenceSurfaceFrom_impl(dstIdx, src, srcIdx);
+    } else {
+      container().setReferenceSurface_impl(
+          dstIdx, src.referenceSurface_impl(srcIdx)->getSharedPtr());
+    }
+  }
+
   const_if_t<ReadOnly, holder_t<track_container_t>> m_container;
   const_if_t<ReadOnly, holder_t<traj_t>> m_traj;
 };
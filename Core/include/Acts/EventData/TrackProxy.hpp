@@ -534,7 +534,8 @@ class TrackProxy
     setParticleHypothesis(other.particleHypothesis());
 
     if (other.hasReferenceSurface()) {
-      setReferenceSurface(other.referenceSurface().getSharedPtr());
+      m_container->copyReferenceSurfaceFrom(
+          m_index, other.m_container->container(), other.m_index);
       parameters() = other.parameters();
       covariance() = other.covariance();
     } else {
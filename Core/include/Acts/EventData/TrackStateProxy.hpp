@@ -596,7 +596,8 @@ class TrackStateProxy
     typeFlags() = other.typeFlags();
 
     if (other.hasReferenceSurface()) {
-      setReferenceSurface(other.referenceSurface().getSharedPtr());
+      m_traj->copyReferenceSurfaceFrom(m_istate, other.container(),
+                                       other.index());
     }
 
     m_traj->copyDynamicFrom(m_istate, other.container(), other.index());
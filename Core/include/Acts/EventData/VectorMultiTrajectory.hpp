@@ -11,6 +11,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/MultiTrajectoryBackendConcept.hpp"
+#include "Acts/EventData/ReferenceSurfaceStorage.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/EventData/Types.hpp"
@@ -25,7 +26,9 @@
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
+#include <memory_resource>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -38,9 +41,14 @@
 
 namespace Acts {
 class Surface;
+class ConstVectorMultiTrajectory;
 template <typename T>
 struct IsReadOnlyMultiTrajectory;
 
+namespace detail {
+struct FlatTrackContainerAccess;
+}  // namespace detail
+
 namespace detail_vmt {
 
 using IndexType = TrackIndexType;
@@ -54,28 +62,47 @@ struct NonInitializingAllocator {
 
   NonInitializingAllocator() noexcept = default;
 
+  explicit NonInitializingAllocator(
+      std::pmr::memory_resource* memoryResource) noexcept
+      : m_memoryResource(memoryResource) {}
+
   template <class U>
   explicit NonInitializingAllocator(
-      const NonInitializingAllocator<U>& /*other*/) noexcept {}
+      const NonInitializingAllocator<U>& other) noexcept
+      : m_memoryResource(other.memoryResource()) {}
 
   template <class U>
-  bool operator==(const NonInitializingAllocator<U>& /*other*/) const noexcept {
-    return true;
+  bool operator==(const NonInitializingAllocator<U>& other) const noexcept {
+    return m_memoryResource == other.memoryResource() ||
+           m_memoryResource->is_equal(*other.memoryResource());
   }
 
-  T* allocate(std::size_t n) const { return std::allocator<T>{}.allocate(n); }
+  T* allocate(std::size_t n) const {
+    return static_cast<T*>(
+        m_memoryResource->allocate(n * sizeof(T), alignof(T)));
+  }
 
   void deallocate(T* const p, std::size_t n) const noexcept {
-    std::allocator<T>{}.deallocate(p, n);
+    m_memoryResource->deallocate(p, n * sizeof(T), alignof(T));
   }
 
   void construct(T* /*p*/) const {
     // This construct function intentionally does not initialize the object!
     // Be very careful when using this allocator.
   }
+
+  std::pmr::memory_resource* memoryResource() const noexcept {
+    return m_memoryResource;
+  }
+
+ private:
+  std::pmr::memory_resource* m_memoryResource =
+      std::pmr::get_default_resource();
 };
 
 class VectorMultiTrajectoryBase {
+  friend struct Acts::detail::FlatTrackContainerAccess;
+
  public:
   struct Statistics {
     using axis_t = boost::histogram::axis::variant<
@@ -202,24 +229,46 @@ class VectorMultiTrajectoryBase {
     TrackStatePropMask allocMask = TrackStatePropMask::None;
   };
 
-  VectorMultiTrajectoryBase() noexcept = default;
+  VectorMultiTrajectoryBase() noexcept
+      : VectorMultiTrajectoryBase(std::pmr::get_default_resource()) {}
+
+  explicit VectorMultiTrajectoryBase(
+      std::pmr::memory_resource* memoryResource) noexcept
+      : m_index{memoryResource},
+        m_previous{memoryResource},
+        m_next{memoryResource},
+        m_params{memoryResource},
+        m_cov{memoryResource},
+        m_meas{MeasurementAllocator{memoryResource}},
+        m_measOffset{memoryResource},
+        m_measCov{MeasurementAllocator{memoryResource}},
+        m_measCovOffset{memoryResource},
+        m_jac{memoryResource},
+        m_sourceLinks{memoryResource},
+        m_projectors{memoryResource},
+        m_referenceSurfaces{memoryResource} {}
 
   VectorMultiTrajectoryBase(const VectorMultiTrajectoryBase& other)
-      : m_index{other.m_index},
-        m_previous{other.m_previous},
-        m_next{other.m_next},
-        m_params{other.m_params},
-        m_cov{other.m_cov},
-        m_meas{other.m_meas},
-        m_measOffset{other.m_measOffset},
-        m_measCov{other.m_measCov},
-        m_measCovOffset{other.m_measCovOffset},
-        m_jac{other.m_jac},
-        m_sourceLinks{other.m_sourceLinks},
-        m_projectors{other.m_projectors},
-        m_referenceSurfaces{other.m_referenceSurfaces} {
+      : VectorMultiTrajectoryBase(other, std::pmr::get_default_resource()) {}
+
+  VectorMultiTrajectoryBase(const VectorMultiTrajectoryBase& other,
+                            std::pmr::memory_resource* memoryResource)
+      : m_index{other.m_index, memoryResource},
+        m_previous{other.m_previous, memoryResource},
+        m_next{other.m_next, memoryResource},
+        m_params{other.m_params, memoryResource},
+        m_cov{other.m_cov, memoryResource},
+        m_meas{other.m_meas, MeasurementAllocator{memoryResource}},
+        m_measOffset{other.m_measOffset, memoryResource},
+        m_measCov{other.m_measCov, MeasurementAllocator{memoryResource}},
+        m_measCovOffset{other.m_measCovOffset, memoryResource},
+        m_jac{other.m_jac, memoryResource},
+        m_sourceLinks{other.m_sourceLinks, memoryResource},
+        m_projectors{other.m_projectors, memoryResource},
+        m_referenceSurfaces{other.m_referenceSurfaces, memoryResource},
+        m_referenceSurfaceGeometry{other.m_referenceSurfaceGeometry} {
     for (const auto& [key, value] : other.m_dynamic) {
-      m_dynamic.insert({key, value->clone()});
+      m_dynamic.insert({key, value->clone(false, memoryResource)});
     }
     m_dynamicKeys = other.m_dynamicKeys;
   };
@@ -348,32 +397,71 @@ class VectorMultiTrajectoryBase {
     return m_referenceSurfaces[istate].get();
   }
 
+  /// Memory resource used by the track state columns, including the dynamic
+  /// ones.
+  std::pmr::memory_resource* memoryResource() const noexcept {
+    return m_index.get_allocator().resource();
+  }
+
+  /// How the reference surfaces of the track states are stored
+  ReferenceSurfaceStorage referenceSurfaceStorage() const noexcept {
+    return m_referenceSurfaceGeometry != nullptr
+               ? ReferenceSurfaceStorage::NonOwningGeometry
+               : ReferenceSurfaceStorage::Shared;
+  }
+
+  /// Resolve a dynamic column to its values, indexed by track state
+  /// @note The span is invalidated when track states are added or removed
+  /// @tparam T The value type of the column
+  /// @param key The hashed column key
+  /// @return The column values
+  template <typename T>
+  std::span<const T> dynamicColumn(HashedString key) const {
+    return detail::dynamicColumnValues<T>(m_dynamic, key);
+  }
+
  protected:
+  using MeasurementAllocator = NonInitializingAllocator<double>;
+
+  /// Copy the reference surface of a track state of another container. The
+  /// stored pointer is copied as is if both containers reference the same
+  /// tracking geometry, so no ownership check is needed.
+  /// @param istate The track state to set the surface on
+  /// @param src The container to copy from
+  /// @param srcIdx The track state to copy the surface of
+  void copyReferenceSurface(IndexType istate,
+                            const VectorMultiTrajectoryBase& src,
+                            IndexType srcIdx);
+
   /// index to map track states to the corresponding
-  std::vector<IndexData> m_index;
-  std::vector<IndexType> m_previous;
-  std::vector<IndexType> m_next;
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients>
+  std::pmr::vector<IndexData> m_index;
+  std::pmr::vector<IndexType> m_previous;
+  std::pmr::vector<IndexType> m_next;
+  std::pmr::vector<
+      typename detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients>
       m_params;
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
+  std::pmr::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
       m_cov;
 
-  std::vector<double, NonInitializingAllocator<double>> m_meas;
-  std::vector<IndexType> m_measOffset;
-  std::vector<double, NonInitializingAllocator<double>> m_measCov;
-  std::vector<IndexType> m_measCovOffset;
+  std::vector<double, MeasurementAllocator> m_meas;
+  std::pmr::vector<IndexType> m_measOffset;
+  std::vector<double, MeasurementAllocator> m_measCov;
+  std::pmr::vector<IndexType> m_measCovOffset;
 
-  std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
+  std::pmr::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
       m_jac;
-  std::vector<std::optional<SourceLink>> m_sourceLinks;
-  std::vector<SerializedSubspaceIndices> m_projectors;
+  std::pmr::vector<std::optional<SourceLink>> m_sourceLinks;
+  std::pmr::vector<SerializedSubspaceIndices> m_projectors;
 
   // owning vector of shared pointers to surfaces
   //
   // This might be problematic when appending a large number of surfaces
   // trackstates, because vector has to reallocated and thus copy. This might
   // be handled in a smart way by moving but not sure.
-  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  std::pmr::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  /// Tracking geometry whose surfaces are referenced without ownership, if
+  /// any, kept alive by the container
+  std::shared_ptr<const TrackingGeometry> m_referenceSurfaceGeometry;
 
   std::vector<HashedString> m_dynamicKeys;
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
@@ -399,6 +487,16 @@ class VectorMultiTrajectory final
   VectorMultiTrajectory() = default;
   using VectorMultiTrajectoryBase::VectorMultiTrajectoryBase;
 
+  /// Construct an empty multi-trajectory whose track state columns are
+  /// allocated from the given memory resource, e.g. a per-event arena
+  /// @param memoryResource Memory resource used for the track state columns
+  explicit VectorMultiTrajectory(std::pmr::memory_resource* memoryResource)
+      : VectorMultiTrajectoryBase(memoryResource) {}
+
+  /// Construct from a const multi-trajectory, taking over its storage
+  /// @param other Const multi-trajectory to move from
+  explicit VectorMultiTrajectory(ConstVectorMultiTrajectory&& other);
+
   /// Get statistics about memory usage
   /// @return Statistics object
   Statistics statistics() const {
@@ -496,7 +594,8 @@ class VectorMultiTrajectory final
   template <typename T>
   void addColumn_impl(std::string_view key) {
     HashedString hashedKey = hashStringDynamic(key);
-    m_dynamic.insert({hashedKey, std::make_unique<detail::DynamicColumn<T>>()});
+    m_dynamic.insert({hashedKey, std::make_unique<detail::DynamicColumn<T>>(
+                                     memoryResource())});
   }
 
   bool hasColumn_impl(HashedString key) const {
@@ -548,7 +647,18 @@ class VectorMultiTrajectory final
 
   void setReferenceSurface_impl(IndexType istate,
                                 std::shared_ptr<const Surface> surface) {
-    m_referenceSurfaces[istate] = std::move(surface);
+    if (m_referenceSurfaceGeometry == nullptr) {
+      m_referenceSurfaces[istate] = std::move(surface);
+    } else {
+      m_referenceSurfaces[istate] = detail::storedReferenceSurface(
+          std::move(surface), m_referenceSurfaceGeometry.get());
+    }
+  }
+
+  void copyReferenceSurfaceFrom_impl(
+      IndexType istate, const detail_vmt::VectorMultiTrajectoryBase& src,
+      IndexType srcIdx) {
+    copyReferenceSurface(istate, src, srcIdx);
   }
 
   void copyDynamicFrom_impl(IndexType dstIdx, HashedString key,
@@ -560,6 +670,39 @@ class VectorMultiTrajectory final
   /// Reserve space for track states
   /// @param n Number of track states to reserve space for
   void reserve(std::size_t n);
+
+  /// Rewrite the track state columns, including the dynamic ones, such that
+  /// only the given track states remain and are stored contiguously in the
+  /// given order. This drops e.g. the discarded branches of the combinatorial
+  /// track finding. Components shared between kept track states remain shared
+  /// and links to removed track states are invalidated.
+  /// @note All indices and proxies into this container are invalidated
+  /// @param states The track states to keep, in their new order
+  /// @return The new index of every previous track state, or
+  ///         @c kTrackIndexInvalid if it was removed
+  std::vector<IndexType> compact(std::span<const IndexType> states);
+
+  /// Set how the reference surfaces are stored, only possible while the
+  /// container has no track states
+  /// @param storage The reference surface storage policy
+  /// @param geometry The tracking geometry whose surfaces are referenced
+  ///        without ownership, required by
+  ///        @c ReferenceSurfaceStorage::NonOwningGeometry
+  void setReferenceSurfaceStorage(
+      ReferenceSurfaceStorage storage,
+      std::shared_ptr<const TrackingGeometry> geometry = nullptr);
+
+  using VectorMultiTrajectoryBase::dynamicColumn;
+
+  /// Resolve a dynamic column to its mutable values, indexed by track state
+  /// @note The span is invalidated when track states are added or removed
+  /// @tparam T The value type of the column
+  /// @param key The hashed column key
+  /// @return The column values
+  template <typename T>
+  std::span<T> dynamicColumn(HashedString key) {
+    return detail::dynamicColumnValues<T>(m_dynamic, key);
+  }
 };
 
 static_assert(
@@ -684,4 +827,8 @@ static_assert(
     ConstMultiTrajectoryBackend<ConstVectorMultiTrajectory>,
     "ConctVectorMultiTrajectory does not fulfill ConstMultiTrajectoryBackend");
 
+inline VectorMultiTrajectory::VectorMultiTrajectory(
+    ConstVectorMultiTrajectory&& other)
+    : VectorMultiTrajectoryBase{std::move(other)} {}
+
 }  // namespace Acts
@@ -11,6 +11,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/ReferenceSurfaceStorage.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/EventData/TrackContainerBackendConcept.hpp"
 #include "Acts/EventData/detail/DynamicColumn.hpp"
@@ -21,6 +22,7 @@
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -57,6 +59,16 @@ class VectorTrackContainerBase {
 
   VectorTrackContainerBase(VectorTrackContainerBase&& other) = default;
 
+  /// Copy the reference surface of a track of another container. The stored
+  /// pointer is copied as is if both containers reference the same tracking
+  /// geometry, so no ownership check is needed.
+  /// @param itrack The track to set the surface on
+  /// @param src The container to copy from
+  /// @param srcIdx The track to copy the surface of
+  void copyReferenceSurface(IndexType itrack,
+                            const VectorTrackContainerBase& src,
+                            IndexType srcIdx);
+
   // BEGIN INTERFACE HELPER
 
   /// @cond
@@ -164,6 +176,23 @@ class VectorTrackContainerBase {
     return m_referenceSurfaces[itrack].get();
   }
 
+  /// How the reference surfaces of the tracks are stored
+  ReferenceSurfaceStorage referenceSurfaceStorage() const noexcept {
+    return m_referenceSurfaceGeometry != nullptr
+               ? ReferenceSurfaceStorage::NonOwningGeometry
+               : ReferenceSurfaceStorage::Shared;
+  }
+
+  /// Resolve a dynamic column to its values, indexed by track
+  /// @note The span is invalidated when tracks are added or removed
+  /// @tparam T The value type of the column
+  /// @param key The hashed column key
+  /// @return The column values
+  template <typename T>
+  std::span<const T> dynamicColumn(HashedString key) const {
+    return detail::dynamicColumnValues<T>(m_dynamic, key);
+  }
+
   ParticleHypothesis particleHypothesis_impl(IndexType itrack) const {
     return m_particleHypothesis[itrack];
   }
@@ -189,6 +218,9 @@ class VectorTrackContainerBase {
   std::vector<typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
       m_cov;
   std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  /// Tracking geometry whose surfaces are referenced without ownership, if
+  /// any, kept alive by the container
+  std::shared_ptr<const TrackingGeometry> m_referenceSurfaceGeometry;
 
   std::vector<unsigned int> m_nMeasurements;
   std::vector<unsigned int> m_nHoles;
@@ -224,6 +256,10 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   /// @param other Const container to copy from
   explicit VectorTrackContainer(const ConstVectorTrackContainer& other);
 
+  /// Construct from const container, taking over its storage
+  /// @param other Const container to move from
+  explicit VectorTrackContainer(ConstVectorTrackContainer&& other);
+
  public:
   // BEGIN INTERFACE
   /// @cond
@@ -267,6 +303,12 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   void copyDynamicFrom_impl(IndexType dstIdx, HashedString key,
                             const std::any& srcPtr);
 
+  void copyReferenceSurfaceFrom_impl(
+      IndexType itrack, const detail_vtc::VectorTrackContainerBase& src,
+      IndexType srcIdx) {
+    copyReferenceSurface(itrack, src, srcIdx);
+  }
+
   void ensureDynamicColumns_impl(
       const detail_vtc::VectorTrackContainerBase& other);
 
@@ -275,7 +317,12 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   /// @param surface Reference surface to set
   void setReferenceSurface_impl(IndexType itrack,
                                 std::shared_ptr<const Surface> surface) {
-    m_referenceSurfaces[itrack] = std::move(surface);
+    if (m_referenceSurfaceGeometry == nullptr) {
+      m_referenceSurfaces[itrack] = std::move(surface);
+    } else {
+      m_referenceSurfaces[itrack] = detail::storedReferenceSurface(
+          std::move(surface), m_referenceSurfaceGeometry.get());
+    }
   }
 
   /// Set the particle hypothesis for a track
@@ -296,6 +343,28 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   /// Clear all tracks
   void clear();
 
+  /// Set how the reference surfaces are stored, only possible while the
+  /// container has no tracks
+  /// @param storage The reference surface storage policy
+  /// @param geometry The tracking geometry whose surfaces are referenced
+  ///        without ownership, required by
+  ///        @c ReferenceSurfaceStorage::NonOwningGeometry
+  void setReferenceSurfaceStorage(
+      ReferenceSurfaceStorage storage,
+      std::shared_ptr<const TrackingGeometry> geometry = nullptr);
+
+  using VectorTrackContainerBase::dynamicColumn;
+
+  /// Resolve a dynamic column to its mutable values, indexed by track
+  /// @note The span is invalidated when tracks are added or removed
+  /// @tparam T The value type of the column
+  /// @param key The hashed column key
+  /// @return The column values
+  template <typename T>
+  std::span<T> dynamicColumn(HashedString key) {
+    return detail::dynamicColumnValues<T>(m_dynamic, key);
+  }
+
   /// Get the number of tracks in the container
   /// @return Number of tracks
   std::size_t size() const;
@@ -373,4 +442,10 @@ inline VectorTrackContainer::VectorTrackContainer(
   assert(checkConsistency());
 }
 
+inline VectorTrackContainer::VectorTrackContainer(
+    ConstVectorTrackContainer&& other)
+    : VectorTrackContainerBase{std::move(other)} {
+  assert(checkConsistency());
+}
+
 }  // namespace Acts
@@ -8,13 +8,34 @@
 
 #pragma once
 
+#include "Acts/Utilities/HashedString.hpp"
+
 #include <any>
 #include <cassert>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace Acts::detail {
 
+/// Replace the content of a column by the given rows, in the given order
+/// @param column The column to rewrite
+/// @param rows The indices of the rows to keep
+template <typename vector_t>
+void gatherRows(vector_t& column, std::span<const std::uint32_t> rows) {
+  vector_t gathered(column.get_allocator());
+  gathered.reserve(rows.size());
+  for (std::uint32_t row : rows) {
+    assert(row < column.size() && "Row out of bounds");
+    gathered.push_back(std::move(column[row]));
+  }
+  column = std::move(gathered);
+}
+
 struct DynamicColumnBase {
   virtual ~DynamicColumnBase() = default;
 
@@ -25,17 +46,27 @@ struct DynamicColumnBase {
   virtual void clear() = 0;
   virtual void reserve(std::size_t size) = 0;
   virtual void erase(std::size_t i) = 0;
+  /// Keep only the given rows, in the given order
+  virtual void gather(std::span<const std::uint32_t> rows) = 0;
   virtual std::size_t size() const = 0;
   virtual void copyFrom(std::size_t dstIdx, const DynamicColumnBase& src,
                         std::size_t srcIdx) = 0;
   virtual void copyFrom(std::size_t dstIdx, const std::any& srcPtr) = 0;
 
+  /// Copy the column into storage allocated from a memory resource
+  /// @param empty Only copy the type, not the values
+  /// @param memoryResource The memory resource of the copy
   virtual std::unique_ptr<DynamicColumnBase> clone(
-      bool empty = false) const = 0;
+      bool empty = false, std::pmr::memory_resource* memoryResource =
+                              std::pmr::get_default_resource()) const = 0;
 };
 
 template <typename T>
 struct DynamicColumn : public DynamicColumnBase {
+  explicit DynamicColumn(std::pmr::memory_resource* memoryResource =
+                             std::pmr::get_default_resource())
+      : m_vector(memoryResource) {}
+
   std::any get(std::size_t i) override {
     assert(i < m_vector.size() && "DynamicColumn out of bounds");
     return &m_vector[i];
@@ -50,13 +81,18 @@ struct DynamicColumn : public DynamicColumnBase {
   void clear() override { m_vector.clear(); }
   void reserve(std::size_t size) override { m_vector.reserve(size); }
   void erase(std::size_t i) override { m_vector.erase(m_vector.begin() + i); }
+  void gather(std::span<const std::uint32_t> rows) override {
+    gatherRows(m_vector, rows);
+  }
   std::size_t size() const override { return m_vector.size(); }
 
-  std::unique_ptr<DynamicColumnBase> clone(bool empty) const override {
-    if (empty) {
-      return std::make_unique<DynamicColumn<T>>();
+  std::unique_ptr<DynamicColumnBase> clone(
+      bool empty, std::pmr::memory_resource* memoryResource) const override {
+    auto copy = std::make_unique<DynamicColumn<T>>(memoryResource);
+    if (!empty) {
+      copy->m_vector = m_vector;
     }
-    return std::make_unique<DynamicColumn<T>>(*this);
+    return copy;
   }
 
   void copyFrom(std::size_t dstIdx, const DynamicColumnBase& src,
@@ -74,7 +110,7 @@ struct DynamicColumn : public DynamicColumnBase {
     m_vector.at(dstIdx) = *other;
   }
 
-  std::vector<T> m_vector;
+  std::pmr::vector<T> m_vector;
 };
 
 template <>
@@ -83,6 +119,10 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     bool value;
   };
 
+  explicit DynamicColumn(std::pmr::memory_resource* memoryResource =
+                             std::pmr::get_default_resource())
+      : m_vector(memoryResource) {}
+
   std::any get(std::size_t i) override {
     assert(i < m_vector.size() && "DynamicColumn out of bounds");
     return &m_vector[i].value;
@@ -97,13 +137,18 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
   void reserve(std::size_t size) override { m_vector.reserve(size); }
   void clear() override { m_vector.clear(); }
   void erase(std::size_t i) override { m_vector.erase(m_vector.begin() + i); }
+  void gather(std::span<const std::uint32_t> rows) override {
+    gatherRows(m_vector, rows);
+  }
   std::size_t size() const override { return m_vector.size(); }
 
-  std::unique_ptr<DynamicColumnBase> clone(bool empty) const override {
-    if (empty) {
-      return std::make_unique<DynamicColumn<bool>>();
+  std::unique_ptr<DynamicColumnBase> clone(
+      bool empty, std::pmr::memory_resource* memoryResource) const override {
+    auto copy = std::make_unique<DynamicColumn<bool>>(memoryResource);
+    if (!empty) {
+      copy->m_vector = m_vector;
     }
-    return std::make_unique<DynamicColumn<bool>>(*this);
+    return copy;
   }
 
   void copyFrom(std::size_t dstIdx, const DynamicColumnBase& src,
@@ -121,7 +166,30 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     m_vector.at(dstIdx).value = *other;
   }
 
-  std::vector<Wrapper> m_vector;
+  std::pmr::vector<Wrapper> m_vector;
 };
 
+/// Resolve a dynamic column to its typed storage
+/// @tparam T The value type of the column
+/// @param columns The dynamic columns of a container
+/// @param key The hashed column key
+/// @return The column values, const if the columns are const
+template <typename T, typename columns_t>
+auto dynamicColumnValues(columns_t& columns, HashedString key) {
+  static_assert(!std::is_same_v<T, bool>,
+                "Boolean columns are not stored as contiguous values");
+  using column_t = std::conditional_t<std::is_const_v<columns_t>,
+                                      const DynamicColumn<T>, DynamicColumn<T>>;
+
+  auto it = columns.find(key);
+  if (it == columns.end()) {
+    throw std::invalid_argument{"Dynamic column does not exist"};
+  }
+  auto* column = dynamic_cast<column_t*>(it->second.get());
+  if (column == nullptr) {
+    throw std::invalid_argument{"Dynamic column has a different value type"};
+  }
+  return std::span{column->m_vector};
+}
+
 }  // namespace Acts::detail
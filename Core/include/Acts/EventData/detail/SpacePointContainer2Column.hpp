@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace Acts {
@@ -30,7 +31,8 @@ class ColumnHolderBase {
  public:
   virtual ~ColumnHolderBase() = default;
 
-  virtual std::unique_ptr<ColumnHolderBase> copy() const = 0;
+  virtual std::unique_ptr<ColumnHolderBase> copy(
+      std::pmr::memory_resource *memoryResource) const = 0;
 
   virtual std::size_t size() const = 0;
   virtual void reserve(std::size_t size) = 0;
@@ -45,13 +47,17 @@ template <typename T>
 class ColumnHolder final : public ColumnHolderBase {
  public:
   using Value = T;
-  using Container = std::vector<Value>;
+  using Container = std::pmr::vector<Value>;
   using MutableProxy = MutableSpacePointColumnProxy<Value>;
   using ConstProxy = ConstSpacePointColumnProxy<Value>;
 
-  ColumnHolder() = default;
-  explicit ColumnHolder(Value defaultValue)
-      : m_default(std::move(defaultValue)) {}
+  explicit ColumnHolder(std::pmr::memory_resource *memoryResource)
+      : m_data(memoryResource) {}
+  ColumnHolder(Value defaultValue, std::pmr::memory_resource *memoryResource)
+      : m_default(std::move(defaultValue)), m_data(memoryResource) {}
+  ColumnHolder(const ColumnHolder &other,
+               std::pmr::memory_resource *memoryResource)
+      : m_default(other.m_default), m_data(other.m_data, memoryResource) {}
 
   MutableProxy proxy(SpacePointContainer2 &container) {
     return MutableProxy(container, m_data);
@@ -60,8 +66,9 @@ class ColumnHolder final : public ColumnHolderBase {
     return ConstProxy(container, m_data);
   }
 
-  std::unique_ptr<ColumnHolderBase> copy() const override {
-    return std::make_unique<ColumnHolder<T>>(*this);
+  std::unique_ptr<ColumnHolderBase> copy(
+      std::pmr::memory_resource *memoryResource) const override {
+    return std::make_unique<ColumnHolder<T>>(*this, memoryResource);
   }
 
   std::size_t size() const override { return m_data.size(); }
@@ -168,6 +168,11 @@ class TrackingVolume : public Volume {
   /// @param position is the global position associated with that search
   /// @param tol Search position tolerance for dense volumes
   ///
+  /// @note Child volumes are looked up through an r/z search grid once the
+  ///       volume is part of a @c TrackingGeometry. The grid holds the
+  ///       nominal placement of the child volumes at that point, changes of
+  ///       their bounds or transforms afterwards are not picked up.
+  ///
   /// @return plain pointer to associated with the position
   const TrackingVolume* lowestTrackingVolume(const GeometryContext& gctx,
                                              const Vector3& position,
@@ -563,6 +568,14 @@ class TrackingVolume : public Volume {
   /// Create Boundary Surface
   void createBoundarySurfaces();
 
+  /// Build the search grids over the child volumes of this volume and all
+  /// its descendants, which accelerate @ref lowestTrackingVolume
+  /// @note The grids are built from the nominal geometry and are only
+  ///       dropped by @ref addVolume. Volumes with alignable children keep
+  ///       the linear search, as their placement depends on the context.
+  ///       Bounds and transforms must not change once the grids are built.
+  void buildVolumeSearchGrids();
+
   /// method to synchronize the layers with potentially updated volume bounds:
   /// - adapts the layer dimensions to the new volumebounds + envelope
   ///
@@ -598,6 +611,10 @@ class TrackingVolume : public Volume {
 
   std::vector<std::unique_ptr<TrackingVolume>> m_volumes;
   std::vector<std::shared_ptr<Portal>> m_portals;
+
+  /// Lookup of the child volumes in r and z
+  struct VolumeSearchGrid;
+  std::unique_ptr<const VolumeSearchGrid> m_volumeSearchGrid;
   std::vector<std::shared_ptr<Surface>> m_surfaces;
 
   std::unique_ptr<INavigationPolicy> m_navigationPolicy;
@@ -12,15 +12,39 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldError.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Utilities/Axis.hpp"
+#include "Acts/Utilities/AxisDefinitions.hpp"
+#include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <functional>
 #include <optional>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace Acts {
 
+namespace detail {
+
+/// Checks whether all axes of a grid are open equidistant axes
+template <typename grid_t>
+struct IsOpenEquidistantGrid : std::false_type {};
+
+template <typename T, class... Axes>
+struct IsOpenEquidistantGrid<Grid<T, Axes...>>
+    : std::bool_constant<(
+          std::is_same_v<Axes, Axis<AxisType::Equidistant,
+                                    AxisBoundaryType::Open>> &&
+          ...)> {};
+
+}  // namespace detail
+
 /// @addtogroup magnetic_field
 /// @{
 
@@ -98,6 +122,10 @@ class InterpolatedMagneticField : public MagneticFieldProvider {
 /// and @ref Acts::fieldMapXYZ are provided to construct field maps with the
 /// appropriate symmetries.
 ///
+/// Grids with only open equidistant axes, as created by these helpers, use a
+/// direct bin lookup with precomputed inverse bin widths instead of the
+/// generic grid lookup.
+///
 /// @tparam grid_t The Grid type which provides the field storage and
 /// interpolation
 template <typename grid_t>
@@ -109,6 +137,9 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   using FieldType = typename Grid::value_type;
   /// Dimensionality of the position space for field interpolation
   static constexpr std::size_t DIM_POS = Grid::DIM;
+  /// Whether the bins are found directly from the inverse bin widths
+  static constexpr bool s_equidistant =
+      detail::IsOpenEquidistantGrid<Grid>::value;
 
   /// @brief struct representing smallest grid unit in magnetic field grid
   ///
@@ -225,6 +256,27 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     minBin.fill(1);
     m_lowerLeft = m_cfg.grid.lowerLeftBinEdge(minBin);
     m_upperRight = m_cfg.grid.lowerLeftBinEdge(m_cfg.grid.numLocalBins());
+
+    if constexpr (s_equidistant) {
+      m_nBins = m_cfg.grid.numLocalBins();
+      m_binWidth = m_cfg.grid.binWidth();
+      // the global bin index runs fastest along the last axis and includes
+      // the under- and overflow bins
+      std::size_t stride = 1;
+      for (std::size_t i = DIM_POS; i-- > 0;) {
+        m_invBinWidth[i] = 1. / m_binWidth[i];
+        m_strides[i] = stride;
+        stride *= m_nBins[i] + 2;
+      }
+      for (std::size_t corner = 0; corner < FieldCell::N; ++corner) {
+        m_cornerOffsets[corner] = 0;
+        for (std::size_t i = 0; i < DIM_POS; ++i) {
+          if ((corner >> (DIM_POS - 1 - i)) & 1u) {
+            m_cornerOffsets[corner] += m_strides[i];
+          }
+        }
+      }
+    }
   }
 
   /// @brief retrieve field cell for given position
@@ -236,6 +288,26 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   ///      magnetic field map.
   Result<FieldCell> getFieldCell(const Vector3& position) const {
     const auto& gridPosition = m_cfg.transformPos(position);
+    if constexpr (s_equidistant) {
+      if (!isInsideLocal(gridPosition)) {
+        return MagneticFieldError::OutOfBounds;
+      }
+      const auto indices = equidistantLocalBins(gridPosition);
+      const std::size_t globalBin = equidistantGlobalBin(indices);
+      std::array<double, DIM_POS> lowerLeft{};
+      std::array<double, DIM_POS> upperRight{};
+      for (std::size_t i = 0; i < DIM_POS; ++i) {
+        lowerLeft[i] = lowerBinEdge(i, indices[i]);
+        upperRight[i] = lowerBinEdge(i, indices[i] + 1);
+      }
+      std::array<Vector3, FieldCell::N> neighbors{};
+      for (std::size_t i = 0; i < FieldCell::N; ++i) {
+        neighbors[i] = m_cfg.transformBField(
+            m_cfg.grid.at(globalBin + m_cornerOffsets[i]), position);
+      }
+      return FieldCell(lowerLeft, upperRight, std::move(neighbors));
+    }
+
     const auto& indices = m_cfg.grid.localBinsFromPosition(gridPosition);
     const auto& lowerLeft = m_cfg.grid.lowerLeftBinEdge(indices);
     const auto& upperRight = m_cfg.grid.upperRightBinEdge(indices);
@@ -330,7 +402,7 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     }
 
     return Result<Vector3>::success(
-        m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition), position));
+        m_cfg.transformBField(interpolateLocal(gridPosition), position));
   }
 
   /// Get magnetic field value without bounds checking (faster).
@@ -342,8 +414,7 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   ///          the position is within the valid range of the field map.
   Vector3 getFieldUnchecked(const Vector3& position) const final {
     const auto gridPosition = m_cfg.transformPos(position);
-    return m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition),
-                                 position);
+    return m_cfg.transformBField(interpolateLocal(gridPosition), position);
   }
 
   /// @copydoc MagneticFieldProvider::getField(const Vector3&,MagneticFieldProvider::Cache&) const
@@ -361,11 +432,105 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     return Result<Vector3>::success((*lcache.fieldCell).getField(gridPosition));
   }
 
+  /// @copydoc MagneticFieldProvider::getFields(std::span<const Vector3>,std::span<Vector3>,MagneticFieldProvider::Cache&) const
+  ///
+  /// @note The positions of a batch usually belong to unrelated tracks and
+  ///       would evict each other from the cached field cell. Each field is
+  ///       therefore interpolated directly from the grid, which also avoids
+  ///       reusing a cell whose corner fields were transformed for a
+  ///       different position.
+  Result<void> getFields(std::span<const Vector3> positions,
+                         std::span<Vector3> fields,
+                         MagneticFieldProvider::Cache& cache) const final {
+    static_cast<void>(cache);
+    assert(positions.size() == fields.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      const auto gridPosition = m_cfg.transformPos(positions[i]);
+      if (!isInsideLocal(gridPosition)) {
+        return MagneticFieldError::OutOfBounds;
+      }
+      fields[i] =
+          m_cfg.transformBField(interpolateLocal(gridPosition), positions[i]);
+    }
+    return Result<void>::success();
+  }
+
  private:
+  /// Interpolates the grid values at a position in grid coordinates
+  FieldType interpolateLocal(const Vector<DIM_POS>& gridPosition) const {
+    if constexpr (s_equidistant) {
+      const auto indices = equidistantLocalBins(gridPosition);
+      const std::size_t globalBin = equidistantGlobalBin(indices);
+      std::array<double, DIM_POS> lowerLeft{};
+      std::array<double, DIM_POS> upperRight{};
+      for (std::size_t i = 0; i < DIM_POS; ++i) {
+        lowerLeft[i] = lowerBinEdge(i, indices[i]);
+        upperRight[i] = lowerBinEdge(i, indices[i] + 1);
+      }
+      std::array<FieldType, FieldCell::N> neighbors{};
+      for (std::size_t i = 0; i < FieldCell::N; ++i) {
+        neighbors[i] = m_cfg.grid.at(globalBin + m_cornerOffsets[i]);
+      }
+      return interpolate(gridPosition, lowerLeft, upperRight, neighbors);
+    } else {
+      return m_cfg.grid.interpolate(gridPosition);
+    }
+  }
+
+  /// Lower edge of a bin of an equidistant axis, computed like the axis
+  double lowerBinEdge(std::size_t axis, std::size_t bin) const {
+    return m_lowerLeft[axis] + (bin - 1) * m_binWidth[axis];
+  }
+
+  /// Local bins of the cell containing @p gridPosition on an equidistant grid
+  ///
+  /// Positions outside of the grid are assigned to the closest cell.
+  typename Grid::index_t equidistantLocalBins(
+      const Vector<DIM_POS>& gridPosition) const {
+    typename Grid::index_t indices{};
+    for (std::size_t i = 0; i < DIM_POS; ++i) {
+      const double x = gridPosition[i];
+      const double u = (x - m_lowerLeft[i]) * m_invBinWidth[i];
+      std::size_t bin =
+          u > 0 ? std::min(static_cast<std::size_t>(u), m_nBins[i] - 1) : 0;
+      // the product with the inverse width can be off by one bin close to the
+      // bin edges, the edges themselves are computed like the axis does
+      if (bin > 0 && x < lowerBinEdge(i, bin + 1)) {
+        --bin;
+      } else if (bin + 1 < m_nBins[i] && x >= lowerBinEdge(i, bin + 2)) {
+        ++bin;
+      }
+      indices[i] = bin + 1;
+    }
+    return indices;
+  }
+
+  /// Global bin of the local bins of an equidistant grid
+  std::size_t equidistantGlobalBin(
+      const typename Grid::index_t& indices) const {
+    std::size_t bin = 0;
+    for (std::size_t i = 0; i < DIM_POS; ++i) {
+      bin += indices[i] * m_strides[i];
+    }
+    return bin;
+  }
+
   Config m_cfg;
 
   typename Grid::point_t m_lowerLeft;
   typename Grid::point_t m_upperRight;
+
+  /// Number of bins along each axis of an equidistant grid
+  typename Grid::index_t m_nBins{};
+  /// Bin widths of an equidistant grid
+  typename Grid::point_t m_binWidth{};
+  /// Inverse bin widths of an equidistant grid
+  typename Grid::point_t m_invBinWidth{};
+  /// Global bin offsets of a step along each axis of an equidistant grid
+  typename Grid::index_t m_strides{};
+  /// Global bin offsets of the cell corners relative to the lower-left corner
+  /// in the canonical order defined in Acts::interpolate
+  std::array<std::size_t, FieldCell::N> m_cornerOffsets{};
 };
 
 /// @}
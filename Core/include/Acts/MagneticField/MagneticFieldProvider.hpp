@@ -13,6 +13,9 @@
 #include "Acts/Utilities/Any.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cassert>
+#include <span>
+
 namespace Acts {
 
 /// Base class for all magnetic field providers
@@ -88,6 +91,31 @@ class MagneticFieldProvider {
   virtual Result<Vector3> getField(const Vector3& position,
                                    Cache& cache) const = 0;
 
+  /// Retrieve magnetic field values at several locations with a single call.
+  /// Implementations can override this to share work between the lookups,
+  /// the default implementation calls @ref getField for each position.
+  ///
+  /// @param [in] positions global 3D positions for the lookups
+  /// @param [out] fields magnetic field vectors at the given positions, must
+  ///              have the same size as @p positions
+  /// @param [in,out] cache Field provider specific cache object
+  ///
+  /// @return an error if any of the lookups fails, the content of @p fields
+  ///         is unspecified in that case
+  virtual Result<void> getFields(std::span<const Vector3> positions,
+                                 std::span<Vector3> fields,
+                                 Cache& cache) const {
+    assert(positions.size() == fields.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      Result<Vector3> field = getField(positions[i], cache);
+      if (!field.ok()) {
+        return field.error();
+      }
+      fields[i] = *field;
+    }
+    return Result<void>::success();
+  }
+
   virtual ~MagneticFieldProvider() = default;
 };
 
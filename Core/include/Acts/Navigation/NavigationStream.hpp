@@ -15,6 +15,7 @@
 #include "Acts/Geometry/Portal.hpp"
 #include "Acts/Propagator/NavigationTarget.hpp"
 #include "Acts/Surfaces/BoundaryTolerance.hpp"
+#include "Acts/Surfaces/SurfaceIntersectionBatch.hpp"
 
 #include <span>
 #include <vector>
@@ -119,6 +120,11 @@ class NavigationStream {
   /// This will allow intializeStream() to be called even as a re-initialization
   /// and still work correctly with at one time valid candidates.
   ///
+  /// The path lengths to all candidates are estimated in one batch first, and
+  /// candidates which are only crossed behind the query point are discarded
+  /// without the full intersection and boundary check. Plane candidates in
+  /// front of it reuse the estimate and only need the boundary check.
+  ///
   /// @return true if the stream is active, false indicates that there are no valid candidates
   bool initialize(const GeometryContext& gctx,
                   const NavigationStream::QueryPoint& queryPoint,
@@ -150,6 +156,9 @@ class NavigationStream {
 
   /// The currently active candidate
   std::size_t m_currentIndex = 0u;
+
+  /// Batch for the path length estimates, reused between initializations
+  SurfaceIntersectionBatch m_intersectionBatch;
 };
 
 /// Append-only helper to add candidates to a navigation stream.
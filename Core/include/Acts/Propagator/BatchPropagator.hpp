@@ -0,0 +1,182 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/PropagatorOptions.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+/// Result of a single track of a batched propagation
+struct BatchPropagatorResult {
+  /// Parameters on the target surface, or curvilinear parameters if no target
+  /// was given. Covariances are not transported.
+  BoundTrackParameters endParameters;
+  /// Signed path length of the propagation
+  double pathLength = 0;
+  /// Number of successful steps
+  unsigned int steps = 0;
+};
+
+/// Propagates many tracks by advancing several of them in lockstep.
+///
+/// Up to @p kLanes tracks are held in structure-of-arrays lanes and stepped
+/// together, so that the Runge-Kutta-Nyström arithmetic of all lanes
+/// vectorizes. The field values needed by a step are requested for all lanes
+/// with a single @ref MagneticFieldProvider::getFields call. A lane which
+/// reaches its target or fails is masked out of the following steps and
+/// refilled with the next pending track.
+///
+/// Each lane follows the step size control of the @ref EigenStepper together
+/// with the @ref SurfaceReached and @ref PathLimitReached aborters. There is
+/// no navigation, no material interaction and no covariance transport. Without
+/// a magnetic field the tracks follow straight lines.
+///
+/// @tparam kLanes Number of tracks which are stepped together
+template <std::size_t kLanes = 4>
+class BatchPropagator {
+  static_assert(kLanes > 0, "BatchPropagator needs at least one lane");
+
+ public:
+  /// Number of tracks which are stepped together
+  static constexpr std::size_t s_lanes = kLanes;
+
+  /// Type alias for the propagation options
+  using Options = PropagatorPlainOptions;
+
+  /// Configuration of the batch propagator
+  struct Config {
+    /// Magnetic field provider, straight lines are used if not set
+    std::shared_ptr<const MagneticFieldProvider> bField;
+  };
+
+  /// Constructor from configuration
+  /// @param config The configuration
+  /// @param _logger a logger instance
+  explicit BatchPropagator(Config config,
+                           std::shared_ptr<const Logger> _logger =
+                               getDefaultLogger("BatchPropagator",
+                                                Logging::INFO))
+      : m_cfg{std::move(config)}, m_logger{std::move(_logger)} {}
+
+  /// Propagates each track to its own target surface.
+  ///
+  /// @param start The start parameters of the tracks
+  /// @param targets The target surface of each track, a null pointer
+  ///        propagates the track to the path limit
+  /// @param options The propagation options, shared by all tracks
+  ///
+  /// @return One result per track in the order of @p start
+  std::vector<Result<BatchPropagatorResult>> propagate(
+      std::span<const BoundTrackParameters> start,
+      std::span<const Surface* const> targets, const Options& options) const;
+
+  /// Propagates all tracks to the path limit.
+  ///
+  /// @param start The start parameters of the tracks
+  /// @param options The propagation options, shared by all tracks
+  ///
+  /// @return One result per track in the order of @p start
+  std::vector<Result<BatchPropagatorResult>> propagate(
+      std::span<const BoundTrackParameters> start,
+      const Options& options) const;
+
+ private:
+  using Lanes = Eigen::Array<double, kLanes, 1>;
+  using LaneMask = Eigen::Array<bool, kLanes, 1>;
+
+  /// A 3D vector for each lane
+  struct LaneVector3 {
+    Lanes x = Lanes::Zero();
+    Lanes y = Lanes::Zero();
+    Lanes z = Lanes::Zero();
+  };
+
+  /// State of the tracks which are currently stepped
+  struct Batch {
+    LaneVector3 position;
+    LaneVector3 direction;
+    Lanes time = Lanes::Zero();
+    Lanes qOverP = Lanes::Zero();
+    /// Time derivative along the path, given by the particle mass
+    Lanes dtds = Lanes::Zero();
+
+    /// Lanes which hold a track that is still propagated
+    LaneMask active = LaneMask::Constant(false);
+    std::array<std::size_t, kLanes> track{};
+    std::array<ConstrainedStep, kLanes> stepSize{};
+    std::array<double, kLanes> pathLength{};
+    std::array<double, kLanes> pathLimit{};
+    std::array<unsigned int, kLanes> steps{};
+    std::array<std::optional<ParticleHypothesis>, kLanes> particleHypothesis;
+  };
+
+  /// Propagation of all tracks, @p targets is empty or has one entry per
+  /// track
+  std::vector<Result<BatchPropagatorResult>> propagateImpl(
+      std::span<const BoundTrackParameters> start,
+      std::span<const Surface* const> targets, const Options& options) const;
+
+  /// Moves the next pending track into a lane
+  void loadLane(Batch& batch, std::size_t lane, std::size_t track,
+                const BoundTrackParameters& start, const Options& options,
+                MagneticFieldProvider::Cache* fieldCache) const;
+
+  /// Checks the abort conditions of a lane and updates its step size
+  ///
+  /// @return the result of the track if the propagation of the lane is
+  ///         finished
+  std::optional<Result<BatchPropagatorResult>> checkLane(
+      Batch& batch, std::size_t lane, const Surface* target,
+      const Options& options) const;
+
+  /// Performs a Runge-Kutta-Nyström step for all active lanes
+  ///
+  /// @return the errors of lanes which could not be stepped
+  std::array<std::optional<std::error_code>, kLanes> stepRungeKutta(
+      Batch& batch, const Options& options,
+      MagneticFieldProvider::Cache& fieldCache) const;
+
+  /// Performs a straight line step for all active lanes
+  void stepStraightLine(Batch& batch, const Options& options) const;
+
+  /// Looks up the field at the positions of the lanes in @p mask
+  ///
+  /// Lanes whose lookup fails are removed from @p mask and get their error
+  /// set in @p errors.
+  LaneVector3 getFields(
+      const LaneVector3& position, LaneMask& mask,
+      MagneticFieldProvider::Cache& fieldCache,
+      std::array<std::optional<std::error_code>, kLanes>& errors) const;
+
+  Config m_cfg;
+
+  std::shared_ptr<const Logger> m_logger;
+
+  const Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/BatchPropagator.ipp"
@@ -0,0 +1,507 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/BatchPropagator.hpp"
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TransformationHelpers.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Surfaces/BoundaryTolerance.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+namespace Acts::detail {
+
+/// Lane wise vector operations of the batch propagator
+template <typename lane_vector_t, typename lanes_t>
+lane_vector_t laneAxpy(const lanes_t& a, const lane_vector_t& x,
+                       const lane_vector_t& y) {
+  return {a * x.x + y.x, a * x.y + y.y, a * x.z + y.z};
+}
+
+template <typename lane_vector_t, typename lanes_t>
+lane_vector_t laneScale(const lanes_t& a, const lane_vector_t& x) {
+  return {a * x.x, a * x.y, a * x.z};
+}
+
+template <typename lane_vector_t>
+lane_vector_t laneCross(const lane_vector_t& a, const lane_vector_t& b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+
+template <typename lane_vector_t, typename lane_mask_t>
+void laneAssign(const lane_mask_t& mask, const lane_vector_t& from,
+                lane_vector_t& to) {
+  to.x = mask.select(from.x, to.x);
+  to.y = mask.select(from.y, to.y);
+  to.z = mask.select(from.z, to.z);
+}
+
+}  // namespace Acts::detail
+
+template <std::size_t kLanes>
+auto Acts::BatchPropagator<kLanes>::propagate(
+    std::span<const BoundTrackParameters> start,
+    std::span<const Surface* const> targets, const Options& options) const
+    -> std::vector<Result<BatchPropagatorResult>> {
+  if (targets.size() != start.size()) {
+    throw std::invalid_argument(
+        "BatchPropagator: number of targets does not match the number of "
+        "tracks");
+  }
+  return propagateImpl(start, targets, options);
+}
+
+template <std::size_t kLanes>
+auto Acts::BatchPropagator<kLanes>::propagate(
+    std::span<const BoundTrackParameters> start, const Options& options) const
+    -> std::vector<Result<BatchPropagatorResult>> {
+  return propagateImpl(start, {}, options);
+}
+
+template <std::size_t kLanes>
+auto Acts::BatchPropagator<kLanes>::propagateImpl(
+    std::span<const BoundTrackParameters> start,
+    std::span<const Surface* const> targets, const Options& options) const
+    -> std::vector<Result<BatchPropagatorResult>> {
+  std::vector<Result<BatchPropagatorResult>> results;
+  results.reserve(start.size());
+  for (std::size_t i = 0; i < start.size(); ++i) {
+    results.push_back(
+        Result<BatchPropagatorResult>::failure(PropagatorError::Failure));
+  }
+
+  std::optional<MagneticFieldProvider::Cache> fieldCache;
+  if (m_cfg.bField != nullptr) {
+    fieldCache.emplace(m_cfg.bField->makeCache(options.magFieldContext));
+  }
+
+  Batch batch;
+  std::size_t nextTrack = 0;
+
+  // Checks a lane before the next step. Finished tracks are replaced by the
+  // next pending track until the lane needs a step or no track is left.
+  auto prepareLane = [&](std::size_t lane) {
+    while (true) {
+      if (!batch.active[lane]) {
+        if (nextTrack == start.size()) {
+          return;
+        }
+        loadLane(batch, lane, nextTrack, start[nextTrack], options,
+                 fieldCache.has_value() ? &*fieldCache : nullptr);
+        ++nextTrack;
+      }
+
+      const std::size_t track = batch.track[lane];
+      const Surface* target = targets.empty() ? nullptr : targets[track];
+      auto result = checkLane(batch, lane, target, options);
+      if (!result.has_value()) {
+        return;
+      }
+      results[track] = std::move(*result);
+      batch.active[lane] = false;
+    }
+  };
+
+  while (true) {
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      prepareLane(lane);
+    }
+    if (!batch.active.any()) {
+      break;
+    }
+
+    if (!fieldCache.has_value()) {
+      stepStraightLine(batch, options);
+      continue;
+    }
+
+    const auto errors = stepRungeKutta(batch, options, *fieldCache);
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      if (errors[lane].has_value()) {
+        ACTS_DEBUG("Propagation of track " << batch.track[lane]
+                                           << " failed: " << *errors[lane]
+                                           << ": " << errors[lane]->message());
+        results[batch.track[lane]] = *errors[lane];
+        batch.active[lane] = false;
+      }
+    }
+  }
+
+  return results;
+}
+
+template <std::size_t kLanes>
+void Acts::BatchPropagator<kLanes>::loadLane(
+    Batch& batch, std::size_t lane, std::size_t track,
+    const BoundTrackParameters& start, const Options& options,
+    MagneticFieldProvider::Cache* fieldCache) const {
+  const FreeVector pars = transformBoundToFreeParameters(
+      start.referenceSurface(), options.geoContext, start.parameters());
+  const ParticleHypothesis& particleHypothesis = start.particleHypothesis();
+  const double absoluteMomentum =
+      particleHypothesis.extractMomentum(pars[eFreeQOverP]);
+  const double mass = particleHypothesis.mass();
+
+  batch.position.x[lane] = pars[eFreePos0];
+  batch.position.y[lane] = pars[eFreePos1];
+  batch.position.z[lane] = pars[eFreePos2];
+  batch.time[lane] = pars[eFreeTime];
+  batch.direction.x[lane] = pars[eFreeDir0];
+  batch.direction.y[lane] = pars[eFreeDir1];
+  batch.direction.z[lane] = pars[eFreeDir2];
+  batch.qOverP[lane] = pars[eFreeQOverP];
+  batch.dtds[lane] = std::sqrt(1 + mass * mass /
+                                       (absoluteMomentum * absoluteMomentum));
+
+  batch.active[lane] = true;
+  batch.track[lane] = track;
+  batch.pathLength[lane] = 0;
+  batch.steps[lane] = 0;
+  batch.particleHypothesis[lane] = particleHypothesis;
+
+  // same initial step size as the EigenStepper and the StraightLineStepper
+  ConstrainedStep& stepSize = batch.stepSize[lane];
+  stepSize = ConstrainedStep();
+  if (fieldCache != nullptr) {
+    stepSize.setAccuracy(options.stepping.initialStepSize);
+  }
+  stepSize.setUser(options.stepping.maxStepSize);
+
+  // same as the loop protection of the Propagator
+  double& pathLimit = batch.pathLimit[lane];
+  pathLimit = options.pathLimit;
+  if (fieldCache == nullptr || !options.loopProtection) {
+    return;
+  }
+  const Result<Vector3> field = m_cfg.bField->getField(
+      pars.template segment<3>(eFreePos0), *fieldCache);
+  if (!field.ok()) {
+    ACTS_WARNING("Field lookup was unsuccessful, this is very likely an error");
+    return;
+  }
+  const double b = field->norm();
+  if (b == 0) {
+    return;
+  }
+  const double helixPath =
+      options.direction * 2 * std::numbers::pi * absoluteMomentum / b;
+  const double loopLimit = options.loopFraction * helixPath;
+  if (std::abs(loopLimit) < std::abs(pathLimit)) {
+    pathLimit = loopLimit;
+    ACTS_VERBOSE("Path limit of track " << track << " set to " << loopLimit
+                                        << " (full helix = " << helixPath
+                                        << ")");
+  }
+}
+
+template <std::size_t kLanes>
+auto Acts::BatchPropagator<kLanes>::checkLane(Batch& batch, std::size_t lane,
+                                              const Surface* target,
+                                              const Options& options) const
+    -> std::optional<Result<BatchPropagatorResult>> {
+  const GeometryContext& gctx = options.geoContext;
+  const double tolerance = options.surfaceTolerance;
+  const Vector3 position(batch.position.x[lane], batch.position.y[lane],
+                         batch.position.z[lane]);
+  const Vector3 direction(batch.direction.x[lane], batch.direction.y[lane],
+                          batch.direction.z[lane]);
+
+  ConstrainedStep& stepSize = batch.stepSize[lane];
+  stepSize.release(ConstrainedStep::Type::Actor);
+
+  // same as the SurfaceReached aborter
+  bool reached = false;
+  if (target != nullptr) {
+    const MultiIntersection3D multiIntersection =
+        target->intersect(gctx, position, options.direction * direction,
+                          BoundaryTolerance::None(), tolerance);
+    reached = multiIntersection.closest().status() ==
+              IntersectionStatus::onSurface;
+
+    const double nearLimit = SurfaceReached().nearLimit;
+    const double farLimit = std::numeric_limits<double>::max();
+    for (const Intersection3D& intersection : multiIntersection) {
+      if (intersection.isValid() &&
+          detail::checkPathLength(intersection.pathLength(), nearLimit,
+                                  farLimit, logger())) {
+        stepSize.update(intersection.pathLength(),
+                        ConstrainedStep::Type::Actor);
+        break;
+      }
+    }
+  }
+
+  // same as the PathLimitReached aborter
+  if (!reached) {
+    const double distance = std::abs(batch.pathLimit[lane]) -
+                            std::abs(batch.pathLength[lane]);
+    reached = std::abs(distance) < std::abs(tolerance);
+    if (!reached) {
+      stepSize.update(distance, ConstrainedStep::Type::Actor);
+    }
+  }
+
+  if (!reached) {
+    if (batch.steps[lane] >= options.maxSteps) {
+      ACTS_DEBUG("Track " << batch.track[lane]
+                          << " reached the step count limit");
+      return Result<BatchPropagatorResult>::failure(
+          PropagatorError::StepCountLimitReached);
+    }
+    return std::nullopt;
+  }
+
+  ACTS_VERBOSE("Track " << batch.track[lane] << " finished after "
+                        << batch.steps[lane] << " steps");
+
+  const ParticleHypothesis& particleHypothesis =
+      *batch.particleHypothesis[lane];
+  std::optional<BoundTrackParameters> endParameters;
+  if (target != nullptr) {
+    FreeVector pars;
+    pars.template segment<3>(eFreePos0) = position;
+    pars[eFreeTime] = batch.time[lane];
+    pars.template segment<3>(eFreeDir0) = direction;
+    pars[eFreeQOverP] = batch.qOverP[lane];
+    Result<BoundVector> boundPars =
+        transformFreeToBoundParameters(pars, *target, gctx);
+    if (!boundPars.ok()) {
+      return Result<BatchPropagatorResult>::failure(boundPars.error());
+    }
+    endParameters.emplace(target->getSharedPtr(), *boundPars, std::nullopt,
+                          particleHypothesis);
+  } else {
+    endParameters = BoundTrackParameters::createCurvilinear(
+        VectorHelpers::makeVector4(position, batch.time[lane]), direction,
+        batch.qOverP[lane], std::nullopt, particleHypothesis);
+  }
+
+  return Result<BatchPropagatorResult>::success(
+      {std::move(*endParameters), batch.pathLength[lane], batch.steps[lane]});
+}
+
+template <std::size_t kLanes>
+auto Acts::BatchPropagator<kLanes>::getFields(
+    const LaneVector3& position, LaneMask& mask,
+    MagneticFieldProvider::Cache& fieldCache,
+    std::array<std::optional<std::error_code>, kLanes>& errors) const
+    -> LaneVector3 {
+  // gather the lanes which need a field value
+  std::array<Vector3, kLanes> positions;
+  std::array<Vector3, kLanes> fields;
+  std::array<std::size_t, kLanes> lanes{};
+  std::size_t n = 0;
+  for (std::size_t lane = 0; lane < kLanes; ++lane) {
+    if (mask[lane]) {
+      positions[n] = Vector3(position.x[lane], position.y[lane],
+                             position.z[lane]);
+      lanes[n] = lane;
+      ++n;
+    }
+  }
+
+  LaneVector3 field;
+  if (n == 0) {
+    return field;
+  }
+
+  const std::span<const Vector3> lookups(positions.data(), n);
+  const std::span<Vector3> values(fields.data(), n);
+  if (!m_cfg.bField->getFields(lookups, values, fieldCache).ok()) {
+    // repeat the lookups one by one to find the failing lanes
+    for (std::size_t i = 0; i < n; ++i) {
+      const Result<Vector3> single =
+          m_cfg.bField->getField(positions[i], fieldCache);
+      if (single.ok()) {
+        fields[i] = *single;
+      } else {
+        fields[i] = Vector3::Zero();
+        errors[lanes[i]] = single.error();
+        mask[lanes[i]] = false;
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < n; ++i) {
+    field.x[lanes[i]] = fields[i].x();
+    field.y[lanes[i]] = fields[i].y();
+    field.z[lanes[i]] = fields[i].z();
+  }
+  return field;
+}
+
+template <std::size_t kLanes>
+auto Acts::BatchPropagator<kLanes>::stepRungeKutta(
+    Batch& batch, const Options& options,
+    MagneticFieldProvider::Cache& fieldCache) const
+    -> std::array<std::optional<std::error_code>, kLanes> {
+  // Runge-Kutta-Nyström integration as in EigenStepper::step with the
+  // default extension, evaluated for all lanes at once
+  std::array<std::optional<std::error_code>, kLanes> errors;
+  const StepperPlainOptions& stepping = options.stepping;
+
+  const LaneVector3& pos = batch.position;
+  const LaneVector3& dir = batch.direction;
+  const Lanes& qop = batch.qOverP;
+
+  LaneMask active = batch.active;
+  Lanes h = Lanes::Zero();
+  for (std::size_t lane = 0; lane < kLanes; ++lane) {
+    if (active[lane]) {
+      h[lane] = batch.stepSize[lane].value() * options.direction;
+    }
+  }
+  const Lanes initialH = h;
+
+  // First Runge-Kutta point (at current position)
+  const LaneVector3 bFirst = getFields(pos, active, fieldCache, errors);
+  const LaneVector3 k1 = detail::laneScale(qop, detail::laneCross(dir, bFirst));
+
+  const auto calcStepSizeScaling = [&](const Lanes& errorEstimate) -> Lanes {
+    // For details about these values see ATL-SOFT-PUB-2009-001
+    const Lanes x = (stepping.stepTolerance / errorEstimate).sqrt().sqrt();
+    return x.max(0.25).min(4.0);
+  };
+
+  LaneVector3 k2;
+  LaneVector3 k3;
+  LaneVector3 k4;
+  Lanes errorEstimate = Lanes::Constant(1e-20);
+  Lanes h2 = Lanes::Zero();
+
+  // Select and adjust the step size of all lanes until every lane has a
+  // tolerable error estimate, lanes which already succeeded ride along
+  LaneMask trying = active;
+  std::array<std::size_t, kLanes> nStepTrials{};
+  while (trying.any()) {
+    h2 = h * h;
+    const Lanes halfH = h * 0.5;
+
+    // Second Runge-Kutta point
+    const LaneVector3 pos1 = detail::laneAxpy(
+        Lanes(h2 * 0.125), k1, detail::laneAxpy(halfH, dir, pos));
+    const LaneVector3 bMiddle = getFields(pos1, trying, fieldCache, errors);
+    const LaneVector3 t2 = detail::laneScale(
+        qop, detail::laneCross(detail::laneAxpy(halfH, k1, dir), bMiddle));
+
+    // Third Runge-Kutta point
+    const LaneVector3 t3 = detail::laneScale(
+        qop, detail::laneCross(detail::laneAxpy(halfH, t2, dir), bMiddle));
+
+    // Last Runge-Kutta point
+    const LaneVector3 pos2 = detail::laneAxpy(Lanes(h2 * 0.5), t3,
+                                              detail::laneAxpy(h, dir, pos));
+    const LaneVector3 bLast = getFields(pos2, trying, fieldCache, errors);
+    const LaneVector3 t4 = detail::laneScale(
+        qop, detail::laneCross(detail::laneAxpy(h, t3, dir), bLast));
+
+    // Compute and check the local integration error estimate
+    const Lanes error =
+        (h2 * ((k1.x - t2.x - t3.x + t4.x).abs() +
+               (k1.y - t2.y - t3.y + t4.y).abs() +
+               (k1.z - t2.z - t3.z + t4.z).abs()))
+            .max(1e-20);
+
+    detail::laneAssign(trying, t2, k2);
+    detail::laneAssign(trying, t3, k3);
+    detail::laneAssign(trying, t4, k4);
+    errorEstimate = trying.select(error, errorEstimate);
+
+    const LaneMask rejected =
+        trying && (error > 4.0 * stepping.stepTolerance);
+    h = rejected.select(h * calcStepSizeScaling(error), h);
+    trying = rejected;
+
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+      if (!trying[lane]) {
+        continue;
+      }
+      ++nStepTrials[lane];
+      // If step size becomes too small the particle remains at the initial
+      // place
+      if (std::abs(h[lane]) < std::abs(stepping.stepSizeCutOff)) {
+        errors[lane] = EigenStepperError::StepSizeStalled;
+        trying[lane] = false;
+      } else if (nStepTrials[lane] > stepping.maxRungeKuttaStepTrials) {
+        errors[lane] = EigenStepperError::StepSizeAdjustmentFailed;
+        trying[lane] = false;
+      }
+    }
+  }
+
+  for (std::size_t lane = 0; lane < kLanes; ++lane) {
+    if (errors[lane].has_value()) {
+      active[lane] = false;
+    }
+  }
+  h = active.select(h, Lanes::Zero());
+  h2 = h * h;
+
+  // Update the track parameters according to the equations of motion
+  const Lanes h2Sixth = h2 / 6.;
+  const Lanes hSixth = h / 6.;
+  batch.position = {
+      pos.x + h * dir.x + h2Sixth * (k1.x + k2.x + k3.x),
+      pos.y + h * dir.y + h2Sixth * (k1.y + k2.y + k3.y),
+      pos.z + h * dir.z + h2Sixth * (k1.z + k2.z + k3.z)};
+  const LaneVector3 newDir = {
+      dir.x + hSixth * (k1.x + 2. * (k2.x + k3.x) + k4.x),
+      dir.y + hSixth * (k1.y + 2. * (k2.y + k3.y) + k4.y),
+      dir.z + hSixth * (k1.z + 2. * (k2.z + k3.z) + k4.z)};
+  const Lanes norm =
+      (newDir.x.square() + newDir.y.square() + newDir.z.square()).sqrt();
+  batch.direction = {newDir.x / norm, newDir.y / norm, newDir.z / norm};
+  batch.time += h * batch.dtds;
+
+  const Lanes nextAccuracy = (h * calcStepSizeScaling(errorEstimate)).abs();
+  for (std::size_t lane = 0; lane < kLanes; ++lane) {
+    if (!active[lane]) {
+      continue;
+    }
+    batch.pathLength[lane] += h[lane];
+    ++batch.steps[lane];
+
+    ConstrainedStep& stepSize = batch.stepSize[lane];
+    const double previousAccuracy = std::abs(stepSize.accuracy());
+    const double initialStepLength = std::abs(initialH[lane]);
+    if (nextAccuracy[lane] < initialStepLength ||
+        nextAccuracy[lane] > previousAccuracy) {
+      stepSize.setAccuracy(nextAccuracy[lane]);
+    }
+  }
+
+  return errors;
+}
+
+template <std::size_t kLanes>
+void Acts::BatchPropagator<kLanes>::stepStraightLine(
+    Batch& batch, const Options& options) const {
+  Lanes h = Lanes::Zero();
+  for (std::size_t lane = 0; lane < kLanes; ++lane) {
+    if (batch.active[lane]) {
+      h[lane] = batch.stepSize[lane].value() * options.direction;
+      batch.pathLength[lane] += h[lane];
+      ++batch.steps[lane];
+    }
+  }
+
+  batch.position = detail::laneAxpy(h, batch.direction, batch.position);
+  batch.time += h * batch.dtds;
+}
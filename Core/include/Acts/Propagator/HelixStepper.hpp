@@ -0,0 +1,430 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/detail/CorrectedTransformationFreeToBound.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/NavigationTarget.hpp"
+#include "Acts/Propagator/PropagatorTraits.hpp"
+#include "Acts/Propagator/StepperOptions.hpp"
+#include "Acts/Propagator/StepperStatistics.hpp"
+#include "Acts/Propagator/detail/SteppingHelper.hpp"
+#include "Acts/Surfaces/BoundaryTolerance.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace Acts {
+
+class IVolumeMaterial;
+
+/// @brief Analytic helix stepper for homogeneous magnetic fields
+///
+/// The helix stepper transports the track parameters and the transport
+/// jacobian along the exact helix in a constant magnetic field. There is no
+/// error estimation and no step size adaption, so a single step can go all
+/// the way to the next navigation target.
+///
+/// The field is evaluated once per step at the start position. In an
+/// inhomogeneous field each step is therefore only an approximation and the
+/// maximum step size should be limited by the user. Material is ignored.
+///
+/// Only surfaces targeted by the navigator are reached exactly. Step sizes
+/// set by actors are straight line estimates which are followed along the
+/// helix, e.g. a target surface without a navigator can be overstepped.
+class HelixStepper final {
+ public:
+  /// Type alias for bound track parameters
+  using BoundParameters = BoundTrackParameters;
+  /// Type alias for transport jacobian matrix
+  using Jacobian = BoundMatrix;
+  /// Type alias for covariance matrix
+  using Covariance = BoundMatrix;
+  /// Type alias for bound state containing parameters, jacobian, and path
+  /// length
+  using BoundState = std::tuple<BoundParameters, Jacobian, double>;
+
+  /// Configuration for the helix stepper.
+  struct Config {
+    /// Magnetic field provider
+    std::shared_ptr<const MagneticFieldProvider> bField;
+  };
+
+  /// Runtime options for helix propagation.
+  struct Options : public StepperPlainOptions {
+    /// Constructor from geometry and magnetic field contexts
+    /// @param gctx The geometry context
+    /// @param mctx The magnetic field context
+    Options(const GeometryContext& gctx, const MagneticFieldContext& mctx)
+        : StepperPlainOptions(gctx, mctx) {}
+
+    /// Set plain stepper options
+    /// @param options The plain options to set
+    void setPlainOptions(const StepperPlainOptions& options) {
+      static_cast<StepperPlainOptions&>(*this) = options;
+    }
+  };
+
+  /// @brief State for track parameter propagation
+  ///
+  /// It contains the stepping information and is provided thread local
+  /// by the propagator
+  struct State {
+    /// Constructor from the initial bound track parameters
+    ///
+    /// @param [in] optionsIn is the configuration of the stepper
+    /// @param [in] fieldCacheIn is the cache object for the magnetic field
+    ///
+    /// @note the covariance matrix is copied when needed
+    State(const Options& optionsIn, MagneticFieldProvider::Cache fieldCacheIn)
+        : options(optionsIn), fieldCache(std::move(fieldCacheIn)) {}
+
+    /// Configuration options for the stepper
+    Options options;
+
+    /// Internal free vector parameters
+    FreeVector pars = FreeVector::Zero();
+
+    /// Particle hypothesis
+    ParticleHypothesis particleHypothesis = ParticleHypothesis::pion();
+
+    /// Boolean to indicate if you need covariance transport
+    bool covTransport = false;
+    /// Covariance matrix for track parameter uncertainties
+    Covariance cov = Covariance::Zero();
+
+    /// The full jacobian of the transport entire transport
+    Jacobian jacobian = Jacobian::Identity();
+
+    /// Jacobian from local to the global frame
+    BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+
+    /// Pure transport jacobian part from the helix transport
+    FreeMatrix jacTransport = FreeMatrix::Identity();
+
+    /// The propagation derivative
+    FreeVector derivative = FreeVector::Zero();
+
+    /// Accumulated path length state
+    double pathAccumulated = 0.;
+
+    /// Total number of performed steps
+    std::size_t nSteps = 0;
+
+    /// Totoal number of attempted steps
+    std::size_t nStepTrials = 0;
+
+    /// Step size constraints, there is no accuracy constraint
+    ConstrainedStep stepSize;
+
+    /// Last performed step (for overstep limit calculation)
+    double previousStepSize = 0.;
+
+    /// This caches the current magnetic field cell
+    MagneticFieldProvider::Cache fieldCache;
+
+    /// Statistics of the stepper
+    StepperStatistics statistics;
+  };
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  /// @param bField The magnetic field provider
+  explicit HelixStepper(std::shared_ptr<const MagneticFieldProvider> bField);
+
+  /// @brief Constructor with configuration
+  /// @param config The configuration of the stepper
+  explicit HelixStepper(const Config& config);
+
+  /// Create a stepper state from propagation options
+  /// @param options The propagation options
+  /// @return A new stepper state initialized with the provided options
+  State makeState(const Options& options) const;
+
+  /// Initialize the stepper state from bound track parameters
+  /// @param state The stepper state to initialize
+  /// @param par The bound track parameters to initialize from
+  void initialize(State& state, const BoundParameters& par) const;
+
+  /// Initialize the stepper state from bound parameters and components
+  /// @param state The stepper state to initialize
+  /// @param boundParams The bound parameter vector
+  /// @param cov Optional covariance matrix
+  /// @param particleHypothesis The particle hypothesis (mass, charge, etc.)
+  /// @param surface The reference surface
+  void initialize(State& state, const BoundVector& boundParams,
+                  const std::optional<BoundMatrix>& cov,
+                  ParticleHypothesis particleHypothesis,
+                  const Surface& surface) const;
+
+  /// Get the field for the stepping, it checks first if the access is still
+  /// within the Cell, and updates the cell if necessary.
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  ///                 the magnetic field cell is used (and potentially updated)
+  /// @param [in] pos is the field position
+  /// @return Magnetic field vector
+  Result<Vector3> getField(State& state, const Vector3& pos) const {
+    return m_bField->getField(pos, state.fieldCache);
+  }
+
+  /// Global particle position accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return Current global position vector
+  Vector3 position(const State& state) const {
+    return state.pars.template segment<3>(eFreePos0);
+  }
+
+  /// Momentum direction accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return Current normalized direction vector
+  Vector3 direction(const State& state) const {
+    return state.pars.template segment<3>(eFreeDir0);
+  }
+
+  /// QoP direction accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return Charge over momentum (q/p) value
+  double qOverP(const State& state) const { return state.pars[eFreeQOverP]; }
+
+  /// Absolute momentum accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return Absolute momentum magnitude
+  double absoluteMomentum(const State& state) const {
+    return particleHypothesis(state).extractMomentum(qOverP(state));
+  }
+
+  /// Momentum accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return Current momentum vector
+  Vector3 momentum(const State& state) const {
+    return absoluteMomentum(state) * direction(state);
+  }
+
+  /// Charge access
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return Electric charge of the particle
+  double charge(const State& state) const {
+    return particleHypothesis(state).extractCharge(qOverP(state));
+  }
+
+  /// Particle hypothesis
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return Reference to the particle hypothesis used
+  const ParticleHypothesis& particleHypothesis(const State& state) const {
+    return state.particleHypothesis;
+  }
+
+  /// Time access
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @return The time coordinate from the free parameters vector
+  double time(const State& state) const { return state.pars[eFreeTime]; }
+
+  /// Update surface status
+  ///
+  /// This method intersects the provided surface and update the navigation
+  /// step estimation accordingly (hence it changes the state). It also
+  /// returns the status of the intersection to trigger onSurface in case
+  /// the surface is reached.
+  ///
+  /// The straight line path length to a reachable surface is refined along
+  /// the helix, so the surface is reached with a single step.
+  ///
+  /// @param [in,out] state The stepping state (thread-local cache)
+  /// @param [in] surface The surface provided
+  /// @param [in] index The surface intersection index
+  /// @param [in] navDir The navigation direction
+  /// @param [in] boundaryTolerance The boundary check for this status update
+  /// @param [in] surfaceTolerance Surface tolerance used for intersection
+  /// @param [in] stype The step size type to be set
+  /// @param [in] logger A logger instance
+  /// @return Status of the intersection indicating whether surface was reached
+  IntersectionStatus updateSurfaceStatus(
+      State& state, const Surface& surface, std::uint8_t index,
+      Direction navDir, const BoundaryTolerance& boundaryTolerance,
+      double surfaceTolerance, ConstrainedStep::Type stype,
+      const Logger& logger = getDummyLogger()) const;
+
+  /// Update step size
+  ///
+  /// It checks the status to the reference surface & updates
+  /// the step size accordingly
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param target [in] The NavigationTarget
+  /// @param direction [in] The propagation direction
+  /// @param stype [in] The step size type to be set
+  void updateStepSize(State& state, const NavigationTarget& target,
+                      Direction direction, ConstrainedStep::Type stype) const {
+    static_cast<void>(direction);
+    double stepSize = target.pathLength();
+    updateStepSize(state, stepSize, stype);
+  }
+
+  /// Update step size - explicitly with a double
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param stepSize [in] The step size value
+  /// @param stype [in] The step size type to be set
+  void updateStepSize(State& state, double stepSize,
+                      ConstrainedStep::Type stype) const {
+    state.previousStepSize = state.stepSize.value();
+    state.stepSize.update(stepSize, stype);
+  }
+
+  /// Get the step size
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  /// @param stype [in] The step size type to be returned
+  /// @return Current step size for the specified constraint type
+  double getStepSize(const State& state, ConstrainedStep::Type stype) const {
+    return state.stepSize.value(stype);
+  }
+
+  /// Release the Step size
+  ///
+  /// @param [in,out] state The stepping state (thread-local cache)
+  /// @param [in] stype The step size type to be released
+  void releaseStepSize(State& state, ConstrainedStep::Type stype) const {
+    state.stepSize.release(stype);
+  }
+
+  /// Output the Step Size - single component
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @return String representation of the current step size
+  std::string outputStepSize(const State& state) const {
+    return state.stepSize.toString();
+  }
+
+  /// Create and return the bound state at the current position
+  ///
+  /// @brief This transports (if necessary) the covariance
+  /// to the surface and creates a bound state. It does not check
+  /// if the transported state is at the surface, this needs to
+  /// be guaranteed by the propagator
+  ///
+  /// @param [in] state State that will be presented as @c BoundState
+  /// @param [in] surface The surface to which we bind the state
+  /// @param [in] transportCov Flag steering covariance transport
+  /// @param [in] freeToBoundCorrection Correction for non-linearity effect during transform from free to bound
+  ///
+  /// @return A bound state:
+  ///   - the parameters at the surface
+  ///   - the stepwise jacobian towards it (from last bound)
+  ///   - and the path length (from start - for ordering)
+  Result<BoundState> boundState(
+      State& state, const Surface& surface, bool transportCov = true,
+      const FreeToBoundCorrection& freeToBoundCorrection =
+          FreeToBoundCorrection(false)) const;
+
+  /// @brief If necessary fill additional members needed for curvilinearState
+  ///
+  /// Compute path length derivatives in case they have not been computed
+  /// yet, which is the case if no step has been executed yet.
+  ///
+  /// @param [in, out] state The stepping state (thread-local cache)
+  /// @return true if nothing is missing after this call, false otherwise.
+  bool prepareCurvilinearState(State& state) const;
+
+  /// Create and return a curvilinear state at the current position
+  ///
+  /// @brief This transports (if necessary) the covariance
+  /// to the current position and creates a curvilinear state.
+  ///
+  /// @param [in] state State that will be presented as @c CurvilinearState
+  /// @param [in] transportCov Flag steering covariance transport
+  ///
+  /// @return A curvilinear state:
+  ///   - the curvilinear parameters at given position
+  ///   - the stepweise jacobian towards it (from last bound)
+  ///   - and the path length (from start - for ordering)
+  BoundState curvilinearState(State& state, bool transportCov = true) const;
+
+  /// Method to update a stepper state to the some parameters
+  ///
+  /// @param [in,out] state State object that will be updated
+  /// @param [in] freeParams Free parameters that will be written into @p state
+  /// @param [in] boundParams Corresponding bound parameters used to update jacToGlobal in @p state
+  /// @param [in] covariance Covariance that will be written into @p state
+  /// @param [in] surface The surface used to update the jacToGlobal
+  void update(State& state, const FreeVector& freeParams,
+              const BoundVector& boundParams, const Covariance& covariance,
+              const Surface& surface) const;
+
+  /// Method to update the stepper state
+  ///
+  /// @param [in,out] state State object that will be updated
+  /// @param [in] uposition the updated position
+  /// @param [in] udirection the updated direction
+  /// @param [in] qOverP the updated qOverP value
+  /// @param [in] time the updated time value
+  void update(State& state, const Vector3& uposition, const Vector3& udirection,
+              double qOverP, double time) const;
+
+  /// Method for on-demand transport of the covariance
+  /// to a new curvilinear frame at current  position,
+  /// or direction of the state
+  ///
+  /// @param [in,out] state State of the stepper
+  void transportCovarianceToCurvilinear(State& state) const;
+
+  /// Method for on-demand transport of the covariance
+  /// to a new curvilinear frame at current position,
+  /// or direction of the state
+  ///
+  /// @param [in,out] state State of the stepper
+  /// @param [in] surface is the surface to which the covariance is forwarded to
+  /// @param [in] freeToBoundCorrection Correction for non-linearity effect during transform from free to bound
+  /// @note no check is done if the position is actually on the surface
+  void transportCovarianceToBound(
+      State& state, const Surface& surface,
+      const FreeToBoundCorrection& freeToBoundCorrection =
+          FreeToBoundCorrection(false)) const;
+
+  /// Perform a helix propagation step
+  ///
+  /// @param [in,out] state State of the stepper
+  /// @param propDir is the direction of propagation
+  /// @param material is the optional volume material we are stepping through.
+  //         This is simply ignored.
+  /// @return the result of the step
+  ///
+  /// @note The state contains the desired step size. It can be negative during
+  ///       backwards track propagation.
+  Result<double> step(State& state, Direction propDir,
+                      const IVolumeMaterial* material) const;
+
+ protected:
+  /// Magnetic field inside of the detector
+  std::shared_ptr<const MagneticFieldProvider> m_bField;
+};
+
+template <>
+struct SupportsBoundParameters<HelixStepper> : public std::true_type {};
+
+}  // namespace Acts
@@ -35,6 +35,7 @@ namespace Acts {
 class SurfaceBounds;
 class ISurfaceMaterial;
 class Layer;
+class TrackingGeometry;
 class TrackingVolume;
 class IVisualization3D;
 
@@ -53,6 +54,8 @@ class Surface : public virtual GeometryObject,
                 public std::enable_shared_from_this<Surface> {
  public:
   friend struct GeometryContextOstreamWrapper<Surface>;
+  /// Give the TrackingGeometry friend rights to register its surfaces
+  friend class TrackingGeometry;
 
   /// @enum SurfaceType
   ///
@@ -88,8 +91,10 @@ class Surface : public virtual GeometryObject,
   /// @note copy construction invalidates the association
   /// to detector element and layer
   ///
+  /// @note the copy is not part of the tracking geometry of the source
+  ///
   /// @param other Source surface for copy.
-  Surface(const Surface& other) noexcept = default;
+  Surface(const Surface& other) noexcept;
 
   /// Constructor from SurfacePlacement: Element proxy
   ///
@@ -151,9 +156,11 @@ class Surface : public virtual GeometryObject,
   /// @note copy construction invalidates the association
   /// to detector element and layer
   ///
+  /// @note the tracking geometry of this surface is kept
+  ///
   /// @param other Source surface for the assignment
   /// @return Reference to this surface after assignment
-  Surface& operator=(const Surface& other) noexcept = default;
+  Surface& operator=(const Surface& other) noexcept;
 
   /// Comparison (equality) operator
   /// The strategy for comparison is
@@ -212,6 +219,11 @@ class Surface : public virtual GeometryObject,
   /// @return Layer by plain pointer, can be nullptr
   const Layer* associatedLayer() const;
 
+  /// Return the tracking geometry that finds this surface by its identifier
+  /// @return TrackingGeometry by plain pointer, nullptr if the surface is
+  ///         not part of a tracking geometry
+  const TrackingGeometry* trackingGeometry() const;
+
   /// Return the thickness of the surface in the normal direction
   /// @return The surface thickness
   double thickness() const;
@@ -554,6 +566,10 @@ class Surface : public virtual GeometryObject,
 
   /// Thickness of the surface in the normal direction
   double m_thickness{0.};
+
+  /// The tracking geometry that finds this surface by its identifier, set by
+  /// the geometry itself while it is alive, nullptr if not part of one
+  mutable const TrackingGeometry* m_trackingGeometry{nullptr};
   /// Calculate the derivative of bound track parameters w.r.t.
   /// alignment parameters of its reference surface (i.e. origin in global 3D
   /// Cartesian coordinates and its rotation represented with extrinsic Euler
@@ -0,0 +1,81 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+/// Straight line path lengths to many surfaces at once.
+///
+/// The placements of plane, disc and cylinder surfaces are packed into
+/// structure-of-arrays columns per surface type, so that the path lengths to
+/// all surfaces of one type are computed in a single vectorized pass without
+/// a virtual call per surface. The path lengths refer to the unbounded
+/// surfaces and are meant to discard surfaces before the full intersection
+/// and boundary check, e.g. when they are only crossed behind the query
+/// point.
+///
+/// The batch keeps its memory when it is cleared and is meant to be reused.
+class SurfaceIntersectionBatch {
+ public:
+  /// Removes all surfaces from the batch
+  void clear();
+
+  /// Adds a surface to the batch
+  /// @param gctx The geometry context to resolve the surface placement
+  /// @param surface The surface to add
+  void add(const GeometryContext& gctx, const Surface& surface);
+
+  /// @return The number of surfaces in the batch
+  std::size_t size() const { return m_pathLengths.size(); }
+
+  /// Computes the largest path length at which the straight line crosses
+  /// each unbounded surface.
+  ///
+  /// The result is NaN if the surface type is not supported or no finite
+  /// crossing can be computed, e.g. if the line is parallel to a plane or
+  /// misses a cylinder. Callers have to treat NaN as unknown.
+  ///
+  /// @param position The start position of the line
+  /// @param direction The direction of the line
+  /// @return The path lengths in the order the surfaces were added
+  std::span<const double> maxPathLengths(const Vector3& position,
+                                         const Vector3& direction);
+
+ private:
+  /// Columns of a surface type, each entry is one packed value per surface
+  template <std::size_t N>
+  struct Columns {
+    std::array<std::vector<double>, N> values;
+    std::vector<std::uint32_t> indices;
+
+    void clear();
+    void add(std::uint32_t index, const std::array<double, N>& packed);
+  };
+
+  /// Normal and center of planar surfaces
+  Columns<6> m_planes;
+  /// Axis, center and radius of cylinder surfaces
+  Columns<7> m_cylinders;
+  /// Scratch column for the path lengths of one surface type
+  std::vector<double> m_scratch;
+
+  std::vector<double> m_pathLengths;
+};
+
+}  // namespace Acts
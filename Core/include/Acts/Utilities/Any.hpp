@@ -15,6 +15,7 @@
 #include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <typeinfo>
 #include <utility>
@@ -148,6 +149,8 @@ class AnyBaseAll {};
 ///   copies when trivial.
 /// - Heap storage: values are allocated on the heap; moves transfer ownership
 ///   of the pointer; copies allocate and copy-construct the pointee.
+/// - Trivially copyable values stored locally are copied, moved and destroyed
+///   as raw bytes without consulting the type-erased handler.
 template <std::size_t sb_size, bool copyable = true>
 class AnyBase : public AnyBaseAll {
   static_assert(sizeof(void*) <= sb_size, "Size is too small for a pointer");
@@ -179,7 +182,7 @@ class AnyBase : public AnyBaseAll {
     requires(isStorable<std::decay_t<T>>())
   explicit AnyBase(std::in_place_type_t<T> /*unused*/, Args&&... args) {
     using U = std::decay_t<T>;
-    m_handler = makeHandler<U>();
+    m_handler = handlerBits<U>();
     constructValue<U>(std::forward<Args>(args)...);
   }
 
@@ -207,7 +210,7 @@ class AnyBase : public AnyBaseAll {
   T& emplace(Args&&... args) {
     using U = std::decay_t<T>;
     destroy();
-    m_handler = makeHandler<U>();
+    m_handler = handlerBits<U>();
     return *constructValue<U>(std::forward<Args>(args)...);
   }
 
@@ -219,12 +222,12 @@ class AnyBase : public AnyBaseAll {
   T& as() {
     static_assert(std::is_same_v<T, std::decay_t<T>>,
                   "Please pass the raw type, no const or ref");
-    if (m_handler == nullptr || m_handler->typeHash != typeHash<T>()) {
+    if (m_handler == 0 || handler()->typeHash != typeHash<T>()) {
       throw std::bad_any_cast{};
     }
 
     _ACTS_ANY_VERBOSE("Get as "
-                      << (m_handler->heapAllocated ? "heap" : "local"));
+                      << (handler()->heapAllocated ? "heap" : "local"));
 
     return *std::bit_cast<T*>(dataPtr());
   }
@@ -237,12 +240,12 @@ class AnyBase : public AnyBaseAll {
   const T& as() const {
     static_assert(std::is_same_v<T, std::decay_t<T>>,
                   "Please pass the raw type, no const or ref");
-    if (m_handler == nullptr || m_handler->typeHash != typeHash<T>()) {
+    if (m_handler == 0 || handler()->typeHash != typeHash<T>()) {
       throw std::bad_any_cast{};
     }
 
     _ACTS_ANY_VERBOSE("Get as "
-                      << (m_handler->heapAllocated ? "heap" : "local"));
+                      << (handler()->heapAllocated ? "heap" : "local"));
 
     return *std::bit_cast<const T*>(dataPtr());
   }
@@ -255,7 +258,7 @@ class AnyBase : public AnyBaseAll {
   T* asPtr() {
     static_assert(std::is_same_v<T, std::decay_t<T>>,
                   "Please pass the raw type, no const or ref");
-    if (m_handler == nullptr || m_handler->typeHash != typeHash<T>()) {
+    if (m_handler == 0 || handler()->typeHash != typeHash<T>()) {
       return nullptr;
     }
     return std::bit_cast<T*>(dataPtr());
@@ -269,7 +272,7 @@ class AnyBase : public AnyBaseAll {
   const T* asPtr() const {
     static_assert(std::is_same_v<T, std::decay_t<T>>,
                   "Please pass the raw type, no const or ref");
-    if (m_handler == nullptr || m_handler->typeHash != typeHash<T>()) {
+    if (m_handler == 0 || handler()->typeHash != typeHash<T>()) {
       return nullptr;
     }
     return std::bit_cast<const T*>(dataPtr());
@@ -283,7 +286,7 @@ class AnyBase : public AnyBaseAll {
   T take() {
     static_assert(std::is_same_v<T, std::decay_t<T>>,
                   "Please pass the raw type, no const or ref");
-    if (m_handler == nullptr || m_handler->typeHash != typeHash<T>()) {
+    if (m_handler == 0 || handler()->typeHash != typeHash<T>()) {
       throw std::bad_any_cast{};
     }
     T* ptr = std::bit_cast<T*>(dataPtr());
@@ -299,15 +302,15 @@ class AnyBase : public AnyBaseAll {
   AnyBase(const AnyBase& other) noexcept(detail::kAnyNoexcept)
     requires copyable
   {
-    if (m_handler == nullptr && other.m_handler == nullptr) {
-      // both are empty, noop
-      return;
-    }
-
     _ACTS_ANY_VERBOSE("Copy construct (this="
                       << this << ") at: " << static_cast<void*>(m_data.data()));
 
     m_handler = other.m_handler;
+    if (trivial()) {
+      // empty or trivially copyable local value
+      m_data = other.m_data;
+      return;
+    }
     copyConstruct(other);
   }
 
@@ -325,8 +328,10 @@ class AnyBase : public AnyBaseAll {
     _ACTS_ANY_VERBOSE("Copy assign (this="
                       << this << ") at: " << static_cast<void*>(m_data.data()));
 
-    if (m_handler == nullptr && other.m_handler == nullptr) {
-      // both are empty, noop
+    if (trivial() && other.trivial()) {
+      // nothing to destroy and nothing to copy but raw bytes
+      m_handler = other.m_handler;
+      m_data = other.m_data;
       return *this;
     }
 
@@ -334,11 +339,11 @@ class AnyBase : public AnyBaseAll {
       // same type, but checked before they're not both nullptr
       copy(other);
     } else {
-      if (m_handler != nullptr) {
+      if (m_handler != 0) {
         // this object is not empty, but have different types => destroy
         destroy();
       }
-      assert(m_handler == nullptr);
+      assert(m_handler == 0);
       m_handler = other.m_handler;
       copyConstruct(other);
     }
@@ -355,12 +360,13 @@ class AnyBase : public AnyBaseAll {
   AnyBase(AnyBase&& other) noexcept(detail::kAnyNoexcept) {
     _ACTS_ANY_VERBOSE("Move construct (this="
                       << this << ") at: " << static_cast<void*>(m_data.data()));
-    if (m_handler == nullptr && other.m_handler == nullptr) {
-      // both are empty, noop
-      return;
-    }
 
     m_handler = other.m_handler;
+    if (trivial()) {
+      // empty or trivially copyable local value
+      m_data = other.m_data;
+      return;
+    }
     moveConstruct(std::move(other));
   }
 
@@ -370,23 +376,25 @@ class AnyBase : public AnyBaseAll {
   AnyBase& operator=(AnyBase&& other) noexcept(detail::kAnyNoexcept) {
     _ACTS_ANY_VERBOSE("Move assign (this="
                       << this << ") at: " << static_cast<void*>(m_data.data()));
-    if (m_handler == nullptr && other.m_handler == nullptr) {
-      // both are empty, noop
+    if (trivial() && other.trivial()) {
+      // nothing to destroy and nothing to move but raw bytes
+      m_handler = other.m_handler;
+      m_data = other.m_data;
       return *this;
     }
 
-    // At this point they can't be equal and nullptr, so it's safe to
+    // At this point they can't be both empty, so it's safe to
     // dereference
     if (m_handler == other.m_handler &&
-        m_handler->typeHash == other.m_handler->typeHash) {
+        handler()->typeHash == other.handler()->typeHash) {
       // same type, but checked before they're not both nullptr
       move(std::move(other));
     } else {
-      if (m_handler != nullptr) {
+      if (m_handler != 0) {
         // this object is not empty, but have different types => destroy
         destroy();
       }
-      assert(m_handler == nullptr);
+      assert(m_handler == 0);
       m_handler = other.m_handler;
       moveConstruct(std::move(other));
     }
@@ -396,17 +404,17 @@ class AnyBase : public AnyBaseAll {
 
   /// Check if the AnyBase contains a value
   /// @return True if a value is stored, false if empty
-  explicit operator bool() const { return m_handler != nullptr; }
+  explicit operator bool() const { return m_handler != 0; }
 
   /// Type info of the stored value. Returns nullptr if empty.
   /// @return Pointer to the type info of the stored value, or nullptr if empty
   const std::type_info* typeInfo() const {
-    return m_handler != nullptr ? m_handler->typeInfo : nullptr;
+    return m_handler != 0 ? handler()->typeInfo : nullptr;
   }
 
  private:
   void* dataPtr() {
-    if (m_handler->heapAllocated) {
+    if (handler()->heapAllocated) {
       return *std::bit_cast<void**>(m_data.data());
     } else {
       return std::bit_cast<void*>(m_data.data());
@@ -416,7 +424,7 @@ class AnyBase : public AnyBaseAll {
   void setDataPtr(void* ptr) { *std::bit_cast<void**>(m_data.data()) = ptr; }
 
   const void* dataPtr() const {
-    if (m_handler->heapAllocated) {
+    if (handler()->heapAllocated) {
       return *std::bit_cast<void* const*>(m_data.data());
     } else {
       return std::bit_cast<const void*>(m_data.data());
@@ -434,6 +442,27 @@ class AnyBase : public AnyBaseAll {
     const std::type_info* typeInfo{nullptr};
   };
 
+  // The lowest bit of the handler address, which is always zero due to the
+  // alignment of the handler, marks values which need the handler to be
+  // copied, moved or destroyed. Empty instances and trivially copyable values
+  // stored locally are handled as raw bytes.
+  static constexpr std::uintptr_t kNonTrivialBit = 1;
+
+  template <typename T>
+  static std::uintptr_t handlerBits() {
+    static_assert(alignof(Handler) > kNonTrivialBit);
+    constexpr bool trivialValue =
+        !heapAllocated<T>() && std::is_trivially_copyable_v<T>;
+    return std::bit_cast<std::uintptr_t>(makeHandler<T>()) |
+           (trivialValue ? 0 : kNonTrivialBit);
+  }
+
+  const Handler* handler() const {
+    return std::bit_cast<const Handler*>(m_handler & ~kNonTrivialBit);
+  }
+
+  bool trivial() const { return (m_handler & kNonTrivialBit) == 0; }
+
   template <typename T>
   static const Handler* makeHandler() {
     static_assert(!std::is_base_of_v<AnyBaseAll, std::decay_t<T>>,
@@ -508,77 +537,77 @@ class AnyBase : public AnyBaseAll {
 
   void destroy() {
     _ACTS_ANY_VERBOSE("Destructor this=" << this << " handler: " << m_handler);
-    if (m_handler != nullptr && m_handler->destroy != nullptr) {
+    if (!trivial() && handler()->destroy != nullptr) {
       _ACTS_ANY_VERBOSE("Non-trivial destruction");
-      m_handler->destroy(dataPtr());
+      handler()->destroy(dataPtr());
     }
-    m_handler = nullptr;
+    m_handler = 0;
   }
 
   void moveConstruct(AnyBase&& fromAny) {
-    if (m_handler == nullptr) {
+    if (m_handler == 0) {
       return;
     }
 
     void* to = dataPtr();
     void* from = fromAny.dataPtr();
-    if (m_handler->heapAllocated) {
+    if (handler()->heapAllocated) {
       // stored on heap: just copy the pointer
       setDataPtr(fromAny.dataPtr());
       // do not delete in moved-from any
-      fromAny.m_handler = nullptr;
+      fromAny.m_handler = 0;
       return;
     }
 
-    if (m_handler->moveConstruct == nullptr) {
+    if (handler()->moveConstruct == nullptr) {
       _ACTS_ANY_VERBOSE("Trivially move construct");
       // trivially move constructible
       m_data = std::move(fromAny.m_data);
     } else {
-      m_handler->moveConstruct(from, to);
+      handler()->moveConstruct(from, to);
     }
   }
 
   void move(AnyBase&& fromAny) {
-    if (m_handler == nullptr) {
+    if (m_handler == 0) {
       return;
     }
 
     void* to = dataPtr();
     void* from = fromAny.dataPtr();
-    if (m_handler->heapAllocated) {
+    if (handler()->heapAllocated) {
       // stored on heap: just copy the pointer
       // need to delete existing pointer
-      m_handler->destroy(dataPtr());
+      handler()->destroy(dataPtr());
       setDataPtr(fromAny.dataPtr());
       // do not delete in moved-from any
-      fromAny.m_handler = nullptr;
+      fromAny.m_handler = 0;
       return;
     }
 
-    if (m_handler->move == nullptr) {
+    if (handler()->move == nullptr) {
       _ACTS_ANY_VERBOSE("Trivially move");
       // trivially movable
       m_data = std::move(fromAny.m_data);
     } else {
-      m_handler->move(from, to);
+      handler()->move(from, to);
     }
   }
 
   void copyConstruct(const AnyBase& fromAny) {
-    if (m_handler == nullptr) {
+    if (m_handler == 0) {
       return;
     }
 
     void* to = dataPtr();
     const void* from = fromAny.dataPtr();
 
-    if (m_handler->copyConstruct == nullptr) {
+    if (handler()->copyConstruct == nullptr) {
       _ACTS_ANY_VERBOSE("Trivially copy construct");
       // trivially copy constructible
       m_data = fromAny.m_data;
     } else {
-      void* copyAt = m_handler->copyConstruct(from, to);
+      void* copyAt = handler()->copyConstruct(from, to);
       if (to == nullptr) {
         assert(copyAt != nullptr);
         // copy allocated, store pointer
@@ -588,19 +617,19 @@ class AnyBase : public AnyBaseAll {
   }
 
   void copy(const AnyBase& fromAny) {
-    if (m_handler == nullptr) {
+    if (m_handler == 0) {
       return;
     }
 
     void* to = dataPtr();
     const void* from = fromAny.dataPtr();
 
-    if (m_handler->copy == nullptr) {
+    if (handler()->copy == nullptr) {
       _ACTS_ANY_VERBOSE("Trivially copy");
       // trivially copyable
       m_data = fromAny.m_data;
     } else {
-      m_handler->copy(from, to);
+      handler()->copy(from, to);
     }
   }
 
@@ -687,7 +716,7 @@ class AnyBase : public AnyBaseAll {
       );
 
   alignas(kMaxAlignment) std::array<std::byte, sb_size> m_data{};
-  const Handler* m_handler{nullptr};
+  std::uintptr_t m_handler{0};
 };
 
 /// @brief A type-safe container for single values of any type
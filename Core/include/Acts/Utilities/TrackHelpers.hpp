@@ -26,7 +26,10 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -746,6 +749,59 @@ std::pair<BoundVector, BoundMatrix> calculateUnbiasedParametersCovariance(
       });
 }
 
+/// @brief Compact the track states of a track container
+///
+/// Only the track states of the tracks in the container remain, e.g. the
+/// discarded branches of the combinatorial track finding are dropped. The
+/// track states are stored contiguously in track order, from the innermost
+/// to the outermost one, and track states shared between tracks are kept
+/// once. The tip and stem indices of the tracks are updated.
+///
+/// @tparam track_container_t The track container type
+///
+/// @param trackContainer The track container
+///
+/// @return The new index of every previous track state, or
+///         @c kTrackIndexInvalid if it was removed
+template <TrackContainerFrontend track_container_t>
+std::vector<TrackIndexType> compactTrackStates(
+    track_container_t &trackContainer)
+  requires requires(std::span<const TrackIndexType> states) {
+    trackContainer.trackStateContainer().compact(states);
+  }
+{
+  auto &trackStates = trackContainer.trackStateContainer();
+
+  std::vector<TrackIndexType> states;
+  states.reserve(trackStates.size());
+  std::vector<bool> kept(trackStates.size(), false);
+  for (const auto &track : trackContainer) {
+    const std::size_t begin = states.size();
+    for (const auto &trackState : track.trackStatesReversed()) {
+      // the remaining track states are shared with a previous track
+      if (kept[trackState.index()]) {
+        break;
+      }
+      kept[trackState.index()] = true;
+      states.push_back(trackState.index());
+    }
+    std::reverse(states.begin() + begin, states.end());
+  }
+
+  std::vector<TrackIndexType> remap = trackStates.compact(states);
+
+  for (auto track : trackContainer) {
+    if (track.tipIndex() != kTrackIndexInvalid) {
+      track.tipIndex() = remap[track.tipIndex()];
+    }
+    if (track.stemIndex() != kTrackIndexInvalid) {
+      track.stemIndex() = remap[track.stemIndex()];
+    }
+  }
+
+  return remap;
+}
+
 }  // namespace Acts
 
 namespace std {
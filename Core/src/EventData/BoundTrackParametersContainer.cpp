@@ -0,0 +1,136 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/BoundTrackParametersContainer.hpp"
+
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <stdexcept>
+
+namespace Acts {
+
+static_assert(std::ranges::random_access_range<BoundTrackParametersContainer>);
+
+BoundTrackParametersContainer::BoundTrackParametersContainer() noexcept =
+    default;
+
+BoundTrackParametersContainer::BoundTrackParametersContainer(
+    std::span<const BoundTrackParameters> parameters) {
+  reserve(static_cast<Index>(parameters.size()));
+  for (const BoundTrackParameters &params : parameters) {
+    createParameters(params);
+  }
+}
+
+void BoundTrackParametersContainer::reserve(Index size) noexcept {
+  for (auto &column : m_parameters) {
+    column.reserve(size);
+  }
+  m_covariances.reserve(size);
+  m_hasCovariance.reserve(size);
+  m_surfaceIndices.reserve(size);
+  m_particleHypotheses.reserve(size);
+}
+
+void BoundTrackParametersContainer::clear() noexcept {
+  m_size = 0;
+
+  for (auto &column : m_parameters) {
+    column.clear();
+  }
+  m_covariances.clear();
+  m_hasCovariance.clear();
+  m_surfaceIndices.clear();
+  m_particleHypotheses.clear();
+
+  m_surfaces.clear();
+  m_surfaceLookup.clear();
+}
+
+MutableBoundTrackParametersProxy
+BoundTrackParametersContainer::createParameters(
+    std::shared_ptr<const Surface> surface, const BoundVector &parameters,
+    const std::optional<BoundMatrix> &covariance,
+    const ParticleHypothesis &particleHypothesis) {
+  if (surface == nullptr) {
+    throw std::invalid_argument(
+        "Reference surface must not be null in "
+        "BoundTrackParametersContainer");
+  }
+
+  const SurfaceIndex surfaceIndex = addSurface(std::move(surface));
+
+  ++m_size;
+  for (std::size_t i = 0; i < eBoundSize; ++i) {
+    m_parameters[i].push_back(parameters[i]);
+  }
+  m_covariances.push_back(covariance.has_value() ? packCovariance(*covariance)
+                                                 : PackedCovariance{});
+  m_hasCovariance.push_back(covariance.has_value() ? 1 : 0);
+  m_surfaceIndices.push_back(surfaceIndex);
+  m_particleHypotheses.push_back(particleHypothesis);
+
+  return MutableProxy(*this, size() - 1);
+}
+
+MutableBoundTrackParametersProxy
+BoundTrackParametersContainer::createParameters(
+    const BoundTrackParameters &parameters) {
+  return createParameters(parameters.referenceSurface().getSharedPtr(),
+                          parameters.parameters(), parameters.covariance(),
+                          parameters.particleHypothesis());
+}
+
+std::vector<BoundTrackParameters>
+BoundTrackParametersContainer::toBoundTrackParameters() const {
+  std::vector<BoundTrackParameters> result;
+  result.reserve(size());
+  for (const ConstProxy params : *this) {
+    result.push_back(params.toBoundTrackParameters());
+  }
+  return result;
+}
+
+BoundTrackParametersContainer::SurfaceIndex
+BoundTrackParametersContainer::addSurface(
+    std::shared_ptr<const Surface> surface) {
+  auto [it, inserted] = m_surfaceLookup.try_emplace(
+      surface.get(), static_cast<SurfaceIndex>(m_surfaces.size()));
+  if (inserted) {
+    m_surfaces.push_back(std::move(surface));
+  }
+  return it->second;
+}
+
+BoundTrackParametersContainer::PackedCovariance
+BoundTrackParametersContainer::packCovariance(const BoundMatrix &covariance) {
+  PackedCovariance packed{};
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < eBoundSize; ++i) {
+    for (std::size_t j = i; j < eBoundSize; ++j) {
+      packed[k++] = covariance(i, j);
+    }
+  }
+  return packed;
+}
+
+BoundMatrix BoundTrackParametersContainer::unpackCovariance(
+    const PackedCovariance &packed) {
+  BoundMatrix covariance;
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < eBoundSize; ++i) {
+    for (std::size_t j = i; j < eBoundSize; ++j) {
+      covariance(i, j) = packed[k];
+      covariance(j, i) = packed[k];
+      ++k;
+    }
+  }
+  return covariance;
+}
+
+}  // namespace Acts
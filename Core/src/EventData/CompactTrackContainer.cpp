@@ -0,0 +1,142 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/CompactTrackContainer.hpp"
+
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <stdexcept>
+
+namespace Acts {
+
+namespace {
+using FloatParametersMap =
+    Eigen::Map<const Eigen::Matrix<float, eBoundSize, 1>>;
+using FloatJacobianMap =
+    Eigen::Map<const Eigen::Matrix<float, eBoundSize, eBoundSize>>;
+}  // namespace
+
+void CompactTrackContainer::reserve(std::size_t nTracks,
+                                    std::size_t nTrackStates) {
+  m_tracks.reserve(nTracks);
+  m_trackParams.reserve(nTracks);
+  m_trackCov.reserve(nTracks);
+  m_trackSurfaces.reserve(nTracks);
+
+  m_states.reserve(nTrackStates);
+  m_sourceLinks.reserve(nTrackStates);
+  m_stateSurfaces.reserve(nTrackStates);
+}
+
+void CompactTrackContainer::clear() {
+  m_tracks.clear();
+  m_trackParams.clear();
+  m_trackCov.clear();
+  m_trackSurfaces.clear();
+
+  m_states.clear();
+  m_params.clear();
+  m_cov.clear();
+  m_jac.clear();
+  m_meas.clear();
+  m_sourceLinks.clear();
+  m_stateSurfaces.clear();
+}
+
+std::size_t CompactTrackContainer::memoryUsage() const {
+  auto bytes = [](const auto& vec) {
+    using value_type = typename std::decay_t<decltype(vec)>::value_type;
+    return vec.size() * sizeof(value_type);
+  };
+  return bytes(m_tracks) + bytes(m_trackParams) + bytes(m_trackCov) +
+         bytes(m_trackSurfaces) + bytes(m_states) + bytes(m_params) +
+         bytes(m_cov) + bytes(m_jac) + bytes(m_meas) + bytes(m_sourceLinks) +
+         bytes(m_stateSurfaces);
+}
+
+BoundVector CompactTrackContainer::parameters(IndexType itrack) const {
+  return FloatParametersMap(m_trackParams[itrack].data()).cast<double>();
+}
+
+BoundMatrix CompactTrackContainer::covariance(IndexType itrack) const {
+  return detail::unpackSymmetric<eBoundSize>(m_trackCov[itrack].data());
+}
+
+TrackStatePropMask CompactTrackContainer::trackStateMask(
+    IndexType istate) const {
+  using PM = TrackStatePropMask;
+  const TrackStateData& state = m_states[istate];
+  PM mask = PM::None;
+  if (state.ipredicted != kInvalid) {
+    mask |= PM::Predicted;
+  }
+  if (state.ifiltered != kInvalid) {
+    mask |= PM::Filtered;
+  }
+  if (state.ismoothed != kInvalid) {
+    mask |= PM::Smoothed;
+  }
+  if (state.ijacobian != kInvalid) {
+    mask |= PM::Jacobian;
+  }
+  if (state.imeas != kInvalid) {
+    mask |= PM::Calibrated;
+  }
+  return mask;
+}
+
+BoundVector CompactTrackContainer::trackStateParameters(
+    IndexType istate, TrackStatePropMask component) const {
+  using enum TrackStatePropMask;
+  const TrackStateData& state = m_states[istate];
+  switch (component) {
+    case Predicted:
+      return unpackParameters(state.ipredicted);
+    case Filtered:
+      return unpackParameters(state.ifiltered);
+    case Smoothed:
+      return unpackParameters(state.ismoothed);
+    default:
+      throw std::invalid_argument("Track state component has no parameters");
+  }
+}
+
+BoundMatrix CompactTrackContainer::trackStateCovariance(
+    IndexType istate, TrackStatePropMask component) const {
+  using enum TrackStatePropMask;
+  const TrackStateData& state = m_states[istate];
+  IndexType index = kInvalid;
+  switch (component) {
+    case Predicted:
+      index = state.ipredicted;
+      break;
+    case Filtered:
+      index = state.ifiltered;
+      break;
+    case Smoothed:
+      index = state.ismoothed;
+      break;
+    default:
+      throw std::invalid_argument("Track state component has no covariance");
+  }
+  assert(index != kInvalid && "Track state component is not stored");
+  return detail::unpackSymmetric<eBoundSize>(m_cov[index].data());
+}
+
+BoundMatrix CompactTrackContainer::jacobian(IndexType istate) const {
+  const IndexType index = m_states[istate].ijacobian;
+  assert(index != kInvalid && "Jacobian is not stored");
+  return FloatJacobianMap(m_jac[index].data()).cast<double>();
+}
+
+BoundVector CompactTrackContainer::unpackParameters(IndexType index) const {
+  assert(index != kInvalid && "Track state component is not stored");
+  return FloatParametersMap(m_params[index].data()).cast<double>();
+}
+
+}  // namespace Acts
@@ -0,0 +1,752 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/FlatTrackContainer.hpp"
+
+#include "Acts/EventData/detail/DynamicColumn.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Acts {
+
+static_assert(std::is_trivially_copyable_v<ParticleHypothesis>,
+              "Particle hypotheses are stored in place");
+static_assert(
+    std::is_trivially_copyable_v<detail::FlatTrackContainerAccess::IndexData>,
+    "Track state index data is stored in place");
+
+namespace {
+
+using Scope = detail::FlatColumnHeader::Scope;
+
+// columns start at cache line boundaries
+constexpr std::size_t kAlignment = 64;
+
+std::size_t alignUp(std::size_t size) {
+  return (size + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+template <typename T>
+constexpr bool kStoredInPlace = std::is_trivially_copyable_v<T>;
+
+// fixed size matrices are plain arrays of their coefficients
+template <typename Scalar, int Rows, int Cols, int Options>
+constexpr bool kStoredInPlace<Eigen::Matrix<Scalar, Rows, Cols, Options>> =
+    sizeof(Eigen::Matrix<Scalar, Rows, Cols, Options>) ==
+    sizeof(Scalar) * Rows * Cols;
+
+// element size of the dynamic column types, zero if the type is unknown
+std::size_t dynamicElementSize(FlatColumnType type) {
+  switch (type) {
+    case FlatColumnType::UInt32:
+      return sizeof(std::uint32_t);
+    case FlatColumnType::UInt64:
+      return sizeof(std::uint64_t);
+    case FlatColumnType::Int32:
+      return sizeof(std::int32_t);
+    case FlatColumnType::Int64:
+      return sizeof(std::int64_t);
+    case FlatColumnType::Float:
+      return sizeof(float);
+    case FlatColumnType::Double:
+      return sizeof(double);
+    case FlatColumnType::Bool:
+      return sizeof(bool);
+    default:
+      return 0;
+  }
+}
+
+struct ColumnData {
+  detail::FlatColumnHeader header;
+  const void* data = nullptr;
+};
+
+template <typename vector_t>
+ColumnData makeColumn(Scope scope, HashedString key, FlatColumnType type,
+                      const vector_t& values) {
+  using value_type = typename vector_t::value_type;
+  static_assert(kStoredInPlace<value_type>, "Columns are stored in place");
+
+  ColumnData column;
+  column.header.key = key;
+  column.header.scope = scope;
+  column.header.type = type;
+  column.header.elementSize = sizeof(value_type);
+  column.header.count = values.size();
+  column.data = values.data();
+  return column;
+}
+
+template <typename vector_t>
+ColumnData makeColumn(Scope scope, std::string_view name,
+                      const vector_t& values) {
+  return makeColumn(scope, hashStringDynamic(name), FlatColumnType::Fixed,
+                    values);
+}
+
+template <typename T>
+bool addDynamicColumn(std::vector<ColumnData>& columns, Scope scope,
+                      HashedString key, FlatColumnType type,
+                      const detail::DynamicColumnBase& column) {
+  const auto* typed = dynamic_cast<const detail::DynamicColumn<T>*>(&column);
+  if (typed == nullptr) {
+    return false;
+  }
+  columns.push_back(makeColumn(scope, key, type, typed->m_vector));
+  return true;
+}
+
+void addDynamicColumns(
+    std::vector<ColumnData>& columns, Scope scope,
+    const std::unordered_map<HashedString,
+                             std::unique_ptr<detail::DynamicColumnBase>>&
+        dynamic) {
+  // sort the keys to get a reproducible file
+  std::vector<HashedString> keys;
+  keys.reserve(dynamic.size());
+  for (const auto& [key, column] : dynamic) {
+    keys.push_back(key);
+  }
+  std::ranges::sort(keys);
+
+  for (HashedString key : keys) {
+    const auto& column = *dynamic.at(key);
+    // columns of other types are skipped
+    addDynamicColumn<std::uint32_t>(columns, scope, key, FlatColumnType::UInt32,
+                                    column) ||
+        addDynamicColumn<std::uint64_t>(columns, scope, key,
+                                        FlatColumnType::UInt64, column) ||
+        addDynamicColumn<std::int32_t>(columns, scope, key,
+                                       FlatColumnType::Int32, column) ||
+        addDynamicColumn<std::int64_t>(columns, scope, key,
+                                       FlatColumnType::Int64, column) ||
+        addDynamicColumn<float>(columns, scope, key, FlatColumnType::Float,
+                                column) ||
+        addDynamicColumn<double>(columns, scope, key, FlatColumnType::Double,
+                                 column) ||
+        addDynamicColumn<bool>(columns, scope, key, FlatColumnType::Bool,
+                               column);
+  }
+}
+
+}  // namespace
+
+std::any detail::FlatDynamicColumn::get(std::size_t index) const {
+  switch (type) {
+    case FlatColumnType::UInt32:
+      return reinterpret_cast<const std::uint32_t*>(data) + index;
+    case FlatColumnType::UInt64:
+      return reinterpret_cast<const std::uint64_t*>(data) + index;
+    case FlatColumnType::Int32:
+      return reinterpret_cast<const std::int32_t*>(data) + index;
+    case FlatColumnType::Int64:
+      return reinterpret_cast<const std::int64_t*>(data) + index;
+    case FlatColumnType::Float:
+      return reinterpret_cast<const float*>(data) + index;
+    case FlatColumnType::Double:
+      return reinterpret_cast<const double*>(data) + index;
+    case FlatColumnType::Bool:
+      return reinterpret_cast<const bool*>(data) + index;
+    default:
+      throw std::runtime_error("Unknown dynamic column type");
+  }
+}
+
+void detail::FlatTrackContainerAccess::write(
+    std::ostream& os, const GeometryContext& gctx,
+    const VectorTrackContainer& tracks,
+    const VectorMultiTrajectory& trackStates, bool dropSourceLinks) {
+  const auto& states =
+      static_cast<const detail_vmt::VectorMultiTrajectoryBase&>(trackStates);
+
+  // source links are type-erased and cannot be stored
+  if (!dropSourceLinks &&
+      std::ranges::any_of(states.m_sourceLinks, [](const auto& sourceLink) {
+        return sourceLink.has_value();
+      })) {
+    throw std::invalid_argument(
+        "Track states with source links cannot be written to a flat track "
+        "container file");
+  }
+
+  // reference surfaces are stored in a table referenced by index
+  std::vector<FlatSurfaceEntry> surfaces;
+  std::unordered_map<const Surface*, TrackIndexType> surfaceIndices;
+  auto surfaceIndex = [&](const Surface* surface) {
+    if (surface == nullptr) {
+      return kTrackIndexInvalid;
+    }
+    auto [it, inserted] = surfaceIndices.try_emplace(
+        surface, static_cast<TrackIndexType>(surfaces.size()));
+    if (inserted) {
+      FlatSurfaceEntry& entry = surfaces.emplace_back();
+      entry.geometryId = surface->geometryId().value();
+      if (surface->geometryId() == GeometryIdentifier{}) {
+        if (surface->type() != Surface::Perigee) {
+          throw std::invalid_argument(
+              "Reference surfaces without geometry identifier have to be "
+              "perigee surfaces");
+        }
+        Vector3 center = surface->center(gctx);
+        entry.center = {center.x(), center.y(), center.z()};
+      }
+    }
+    return it->second;
+  };
+
+  std::vector<TrackIndexType> trackSurfaces;
+  trackSurfaces.reserve(tracks.size());
+  for (const auto& surface : tracks.m_referenceSurfaces) {
+    trackSurfaces.push_back(surfaceIndex(surface.get()));
+  }
+  std::vector<TrackIndexType> stateSurfaces;
+  stateSurfaces.reserve(states.m_index.size());
+  for (const auto& surface : states.m_referenceSurfaces) {
+    stateSurfaces.push_back(surfaceIndex(surface.get()));
+  }
+
+  std::vector<ColumnData> columns;
+  columns.push_back(makeColumn(Scope::Tracks, "tipIndex", tracks.m_tipIndex));
+  columns.push_back(
+      makeColumn(Scope::Tracks, "stemIndex", tracks.m_stemIndex));
+  columns.push_back(makeColumn(Scope::Tracks, "particleHypothesis",
+                               tracks.m_particleHypothesis));
+  columns.push_back(makeColumn(Scope::Tracks, "params", tracks.m_params));
+  columns.push_back(makeColumn(Scope::Tracks, "cov", tracks.m_cov));
+  columns.push_back(
+      makeColumn(Scope::Tracks, "referenceSurface", trackSurfaces));
+  columns.push_back(
+      makeColumn(Scope::Tracks, "nMeasurements", tracks.m_nMeasurements));
+  columns.push_back(makeColumn(Scope::Tracks, "nHoles", tracks.m_nHoles));
+  columns.push_back(makeColumn(Scope::Tracks, "chi2", tracks.m_chi2));
+  columns.push_back(makeColumn(Scope::Tracks, "ndf", tracks.m_ndf));
+  columns.push_back(
+      makeColumn(Scope::Tracks, "nOutliers", tracks.m_nOutliers));
+  columns.push_back(
+      makeColumn(Scope::Tracks, "nSharedHits", tracks.m_nSharedHits));
+
+  columns.push_back(makeColumn(Scope::TrackStates, "index", states.m_index));
+  columns.push_back(
+      makeColumn(Scope::TrackStates, "previous", states.m_previous));
+  columns.push_back(makeColumn(Scope::TrackStates, "next", states.m_next));
+  columns.push_back(makeColumn(Scope::TrackStates, "params", states.m_params));
+  columns.push_back(makeColumn(Scope::TrackStates, "cov", states.m_cov));
+  columns.push_back(makeColumn(Scope::TrackStates, "meas", states.m_meas));
+  columns.push_back(
+      makeColumn(Scope::TrackStates, "measOffset", states.m_measOffset));
+  columns.push_back(
+      makeColumn(Scope::TrackStates, "measCov", states.m_measCov));
+  columns.push_back(
+      makeColumn(Scope::TrackStates, "measCovOffset", states.m_measCovOffset));
+  columns.push_back(makeColumn(Scope::TrackStates, "jac", states.m_jac));
+  columns.push_back(
+      makeColumn(Scope::TrackStates, "projectors", states.m_projectors));
+  columns.push_back(
+      makeColumn(Scope::TrackStates, "referenceSurface", stateSurfaces));
+
+  columns.push_back(makeColumn(Scope::Surfaces, "surfaces", surfaces));
+
+  addDynamicColumns(columns, Scope::DynamicTracks, tracks.m_dynamic);
+  addDynamicColumns(columns, Scope::DynamicTrackStates, states.m_dynamic);
+
+  FlatFileHeader header;
+  header.nTracks = tracks.size();
+  header.nTrackStates = states.m_index.size();
+  header.nColumns = columns.size();
+
+  std::size_t offset = alignUp(sizeof(FlatFileHeader) +
+                               columns.size() * sizeof(FlatColumnHeader));
+  for (auto& column : columns) {
+    column.header.offset = offset;
+    offset = alignUp(offset + column.header.count * column.header.elementSize);
+  }
+
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  std::size_t position = sizeof(header);
+  for (const auto& column : columns) {
+    os.write(reinterpret_cast<const char*>(&column.header),
+             sizeof(column.header));
+    position += sizeof(column.header);
+  }
+
+  const std::array<char, kAlignment> padding{};
+  for (const auto& column : columns) {
+    os.write(padding.data(),
+             static_cast<std::streamsize>(column.header.offset - position));
+    std::size_t size = column.header.count * column.header.elementSize;
+    os.write(static_cast<const char*>(column.data),
+             static_cast<std::streamsize>(size));
+    position = column.header.offset + size;
+  }
+
+  if (!os) {
+    throw std::runtime_error("Failed to write the flat track container");
+  }
+}
+
+detail::MappedFlatTrackFile::MappedFlatTrackFile(
+    const std::filesystem::path& path,
+    const TrackingGeometry* trackingGeometry) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Unable to open flat track container file " +
+                             path.string());
+  }
+
+  struct stat status{};
+  if (::fstat(fd, &status) != 0 ||
+      static_cast<std::size_t>(status.st_size) < sizeof(FlatFileHeader)) {
+    ::close(fd);
+    throw std::runtime_error("Invalid flat track container file " +
+                             path.string());
+  }
+  m_size = static_cast<std::size_t>(status.st_size);
+
+  void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping stays valid after closing the file
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Unable to map flat track container file " +
+                             path.string());
+  }
+  m_data = data;
+
+  try {
+    const auto* bytes = static_cast<const std::byte*>(m_data);
+    m_header = reinterpret_cast<const FlatFileHeader*>(bytes);
+    if (m_header->magic != FlatFileHeader::kMagic ||
+        m_header->version != FlatFileHeader::kVersion ||
+        m_header->byteOrder != FlatFileHeader::kByteOrder) {
+      throw std::runtime_error("Incompatible flat track container file " +
+                               path.string());
+    }
+
+    if (m_header->nColumns > (m_size - sizeof(FlatFileHeader)) /
+                                 sizeof(FlatColumnHeader)) {
+      throw std::runtime_error("Truncated flat track container file " +
+                               path.string());
+    }
+    m_columns = {reinterpret_cast<const FlatColumnHeader*>(
+                     bytes + sizeof(FlatFileHeader)),
+                 m_header->nColumns};
+
+    for (const auto& column : m_columns) {
+      if (column.offset % kAlignment != 0 || column.offset > m_size ||
+          (column.elementSize > 0 &&
+           column.count > (m_size - column.offset) / column.elementSize)) {
+        throw std::runtime_error("Truncated flat track container file " +
+                                 path.string());
+      }
+      bool perTrack =
+          column.scope == Scope::Tracks || column.scope == Scope::DynamicTracks;
+      if ((perTrack && column.count != m_header->nTracks) ||
+          (column.scope == Scope::DynamicTrackStates &&
+           column.count != m_header->nTrackStates)) {
+        throw std::runtime_error("Inconsistent column size in file " +
+                                 path.string());
+      }
+    }
+
+    const auto& table =
+        findColumn(Scope::Surfaces, hashStringDynamic("surfaces"),
+                   sizeof(FlatSurfaceEntry));
+    std::span<const FlatSurfaceEntry> entries{
+        reinterpret_cast<const FlatSurfaceEntry*>(bytes + table.offset),
+        table.count};
+    m_surfaces.reserve(entries.size());
+    for (const auto& entry : entries) {
+      if (entry.geometryId == 0) {
+        auto perigee = Surface::makeShared<PerigeeSurface>(
+            Vector3{entry.center[0], entry.center[1], entry.center[2]});
+        m_surfaces.push_back(perigee.get());
+        m_ownedSurfaces.push_back(std::move(perigee));
+        continue;
+      }
+      if (trackingGeometry == nullptr) {
+        m_surfaces.push_back(nullptr);
+        continue;
+      }
+      const Surface* surface =
+          trackingGeometry->findSurface(GeometryIdentifier{entry.geometryId});
+      if (surface == nullptr) {
+        throw std::runtime_error(
+            "Reference surface not found in the tracking geometry");
+      }
+      m_surfaces.push_back(surface);
+    }
+
+    validate(path);
+  } catch (...) {
+    ::munmap(m_data, m_size);
+    throw;
+  }
+}
+
+detail::MappedFlatTrackFile::~MappedFlatTrackFile() {
+  ::munmap(m_data, m_size);
+}
+
+const detail::FlatColumnHeader& detail::MappedFlatTrackFile::findColumn(
+    Scope scope, HashedString key, std::size_t elementSize) const {
+  auto it = std::ranges::find_if(m_columns, [&](const auto& column) {
+    return column.scope == scope && column.key == key;
+  });
+  if (it == m_columns.end()) {
+    throw std::runtime_error("Flat track container file misses a column");
+  }
+  if (it->elementSize != elementSize) {
+    throw std::runtime_error(
+        "Unexpected element size in flat track container file");
+  }
+  return *it;
+}
+
+const std::byte* detail::MappedFlatTrackFile::fixedColumn(
+    Scope scope, HashedString key, std::size_t elementSize) const {
+  const auto& column = findColumn(scope, key, elementSize);
+  return static_cast<const std::byte*>(m_data) + column.offset;
+}
+
+void detail::MappedFlatTrackFile::validate(
+    const std::filesystem::path& path) const {
+  using IndexType = TrackIndexType;
+  using IndexData = FlatTrackContainerAccess::IndexData;
+  using Coefficients = detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients;
+  using Covariance = detail_tsp::FixedSizeTypes<eBoundSize>::Covariance;
+
+  auto count = [&](Scope scope, std::string_view name,
+                   std::size_t elementSize) {
+    return findColumn(scope, hashStringDynamic(name), elementSize).count;
+  };
+  auto inRange = [](IndexType index, std::size_t size) {
+    return index == kTrackIndexInvalid || index < size;
+  };
+
+  const std::size_t nTracks = m_header->nTracks;
+  const std::size_t nStates = m_header->nTrackStates;
+
+  // the state columns are indexed by the state index, the others are pools
+  // referenced by the index data and the offsets
+  for (auto [name, elementSize] :
+       {std::pair<std::string_view, std::size_t>{"index", sizeof(IndexData)},
+        {"previous", sizeof(IndexType)},
+        {"next", sizeof(IndexType)},
+        {"measOffset", sizeof(IndexType)},
+        {"measCovOffset", sizeof(IndexType)},
+        {"referenceSurface", sizeof(IndexType)}}) {
+    if (count(Scope::TrackStates, name, elementSize) != nStates) {
+      throw std::runtime_error("Inconsistent column size in file " +
+                               path.string());
+    }
+  }
+  const std::size_t nParams =
+      std::min(count(Scope::TrackStates, "params", sizeof(Coefficients)),
+               count(Scope::TrackStates, "cov", sizeof(Covariance)));
+  const std::size_t nJac = count(Scope::TrackStates, "jac", sizeof(Covariance));
+  const std::size_t nProjectors = count(Scope::TrackStates, "projectors",
+                                        sizeof(SerializedSubspaceIndices));
+  const std::size_t nMeas = count(Scope::TrackStates, "meas", sizeof(double));
+  const std::size_t nMeasCov =
+      count(Scope::TrackStates, "measCov", sizeof(double));
+
+  const auto* tipIndex = column<IndexType>(Scope::Tracks, "tipIndex");
+  const auto* stemIndex = column<IndexType>(Scope::Tracks, "stemIndex");
+  const auto* trackSurfaces =
+      column<IndexType>(Scope::Tracks, "referenceSurface");
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    if (!inRange(tipIndex[i], nStates) || !inRange(stemIndex[i], nStates) ||
+        !inRange(trackSurfaces[i], m_surfaces.size())) {
+      throw std::runtime_error("Invalid track index in file " + path.string());
+    }
+  }
+
+  const auto* index = column<IndexData>(Scope::TrackStates, "index");
+  const auto* previous = column<IndexType>(Scope::TrackStates, "previous");
+  const auto* next = column<IndexType>(Scope::TrackStates, "next");
+  const auto* measOffset = column<IndexType>(Scope::TrackStates, "measOffset");
+  const auto* measCovOffset =
+      column<IndexType>(Scope::TrackStates, "measCovOffset");
+  const auto* stateSurfaces =
+      column<IndexType>(Scope::TrackStates, "referenceSurface");
+  for (std::size_t i = 0; i < nStates; ++i) {
+    const IndexData& data = index[i];
+    bool valid = inRange(previous[i], nStates) && inRange(next[i], nStates) &&
+                 inRange(stateSurfaces[i], m_surfaces.size()) &&
+                 inRange(data.ipredicted, nParams) &&
+                 inRange(data.ifiltered, nParams) &&
+                 inRange(data.ismoothed, nParams) &&
+                 inRange(data.ijacobian, nJac) &&
+                 inRange(data.iprojector, nProjectors);
+    // the calibrated measurement spans measdim entries from its offset
+    if (valid && measOffset[i] != kTrackIndexInvalid) {
+      std::size_t measdim = data.measdim;
+      valid = measdim <= eBoundSize && measOffset[i] + measdim <= nMeas &&
+              measCovOffset[i] != kTrackIndexInvalid &&
+              measCovOffset[i] + measdim * measdim <= nMeasCov;
+    }
+    if (!valid) {
+      throw std::runtime_error("Invalid track state index in file " +
+                               path.string());
+    }
+  }
+
+  // dynamic columns are read as the type of their tag
+  for (const auto& column : m_columns) {
+    if ((column.scope == Scope::DynamicTracks ||
+         column.scope == Scope::DynamicTrackStates) &&
+        column.elementSize != dynamicElementSize(column.type)) {
+      throw std::runtime_error("Invalid dynamic column type in file " +
+                               path.string());
+    }
+  }
+}
+
+std::vector<detail::FlatDynamicColumn>
+detail::MappedFlatTrackFile::dynamicColumns(Scope scope) const {
+  std::vector<FlatDynamicColumn> columns;
+  for (const auto& column : m_columns) {
+    if (column.scope != scope) {
+      continue;
+    }
+    FlatDynamicColumn& dynamic = columns.emplace_back();
+    dynamic.key = static_cast<HashedString>(column.key);
+    dynamic.type = column.type;
+    dynamic.data = static_cast<const std::byte*>(m_data) + column.offset;
+  }
+  return columns;
+}
+
+MappedMultiTrajectory::MappedMultiTrajectory(
+    std::shared_ptr<const detail::MappedFlatTrackFile> file)
+    : m_file{std::move(file)} {
+  m_size = static_cast<IndexType>(m_file->nTrackStates());
+  m_index = m_file->column<IndexData>(Scope::TrackStates, "index");
+  m_previous = m_file->column<IndexType>(Scope::TrackStates, "previous");
+  m_next = m_file->column<IndexType>(Scope::TrackStates, "next");
+  m_params = m_file->column<Coefficients>(Scope::TrackStates, "params");
+  m_cov = m_file->column<Covariance>(Scope::TrackStates, "cov");
+  m_meas = m_file->column<double>(Scope::TrackStates, "meas");
+  m_measOffset = m_file->column<IndexType>(Scope::TrackStates, "measOffset");
+  m_measCov = m_file->column<double>(Scope::TrackStates, "measCov");
+  m_measCovOffset =
+      m_file->column<IndexType>(Scope::TrackStates, "measCovOffset");
+  m_jac = m_file->column<Covariance>(Scope::TrackStates, "jac");
+  m_projectors =
+      m_file->column<SerializedSubspaceIndices>(Scope::TrackStates,
+                                                "projectors");
+  m_surfaces =
+      m_file->column<IndexType>(Scope::TrackStates, "referenceSurface");
+
+  m_dynamic = m_file->dynamicColumns(Scope::DynamicTrackStates);
+  for (const auto& column : m_dynamic) {
+    m_dynamicKeys.push_back(column.key);
+  }
+}
+
+bool MappedMultiTrajectory::has_impl(HashedString key,
+                                     IndexType istate) const {
+  using namespace Acts::HashedStringLiteral;
+  switch (key) {
+    case "predicted"_hash:
+      return m_index[istate].ipredicted != kInvalid;
+    case "filtered"_hash:
+      return m_index[istate].ifiltered != kInvalid;
+    case "smoothed"_hash:
+      return m_index[istate].ismoothed != kInvalid;
+    case "calibrated"_hash:
+      return m_measOffset[istate] != kInvalid;
+    case "calibratedCov"_hash:
+      return m_measCovOffset[istate] != kInvalid;
+    case "jacobian"_hash:
+      return m_index[istate].ijacobian != kInvalid;
+    case "projector"_hash:
+      return m_index[istate].iprojector != kInvalid;
+    case "uncalibratedSourceLink"_hash:
+      return false;
+    case "previous"_hash:
+    case "next"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return hasColumn_impl(key);
+  }
+}
+
+std::any MappedMultiTrajectory::component_impl(HashedString key,
+                                               IndexType istate) const {
+  using namespace Acts::HashedStringLiteral;
+  switch (key) {
+    case "previous"_hash:
+      return &m_previous[istate];
+    case "next"_hash:
+      return &m_next[istate];
+    case "predicted"_hash:
+      return &m_index[istate].ipredicted;
+    case "filtered"_hash:
+      return &m_index[istate].ifiltered;
+    case "smoothed"_hash:
+      return &m_index[istate].ismoothed;
+    case "projector"_hash:
+      return &m_projectors[m_index[istate].iprojector];
+    case "measdim"_hash:
+      return &m_index[istate].measdim;
+    case "chi2"_hash:
+      return &m_index[istate].chi2;
+    case "pathLength"_hash:
+      return &m_index[istate].pathLength;
+    case "typeFlags"_hash:
+      return &m_index[istate].typeFlags;
+    default:
+      auto it =
+          std::ranges::find(m_dynamic, key, &detail::FlatDynamicColumn::key);
+      if (it == m_dynamic.end()) {
+        throw std::runtime_error("Unable to handle this component");
+      }
+      return it->get(istate);
+  }
+}
+
+bool MappedMultiTrajectory::hasColumn_impl(HashedString key) const {
+  using namespace Acts::HashedStringLiteral;
+  switch (key) {
+    case "predicted"_hash:
+    case "filtered"_hash:
+    case "smoothed"_hash:
+    case "calibrated"_hash:
+    case "calibratedCov"_hash:
+    case "jacobian"_hash:
+    case "projector"_hash:
+    case "previous"_hash:
+    case "next"_hash:
+    case "referenceSurface"_hash:
+    case "measdim"_hash:
+    case "chi2"_hash:
+    case "pathLength"_hash:
+    case "typeFlags"_hash:
+      return true;
+    default:
+      return std::ranges::find(m_dynamicKeys, key) != m_dynamicKeys.end();
+  }
+}
+
+MappedTrackContainer::MappedTrackContainer(
+    std::shared_ptr<const detail::MappedFlatTrackFile> file)
+    : m_file{std::move(file)} {
+  m_size = m_file->nTracks();
+  m_tipIndex = m_file->column<IndexType>(Scope::Tracks, "tipIndex");
+  m_stemIndex = m_file->column<IndexType>(Scope::Tracks, "stemIndex");
+  m_particleHypothesis =
+      m_file->column<ParticleHypothesis>(Scope::Tracks, "particleHypothesis");
+  m_params = m_file->column<Coefficients>(Scope::Tracks, "params");
+  m_cov = m_file->column<Covariance>(Scope::Tracks, "cov");
+  m_surfaces = m_file->column<IndexType>(Scope::Tracks, "referenceSurface");
+  m_nMeasurements =
+      m_file->column<unsigned int>(Scope::Tracks, "nMeasurements");
+  m_nHoles = m_file->column<unsigned int>(Scope::Tracks, "nHoles");
+  m_chi2 = m_file->column<float>(Scope::Tracks, "chi2");
+  m_ndf = m_file->column<unsigned int>(Scope::Tracks, "ndf");
+  m_nOutliers = m_file->column<unsigned int>(Scope::Tracks, "nOutliers");
+  m_nSharedHits = m_file->column<unsigned int>(Scope::Tracks, "nSharedHits");
+
+  m_dynamic = m_file->dynamicColumns(Scope::DynamicTracks);
+  for (const auto& column : m_dynamic) {
+    m_dynamicKeys.push_back(column.key);
+  }
+}
+
+std::any MappedTrackContainer::component_impl(HashedString key,
+                                              IndexType itrack) const {
+  using namespace Acts::HashedStringLiteral;
+  switch (key) {
+    case "tipIndex"_hash:
+      return &m_tipIndex[itrack];
+    case "stemIndex"_hash:
+      return &m_stemIndex[itrack];
+    case "params"_hash:
+      return &m_params[itrack];
+    case "cov"_hash:
+      return &m_cov[itrack];
+    case "nMeasurements"_hash:
+      return &m_nMeasurements[itrack];
+    case "nHoles"_hash:
+      return &m_nHoles[itrack];
+    case "chi2"_hash:
+      return &m_chi2[itrack];
+    case "ndf"_hash:
+      return &m_ndf[itrack];
+    case "nOutliers"_hash:
+      return &m_nOutliers[itrack];
+    case "nSharedHits"_hash:
+      return &m_nSharedHits[itrack];
+    default:
+      auto it =
+          std::ranges::find(m_dynamic, key, &detail::FlatDynamicColumn::key);
+      if (it == m_dynamic.end()) {
+        throw std::runtime_error("Unable to handle this component");
+      }
+      return it->get(itrack);
+  }
+}
+
+bool MappedTrackContainer::hasColumn_impl(HashedString key) const {
+  using namespace Acts::HashedStringLiteral;
+  switch (key) {
+    case "tipIndex"_hash:
+    case "stemIndex"_hash:
+    case "params"_hash:
+    case "cov"_hash:
+    case "nMeasurements"_hash:
+    case "nHoles"_hash:
+    case "chi2"_hash:
+    case "ndf"_hash:
+    case "nOutliers"_hash:
+    case "nSharedHits"_hash:
+      return true;
+    default:
+      return std::ranges::find(m_dynamicKeys, key) != m_dynamicKeys.end();
+  }
+}
+
+void writeFlatTrackContainer(std::ostream& os, const GeometryContext& gctx,
+                             const VectorTrackContainer& tracks,
+                             const VectorMultiTrajectory& trackStates,
+                             bool dropSourceLinks) {
+  detail::FlatTrackContainerAccess::write(os, gctx, tracks, trackStates,
+                                          dropSourceLinks);
+}
+
+MappedFlatTrackContainer mapFlatTrackContainer(
+    const std::filesystem::path& path,
+    const TrackingGeometry* trackingGeometry) {
+  auto file = std::make_shared<const detail::MappedFlatTrackFile>(
+      path, trackingGeometry);
+  return MappedFlatTrackContainer{
+      std::make_shared<MappedTrackContainer>(file),
+      std::make_shared<MappedMultiTrajectory>(file)};
+}
+
+}  // namespace Acts
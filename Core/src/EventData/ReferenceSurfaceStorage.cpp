@@ -0,0 +1,26 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/ReferenceSurfaceStorage.hpp"
+
+#include "Acts/Surfaces/Surface.hpp"
+
+namespace Acts {
+
+std::shared_ptr<const Surface> detail::storedReferenceSurface(
+    std::shared_ptr<const Surface> surface, const TrackingGeometry* geometry) {
+  if (geometry == nullptr || surface == nullptr ||
+      surface->trackingGeometry() != geometry) {
+    return surface;
+  }
+  // aliasing an empty pointer keeps the address without a control block
+  return std::shared_ptr<const Surface>(std::shared_ptr<const Surface>{},
+                                        surface.get());
+}
+
+}  // namespace Acts
@@ -8,8 +8,16 @@
 
 #include "Acts/EventData/SpacePointContainer2.hpp"
 
+#include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <numeric>
 #include <string_view>
 #include <unordered_set>
 
@@ -19,8 +27,65 @@ template <typename Tuple>
 using tuple_indices =
     std::make_index_sequence<std::tuple_size_v<std::remove_reference_t<Tuple>>>;
 
+// The bulk kernels below work on contiguous arrays so that the compiler, or
+// Eigen for the square root, can vectorize them.
+
+void computeR(std::span<const float> x, std::span<const float> y,
+              std::span<float> r) noexcept {
+  using Array = Eigen::Array<float, Eigen::Dynamic, 1>;
+  const auto n = static_cast<Eigen::Index>(r.size());
+  Eigen::Map<const Array> xs(x.data(), n);
+  Eigen::Map<const Array> ys(y.data(), n);
+  Eigen::Map<Array>(r.data(), n) = (xs.square() + ys.square()).sqrt();
 }
 
+// Eigen has no vectorized atan2, so the angle is approximated on the first
+// octant with the polynomial of Abramowitz & Stegun 4.4.49, accurate to about
+// 2e-7 in single precision, and the octant is restored with integer masks.
+// Unlike with comparisons, the compiler can then vectorize the loop.
+void computePhi(std::span<const float> x, std::span<const float> y,
+                std::span<float> phi) noexcept {
+  constexpr float pi = std::numbers::pi_v<float>;
+  for (std::size_t i = 0; i < phi.size(); ++i) {
+    const std::uint32_t sx = std::bit_cast<std::uint32_t>(x[i]);
+    // the magnitude bits order like the magnitudes
+    const std::uint32_t bx = sx & 0x7fffffffu;
+    const std::uint32_t by = std::bit_cast<std::uint32_t>(y[i]) & 0x7fffffffu;
+    const std::uint32_t swap = (bx - by) >> 31;
+    const std::uint32_t mask = 0u - swap;
+    const float lo = std::bit_cast<float>((bx & mask) | (by & ~mask));
+    const float hi = std::bit_cast<float>((by & mask) | (bx & ~mask));
+    const float a = lo / (hi + std::numeric_limits<float>::min());
+    const float s = a * a;
+    float angle = 0.0028662257f;
+    angle = angle * s - 0.0161657367f;
+    angle = angle * s + 0.0429096138f;
+    angle = angle * s - 0.0752896400f;
+    angle = angle * s + 0.1065626393f;
+    angle = angle * s - 0.1420889944f;
+    angle = angle * s + 0.1999355085f;
+    angle = angle * s - 0.3333314528f;
+    angle = a + a * s * angle;
+    const auto swapped = static_cast<float>(swap);
+    angle = swapped * (pi / 2 - angle) + (1.f - swapped) * angle;
+    const auto negative = static_cast<float>(sx >> 31);
+    angle = negative * (pi - angle) + (1.f - negative) * angle;
+    phi[i] = std::copysign(angle, y[i]);
+  }
+}
+
+template <std::size_t N>
+void pack(std::span<std::array<float, N>> packed,
+          const std::array<std::span<const float>, N> &inputs) noexcept {
+  for (std::size_t j = 0; j < N; ++j) {
+    for (std::size_t i = 0; i < packed.size(); ++i) {
+      packed[i][j] = inputs[j][i];
+    }
+  }
+}
+
+}  // namespace
+
 namespace Acts {
 
 static_assert(std::ranges::random_access_range<SpacePointContainer2>);
@@ -33,19 +98,31 @@ static_assert(
 static_assert(
     std::ranges::random_access_range<SpacePointContainer2::ConstSubset>);
 
-SpacePointContainer2::SpacePointContainer2(SpacePointColumns columns) noexcept {
+SpacePointContainer2::SpacePointContainer2(
+    SpacePointColumns columns,
+    std::pmr::memory_resource *memoryResource) noexcept
+    : m_memoryResource(memoryResource), m_sourceLinks(memoryResource) {
   createColumns(columns);
 }
 
 SpacePointContainer2::SpacePointContainer2(
     const SpacePointContainer2 &other) noexcept
-    : m_size(other.m_size), m_sourceLinks(other.m_sourceLinks) {
+    : SpacePointContainer2(other, std::pmr::get_default_resource()) {}
+
+SpacePointContainer2::SpacePointContainer2(
+    const SpacePointContainer2 &other,
+    std::pmr::memory_resource *memoryResource) noexcept
+    : m_memoryResource(memoryResource),
+      m_size(other.m_size),
+      m_sourceLinks(other.m_sourceLinks, memoryResource) {
   copyColumns(other);
 }
 
 SpacePointContainer2::SpacePointContainer2(
     SpacePointContainer2 &&other) noexcept
-    : m_size(other.m_size), m_sourceLinks(std::move(other.m_sourceLinks)) {
+    : m_memoryResource(other.m_memoryResource),
+      m_size(other.m_size),
+      m_sourceLinks(std::move(other.m_sourceLinks)) {
   moveColumns(other);
 
   other.m_size = 0;
@@ -70,6 +147,13 @@ SpacePointContainer2 &SpacePointContainer2::operator=(
     return *this;
   }
 
+  // Columns allocated from a different memory resource can not be adopted
+  if (m_memoryResource != other.m_memoryResource) {
+    *this = other;
+    other.clear();
+    return *this;
+  }
+
   moveColumns(other);
   m_sourceLinks = std::move(other.m_sourceLinks);
   m_size = other.m_size;
@@ -87,9 +171,11 @@ void SpacePointContainer2::copyColumns(const SpacePointContainer2 &other) {
       [&]<typename T>(std::string_view name,
                       std::optional<ColumnHolder<T>> &column,
                       const std::optional<ColumnHolder<T>> &otherColumn) {
-        column = otherColumn;
-        if (column.has_value()) {
+        if (otherColumn.has_value()) {
+          column.emplace(*otherColumn, m_memoryResource);
           m_allColumns.try_emplace(std::string(name), &column.value());
+        } else {
+          column.reset();
         }
       };
 
@@ -102,7 +188,8 @@ void SpacePointContainer2::copyColumns(const SpacePointContainer2 &other) {
   m_knownColumns = other.m_knownColumns;
 
   for (auto &[name, column] : other.m_dynamicColumns) {
-    std::unique_ptr<ColumnHolderBase> columnCopy = column->copy();
+    std::unique_ptr<ColumnHolderBase> columnCopy =
+        column->copy(m_memoryResource);
     m_allColumns.try_emplace(name, columnCopy.get());
     m_dynamicColumns.try_emplace(name, std::move(columnCopy));
   }
@@ -171,6 +258,234 @@ MutableSpacePointProxy2 SpacePointContainer2::createSpacePoint() noexcept {
   return MutableProxy(*this, size() - 1);
 }
 
+SpacePointContainer2::IndexRange SpacePointContainer2::createSpacePoints(
+    std::uint32_t count, const ConstSpacePointColumnSpans2 &columns) {
+  using enum SpacePointColumns;
+
+  const auto checkInput = [&](std::size_t inputSize, std::string_view name,
+                              SpacePointColumns consumers) {
+    if (inputSize == 0) {
+      return;
+    }
+    if (inputSize != count) {
+      throw std::invalid_argument(
+          "Size of column '" + std::string(name) +
+          "' does not match the number of space points in "
+          "SpacePointContainer2::createSpacePoints");
+    }
+    if ((m_knownColumns & consumers) == None) {
+      throw std::logic_error("No column available for input '" +
+                             std::string(name) + "'");
+    }
+  };
+
+  const SpacePointColumns xyConsumers =
+      X | Y | R | Phi | PackedXY | PackedXYZ | PackedXYZR;
+  checkInput(columns.x.size(), "x", xyConsumers);
+  checkInput(columns.y.size(), "y", xyConsumers);
+  checkInput(columns.z.size(), "z", Z | PackedZR | PackedXYZ | PackedXYZR);
+  checkInput(columns.r.size(), "r", R | PackedZR | PackedXYZR);
+  checkInput(columns.phi.size(), "phi", Phi);
+  checkInput(columns.time.size(), "time", Time);
+  checkInput(columns.varianceZ.size(), "varianceZ",
+             VarianceZ | PackedVarianceZR);
+  checkInput(columns.varianceR.size(), "varianceR",
+             VarianceR | PackedVarianceZR);
+  checkInput(columns.sourceLinkCounts.size(), "sourceLinkCounts",
+             SourceLinks);
+
+  const bool hasSourceLinks =
+      !columns.sourceLinks.empty() || !columns.sourceLinkCounts.empty();
+  if (hasSourceLinks) {
+    if (!hasColumns(SourceLinks)) {
+      throw std::logic_error("No source links column available");
+    }
+    const std::size_t expected =
+        columns.sourceLinkCounts.empty()
+            ? count
+            : std::accumulate(columns.sourceLinkCounts.begin(),
+                              columns.sourceLinkCounts.end(), std::size_t{0});
+    if (columns.sourceLinks.size() != expected) {
+      throw std::invalid_argument(
+          "Number of source links does not match the source link counts in "
+          "SpacePointContainer2::createSpacePoints");
+    }
+  }
+
+  const Index first = size();
+  m_size += count;
+  for (const auto &[name, column] : m_allColumns) {
+    column->resize(size());
+  }
+
+  const auto tail = [&]<typename T>(std::optional<ColumnHolder<T>> &column) {
+    return column->proxy(*this).data().subspan(first);
+  };
+  const auto fill = [&](std::optional<ColumnHolder<float>> &column,
+                        std::span<const float> input) {
+    if (column.has_value() && !input.empty()) {
+      std::ranges::copy(input, tail(column).begin());
+    }
+  };
+
+  fill(m_xColumn, columns.x);
+  fill(m_yColumn, columns.y);
+  fill(m_zColumn, columns.z);
+  fill(m_timeColumn, columns.time);
+  fill(m_varianceZColumn, columns.varianceZ);
+  fill(m_varianceRColumn, columns.varianceR);
+
+  const bool hasXY = !columns.x.empty() && !columns.y.empty();
+
+  // derive r and phi directly into their columns if possible and into a
+  // scratch buffer if only the packed columns need them
+  std::span<const float> r = columns.r;
+  std::pmr::vector<float> rBuffer(m_memoryResource);
+  if (!r.empty()) {
+    fill(m_rColumn, r);
+  } else if (hasXY && m_rColumn.has_value()) {
+    computeR(columns.x, columns.y, tail(m_rColumn));
+    r = tail(m_rColumn);
+  } else if (hasXY && (hasColumns(PackedZR) || hasColumns(PackedXYZR))) {
+    rBuffer.resize(count);
+    computeR(columns.x, columns.y, rBuffer);
+    r = rBuffer;
+  }
+
+  if (!columns.phi.empty()) {
+    fill(m_phiColumn, columns.phi);
+  } else if (hasXY && m_phiColumn.has_value()) {
+    computePhi(columns.x, columns.y, tail(m_phiColumn));
+  }
+
+  if (hasXY && m_xyColumn.has_value()) {
+    pack<2>(tail(m_xyColumn), {columns.x, columns.y});
+  }
+  if (!columns.z.empty() && !r.empty() && m_zrColumn.has_value()) {
+    pack<2>(tail(m_zrColumn), {columns.z, r});
+  }
+  if (hasXY && !columns.z.empty() && m_xyzColumn.has_value()) {
+    pack<3>(tail(m_xyzColumn), {columns.x, columns.y, columns.z});
+  }
+  if (hasXY && !columns.z.empty() && !r.empty() && m_xyzrColumn.has_value()) {
+    pack<4>(tail(m_xyzrColumn), {columns.x, columns.y, columns.z, r});
+  }
+  if (!columns.varianceZ.empty() && !columns.varianceR.empty() &&
+      m_varianceZRColumn.has_value()) {
+    pack<2>(tail(m_varianceZRColumn), {columns.varianceZ, columns.varianceR});
+  }
+
+  if (hasSourceLinks) {
+    auto offsets = tail(m_sourceLinkOffsetColumn);
+    auto counts = tail(m_sourceLinkCountColumn);
+    if (columns.sourceLinkCounts.empty()) {
+      std::ranges::fill(counts, std::uint8_t{1});
+    } else {
+      std::ranges::copy(columns.sourceLinkCounts, counts.begin());
+    }
+    std::uint32_t offset = static_cast<std::uint32_t>(m_sourceLinks.size());
+    for (std::size_t i = 0; i < count; ++i) {
+      offsets[i] = offset;
+      offset += counts[i];
+    }
+    m_sourceLinks.insert(m_sourceLinks.end(), columns.sourceLinks.begin(),
+                         columns.sourceLinks.end());
+  }
+
+  return {first, size()};
+}
+
+std::size_t SpacePointContainer2::exportSpacePoints(
+    const IndexRange &range,
+    const MutableSpacePointColumnSpans2 &columns) const {
+  if (range.first > range.second || range.second > size()) {
+    throw std::out_of_range(
+        "Index range out of range in SpacePointContainer2::exportSpacePoints");
+  }
+  const std::size_t count = range.second - range.first;
+
+  const auto checkOutput = [&](std::size_t outputSize, std::string_view name,
+                               bool available) {
+    if (outputSize == 0) {
+      return;
+    }
+    if (outputSize != count) {
+      throw std::invalid_argument(
+          "Size of column '" + std::string(name) +
+          "' does not match the number of space points in "
+          "SpacePointContainer2::exportSpacePoints");
+    }
+    if (!available) {
+      throw std::logic_error("Column '" + std::string(name) +
+                             "' does not exist");
+    }
+  };
+
+  checkOutput(columns.x.size(), "x", m_xColumn.has_value());
+  checkOutput(columns.y.size(), "y", m_yColumn.has_value());
+  checkOutput(columns.z.size(), "z", m_zColumn.has_value());
+  checkOutput(columns.r.size(), "r", m_rColumn.has_value());
+  checkOutput(columns.phi.size(), "phi", m_phiColumn.has_value());
+  checkOutput(columns.time.size(), "time", m_timeColumn.has_value());
+  checkOutput(columns.varianceZ.size(), "varianceZ",
+              m_varianceZColumn.has_value());
+  checkOutput(columns.varianceR.size(), "varianceR",
+              m_varianceRColumn.has_value());
+  checkOutput(columns.sourceLinkCounts.size(), "sourceLinkCounts",
+              hasColumns(SpacePointColumns::SourceLinks));
+
+  const auto copy = [&](const std::optional<ColumnHolder<float>> &column,
+                        std::span<float> output) {
+    if (!output.empty()) {
+      std::ranges::copy(
+          column->proxy(*this).data().subspan(range.first, count),
+          output.begin());
+    }
+  };
+
+  copy(m_xColumn, columns.x);
+  copy(m_yColumn, columns.y);
+  copy(m_zColumn, columns.z);
+  copy(m_rColumn, columns.r);
+  copy(m_phiColumn, columns.phi);
+  copy(m_timeColumn, columns.time);
+  copy(m_varianceZColumn, columns.varianceZ);
+  copy(m_varianceRColumn, columns.varianceR);
+
+  if (!columns.sourceLinkCounts.empty()) {
+    std::ranges::copy(
+        m_sourceLinkCountColumn->proxy(*this).data().subspan(range.first,
+                                                              count),
+        columns.sourceLinkCounts.begin());
+  }
+
+  if (columns.sourceLinks.empty()) {
+    return 0;
+  }
+  if (!hasColumns(SpacePointColumns::SourceLinks)) {
+    throw std::logic_error("No source links column available");
+  }
+
+  // source links of consecutive space points are not necessarily contiguous
+  // so they are gathered per space point
+  const auto offsets =
+      m_sourceLinkOffsetColumn->proxy(*this).data().subspan(range.first, count);
+  const auto counts =
+      m_sourceLinkCountColumn->proxy(*this).data().subspan(range.first, count);
+  const std::size_t nSourceLinks =
+      std::accumulate(counts.begin(), counts.end(), std::size_t{0});
+  if (columns.sourceLinks.size() < nSourceLinks) {
+    throw std::invalid_argument(
+        "Source links span too small in "
+        "SpacePointContainer2::exportSpacePoints");
+  }
+  auto output = columns.sourceLinks.begin();
+  for (std::size_t i = 0; i < count; ++i) {
+    output = std::copy_n(m_sourceLinks.begin() + offsets[i], counts[i], output);
+  }
+  return nSourceLinks;
+}
+
 void SpacePointContainer2::copyFrom(Index index,
                                     const SpacePointContainer2 &otherContainer,
                                     Index otherIndex,
@@ -224,7 +539,7 @@ void SpacePointContainer2::createColumns(SpacePointColumns columns) noexcept {
       [&]<typename T>(SpacePointColumns mask, std::string_view name,
                       T defaultValue, std::optional<ColumnHolder<T>> &column) {
         if (ACTS_CHECK_BIT(columns, mask) && !column.has_value()) {
-          column = ColumnHolder<T>(std::move(defaultValue));
+          column.emplace(std::move(defaultValue), m_memoryResource);
           column->resize(size());
           m_allColumns.try_emplace(std::string(name), &column.value());
           m_knownColumns = m_knownColumns | mask;
@@ -10,11 +10,14 @@
 
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <format>
 #include <ostream>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 #include <boost/histogram.hpp>
 #include <boost/histogram/axis/category.hpp>
@@ -274,6 +277,19 @@ void detail_vmt::VectorMultiTrajectoryBase::Statistics::toStream(
   }
 }
 
+void detail_vmt::VectorMultiTrajectoryBase::copyReferenceSurface(
+    IndexType istate, const VectorMultiTrajectoryBase& src, IndexType srcIdx) {
+  const auto& surface = src.m_referenceSurfaces[srcIdx];
+  if (surface == nullptr ||
+      src.m_referenceSurfaceGeometry == m_referenceSurfaceGeometry) {
+    m_referenceSurfaces[istate] = surface;
+  } else {
+    // the source might not own the surface
+    m_referenceSurfaces[istate] = detail::storedReferenceSurface(
+        surface->getSharedPtr(), m_referenceSurfaceGeometry.get());
+  }
+}
+
 void VectorMultiTrajectory::reserve(std::size_t n) {
   m_index.reserve(n);
   m_previous.reserve(n);
@@ -294,6 +310,140 @@ void VectorMultiTrajectory::reserve(std::size_t n) {
   }
 }
 
+void VectorMultiTrajectory::setReferenceSurfaceStorage(
+    ReferenceSurfaceStorage storage,
+    std::shared_ptr<const TrackingGeometry> geometry) {
+  if (size_impl() != 0) {
+    throw std::logic_error(
+        "Reference surface storage can only be set without track states");
+  }
+  if (storage == ReferenceSurfaceStorage::NonOwningGeometry &&
+      geometry == nullptr) {
+    throw std::invalid_argument(
+        "Non-owning reference surface storage requires a tracking geometry");
+  }
+  m_referenceSurfaceGeometry =
+      storage == ReferenceSurfaceStorage::Shared ? nullptr : std::move(geometry);
+}
+
+std::vector<VectorMultiTrajectory::IndexType> VectorMultiTrajectory::compact(
+    std::span<const IndexType> states) {
+  std::vector<IndexType> stateRemap(m_index.size(), kInvalid);
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    assert(states[i] < m_index.size() && "Track state out of bounds");
+    assert(stateRemap[states[i]] == kInvalid && "Track state kept twice");
+    stateRemap[states[i]] = static_cast<IndexType>(i);
+  }
+
+  // pooled components are remapped on first use, which keeps shared
+  // components shared
+  auto makePoolRemap = [](std::size_t size) {
+    return std::vector<IndexType>(size, kInvalid);
+  };
+  auto remapPooled = [](IndexType& index, std::vector<IndexType>& remap,
+                        auto& source, auto& target) {
+    if (index == kInvalid) {
+      return;
+    }
+    if (remap[index] == kInvalid) {
+      remap[index] = static_cast<IndexType>(target.size());
+      target.push_back(std::move(source[index]));
+    }
+    index = remap[index];
+  };
+  auto remapLink = [&](IndexType index) {
+    return index == kInvalid ? kInvalid : stateRemap[index];
+  };
+
+  std::vector<IndexType> paramsRemap = makePoolRemap(m_params.size());
+  std::vector<IndexType> jacRemap = makePoolRemap(m_jac.size());
+  std::vector<IndexType> sourceLinkRemap = makePoolRemap(m_sourceLinks.size());
+  std::vector<IndexType> projectorRemap = makePoolRemap(m_projectors.size());
+
+  decltype(m_index) index(m_index.get_allocator());
+  decltype(m_previous) previous(m_previous.get_allocator());
+  decltype(m_next) next(m_next.get_allocator());
+  decltype(m_params) params(m_params.get_allocator());
+  decltype(m_cov) cov(m_cov.get_allocator());
+  decltype(m_meas) meas(m_meas.get_allocator());
+  decltype(m_measOffset) measOffset(m_measOffset.get_allocator());
+  decltype(m_measCov) measCov(m_measCov.get_allocator());
+  decltype(m_measCovOffset) measCovOffset(m_measCovOffset.get_allocator());
+  decltype(m_jac) jac(m_jac.get_allocator());
+  decltype(m_sourceLinks) sourceLinks(m_sourceLinks.get_allocator());
+  decltype(m_projectors) projectors(m_projectors.get_allocator());
+  decltype(m_referenceSurfaces) referenceSurfaces(
+      m_referenceSurfaces.get_allocator());
+
+  index.reserve(states.size());
+  previous.reserve(states.size());
+  next.reserve(states.size());
+  measOffset.reserve(states.size());
+  measCovOffset.reserve(states.size());
+  sourceLinks.reserve(states.size());
+  referenceSurfaces.reserve(states.size());
+
+  for (IndexType istate : states) {
+    IndexData& data = index.emplace_back(m_index[istate]);
+
+    // parameters and covariances share their index
+    for (IndexType* iparams :
+         {&data.ipredicted, &data.ifiltered, &data.ismoothed}) {
+      if (*iparams != kInvalid && paramsRemap[*iparams] == kInvalid) {
+        cov.push_back(m_cov[*iparams]);
+      }
+      remapPooled(*iparams, paramsRemap, m_params, params);
+    }
+    remapPooled(data.ijacobian, jacRemap, m_jac, jac);
+    remapPooled(data.iUncalibrated, sourceLinkRemap, m_sourceLinks,
+                sourceLinks);
+    remapPooled(data.iCalibratedSourceLink, sourceLinkRemap, m_sourceLinks,
+                sourceLinks);
+    remapPooled(data.iprojector, projectorRemap, m_projectors, projectors);
+
+    previous.push_back(remapLink(m_previous[istate]));
+    next.push_back(remapLink(m_next[istate]));
+
+    if (m_measOffset[istate] != kInvalid) {
+      measOffset.push_back(static_cast<IndexType>(meas.size()));
+      meas.insert(meas.end(), m_meas.begin() + m_measOffset[istate],
+                  m_meas.begin() + m_measOffset[istate] + data.measdim);
+    } else {
+      measOffset.push_back(kInvalid);
+    }
+    if (m_measCovOffset[istate] != kInvalid) {
+      measCovOffset.push_back(static_cast<IndexType>(measCov.size()));
+      measCov.insert(measCov.end(), m_measCov.begin() + m_measCovOffset[istate],
+                     m_measCov.begin() + m_measCovOffset[istate] +
+                         data.measdim * data.measdim);
+    } else {
+      measCovOffset.push_back(kInvalid);
+    }
+
+    referenceSurfaces.push_back(std::move(m_referenceSurfaces[istate]));
+  }
+
+  m_index = std::move(index);
+  m_previous = std::move(previous);
+  m_next = std::move(next);
+  m_params = std::move(params);
+  m_cov = std::move(cov);
+  m_meas = std::move(meas);
+  m_measOffset = std::move(measOffset);
+  m_measCov = std::move(measCov);
+  m_measCovOffset = std::move(measCovOffset);
+  m_jac = std::move(jac);
+  m_sourceLinks = std::move(sourceLinks);
+  m_projectors = std::move(projectors);
+  m_referenceSurfaces = std::move(referenceSurfaces);
+
+  for (const auto& [key, vec] : m_dynamic) {
+    vec->gather(states);
+  }
+
+  return stateRemap;
+}
+
 void VectorMultiTrajectory::copyDynamicFrom_impl(IndexType dstIdx,
                                                  HashedString key,
                                                  const std::any& srcPtr) {
@@ -9,9 +9,12 @@
 #include "Acts/EventData/VectorTrackContainer.hpp"
 
 #include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/HashedString.hpp"
 
 #include <iterator>
+#include <stdexcept>
+#include <utility>
 
 namespace Acts {
 
@@ -25,6 +28,7 @@ VectorTrackContainerBase::VectorTrackContainerBase(
       m_params{other.m_params},
       m_cov{other.m_cov},
       m_referenceSurfaces{other.m_referenceSurfaces},
+      m_referenceSurfaceGeometry{other.m_referenceSurfaceGeometry},
       m_nMeasurements{other.m_nMeasurements},
       m_nHoles{other.m_nHoles},
       m_chi2{other.m_chi2},
@@ -37,6 +41,19 @@ VectorTrackContainerBase::VectorTrackContainerBase(
   m_dynamicKeys = other.m_dynamicKeys;
   assert(checkConsistency());
 }
+
+void VectorTrackContainerBase::copyReferenceSurface(
+    IndexType itrack, const VectorTrackContainerBase& src, IndexType srcIdx) {
+  const auto& surface = src.m_referenceSurfaces[srcIdx];
+  if (surface == nullptr ||
+      src.m_referenceSurfaceGeometry == m_referenceSurfaceGeometry) {
+    m_referenceSurfaces[itrack] = surface;
+  } else {
+    // the source might not own the surface
+    m_referenceSurfaces[itrack] = detail::storedReferenceSurface(
+        surface->getSharedPtr(), m_referenceSurfaceGeometry.get());
+  }
+}
 }  // namespace detail_vtc
 
 VectorTrackContainer::IndexType VectorTrackContainer::addTrack_impl() {
@@ -167,6 +184,22 @@ void VectorTrackContainer::clear() {
   }
 }
 
+void VectorTrackContainer::setReferenceSurfaceStorage(
+    ReferenceSurfaceStorage storage,
+    std::shared_ptr<const TrackingGeometry> geometry) {
+  if (size() != 0) {
+    throw std::logic_error(
+        "Reference surface storage can only be set without tracks");
+  }
+  if (storage == ReferenceSurfaceStorage::NonOwningGeometry &&
+      geometry == nullptr) {
+    throw std::invalid_argument(
+        "Non-owning reference surface storage requires a tracking geometry");
+  }
+  m_referenceSurfaceGeometry =
+      storage == ReferenceSurfaceStorage::Shared ? nullptr : std::move(geometry);
+}
+
 std::size_t VectorTrackContainer::size() const {
   return m_tipIndex.size();
 }
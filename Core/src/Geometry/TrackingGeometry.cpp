@@ -223,9 +223,24 @@ TrackingGeometry::TrackingGeometry(
 
   m_volumesById.rehash(0);
   m_surfacesById.rehash(0);
+
+  // Registering the geometry on the surfaces answers whether a surface is
+  // the one found by its identifier without a lookup
+  for (const auto& [id, surface] : m_surfacesById) {
+    surface->m_trackingGeometry = this;
+  }
+
+  m_world->buildVolumeSearchGrids();
 }
 
-TrackingGeometry::~TrackingGeometry() = default;
+TrackingGeometry::~TrackingGeometry() {
+  // Surfaces shared with other owners outlive the geometry
+  for (const auto& [id, surface] : m_surfacesById) {
+    if (surface->m_trackingGeometry == this) {
+      surface->m_trackingGeometry = nullptr;
+    }
+  }
+}
 
 const TrackingVolume* TrackingGeometry::lowestTrackingVolume(
     const GeometryContext& gctx, const Vector3& gp) const {
@@ -9,6 +9,8 @@
 #include "Acts/Geometry/TrackingVolume.hpp"
 
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/GlueVolumesDescriptor.hpp"
 #include "Acts/Geometry/Portal.hpp"
@@ -23,10 +25,16 @@
 #include "Acts/Surfaces/RegularSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Utilities/Axis.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
+#include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -36,6 +44,63 @@
 
 namespace Acts {
 
+namespace {
+
+using namespace UnitLiterals;
+
+/// Child volumes are enlarged by this envelope in the search grid. Lookups
+/// with a larger tolerance fall back to the linear search.
+constexpr double s_volumeSearchEnvelope = 1_um;
+/// Levels with fewer child volumes are searched linearly
+constexpr std::size_t s_minVolumesForSearchGrid = 4;
+/// Upper limit of the number of bins of a search grid
+constexpr std::size_t s_maxVolumeSearchGridBins = 1 << 16;
+
+/// Conservative r/z extent of a volume in the global frame, given as
+/// (rMin, rMax, zMin, zMax).
+std::array<double, 4> volumeExtentRZ(const Volume& volume) {
+  const auto& bounds = volume.volumeBounds();
+  const Transform3& transform = volume.localToGlobalTransform(
+      GeometryContext::dangerouslyDefaultConstruct());
+
+  // coaxial cylinders are described exactly, which separates volumes which
+  // are stacked in r
+  if (const auto* cylinder = dynamic_cast<const CylinderVolumeBounds*>(&bounds);
+      cylinder != nullptr &&
+      cylinder->get(CylinderVolumeBounds::eBevelMinZ) == 0. &&
+      cylinder->get(CylinderVolumeBounds::eBevelMaxZ) == 0. &&
+      transform.linear().col(2).cwiseAbs().isApprox(Vector3::UnitZ()) &&
+      VectorHelpers::perp(transform.translation()) < s_volumeSearchEnvelope) {
+    const double halfZ = cylinder->get(CylinderVolumeBounds::eHalfLengthZ);
+    const double z = transform.translation().z();
+    return {cylinder->get(CylinderVolumeBounds::eMinR),
+            cylinder->get(CylinderVolumeBounds::eMaxR), z - halfZ, z + halfZ};
+  }
+
+  // everything else is enclosed by its axis aligned bounding box
+  const auto box = volume.boundingBox();
+  const Vector3& vmin = box.min();
+  const Vector3& vmax = box.max();
+  const double xNear = std::clamp(0., vmin.x(), vmax.x());
+  const double yNear = std::clamp(0., vmin.y(), vmax.y());
+  const double xFar = std::max(std::abs(vmin.x()), std::abs(vmax.x()));
+  const double yFar = std::max(std::abs(vmin.y()), std::abs(vmax.y()));
+  return {std::hypot(xNear, yNear), std::hypot(xFar, yFar), vmin.z(),
+          vmax.z()};
+}
+
+}  // namespace
+
+/// Grid in r and z whose bins hold the indices of all child volumes which
+/// overlap with the bin, in ascending order. The bin edges are the enlarged
+/// extents of the child volumes.
+struct TrackingVolume::VolumeSearchGrid {
+  using RZAxis = Axis<AxisType::Variable, AxisBoundaryType::Open>;
+  using RZGrid = Grid<std::vector<std::uint32_t>, RZAxis, RZAxis>;
+
+  RZGrid grid;
+};
+
 TrackingVolume::TrackingVolume(
     const Transform3& transform, std::shared_ptr<VolumeBounds> volumeBounds,
     std::shared_ptr<const IVolumeMaterial> volumeMaterial,
@@ -104,7 +169,20 @@ const TrackingVolume* TrackingVolume::lowestTrackingVolume(
     }
   }
 
-  // @TODO: Abstract this into an accelerateable structure
+  // the search grid holds the overlapping child volumes in insertion order,
+  // which gives the same result as the linear search below
+  if (m_volumeSearchGrid != nullptr && tol < s_volumeSearchEnvelope) {
+    const auto& candidates = m_volumeSearchGrid->grid.atPosition(
+        std::array<double, 2>{VectorHelpers::perp(position), position.z()});
+    for (std::uint32_t index : candidates) {
+      const TrackingVolume& volume = *m_volumes[index];
+      if (volume.inside(gctx, position, tol)) {
+        return volume.lowestTrackingVolume(gctx, position, tol);
+      }
+    }
+    return this;
+  }
+
   for (const auto& volume : volumes()) {
     if (volume.inside(gctx, position, tol)) {
       return volume.lowestTrackingVolume(gctx, position, tol);
@@ -563,9 +641,76 @@ TrackingVolume& TrackingVolume::addVolume(
 
   volume->setMotherVolume(this);
   m_volumes.push_back(std::move(volume));
+  // the search grid is rebuilt with the tracking geometry
+  m_volumeSearchGrid.reset();
   return *m_volumes.back();
 }
 
+void TrackingVolume::buildVolumeSearchGrids() {
+  m_volumeSearchGrid.reset();
+  for (auto& volume : m_volumes) {
+    volume->buildVolumeSearchGrids();
+  }
+
+  // the grid is built from the nominal placement of the child volumes, which
+  // is the only placement of volumes that are not alignable. Later changes
+  // of their bounds or transforms are not tracked.
+  if (m_volumes.size() < s_minVolumesForSearchGrid ||
+      std::ranges::any_of(m_volumes, [](const auto& volume) {
+        return volume->isAlignable();
+      })) {
+    return;
+  }
+
+  std::vector<std::array<double, 4>> extents;
+  extents.reserve(m_volumes.size());
+  std::vector<double> rEdges;
+  std::vector<double> zEdges;
+  for (const auto& volume : m_volumes) {
+    auto extent = volumeExtentRZ(*volume);
+    extent[0] = std::max(extent[0] - s_volumeSearchEnvelope, 0.);
+    extent[1] += s_volumeSearchEnvelope;
+    extent[2] -= s_volumeSearchEnvelope;
+    extent[3] += s_volumeSearchEnvelope;
+    extents.push_back(extent);
+    rEdges.insert(rEdges.end(), {extent[0], extent[1]});
+    zEdges.insert(zEdges.end(), {extent[2], extent[3]});
+  }
+
+  auto makeUnique = [](std::vector<double>& edges) {
+    std::ranges::sort(edges);
+    auto duplicates = std::ranges::unique(edges);
+    edges.erase(duplicates.begin(), duplicates.end());
+  };
+  makeUnique(rEdges);
+  makeUnique(zEdges);
+  if ((rEdges.size() - 1) * (zEdges.size() - 1) > s_maxVolumeSearchGridBins) {
+    return;
+  }
+
+  auto binIndex = [](const std::vector<double>& edges, double value) {
+    return static_cast<std::size_t>(std::ranges::lower_bound(edges, value) -
+                                    edges.begin());
+  };
+
+  VolumeSearchGrid::RZGrid grid{VolumeSearchGrid::RZAxis{rEdges},
+                                VolumeSearchGrid::RZAxis{zEdges}};
+  for (const auto& [index, extent] : enumerate(extents)) {
+    // local bin 0 is the underflow bin
+    for (std::size_t ir = binIndex(rEdges, extent[0]);
+         ir < binIndex(rEdges, extent[1]); ++ir) {
+      for (std::size_t iz = binIndex(zEdges, extent[2]);
+           iz < binIndex(zEdges, extent[3]); ++iz) {
+        grid.atLocalBins({ir + 1, iz + 1})
+            .push_back(static_cast<std::uint32_t>(index));
+      }
+    }
+  }
+
+  m_volumeSearchGrid = std::make_unique<const VolumeSearchGrid>(
+      VolumeSearchGrid{std::move(grid)});
+}
+
 TrackingVolume::PortalRange TrackingVolume::portals() const {
   return PortalRange{m_portals};
 }
@@ -8,16 +8,48 @@
 
 #include "Acts/Navigation/NavigationStream.hpp"
 
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/Propagator/NavigationTarget.hpp"
 #include "Acts/Surfaces/BoundaryTolerance.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <span>
 #include <unordered_set>
 
 namespace Acts {
 
+namespace {
+
+using namespace UnitLiterals;
+
+constexpr double s_pathLengthMargin = 1_um;
+
+// Same as PlaneSurface::intersect for a known path length, which leaves the
+// boundary check
+Intersection3D planeIntersection(const GeometryContext& gctx,
+                                 const Surface& surface,
+                                 const Vector3& position,
+                                 const Vector3& direction, double pathLength,
+                                 const BoundaryTolerance& boundaryTolerance,
+                                 double tolerance) {
+  const Vector3 intersection = position + pathLength * direction;
+  IntersectionStatus status = std::abs(pathLength) < std::abs(tolerance)
+                                  ? IntersectionStatus::onSurface
+                                  : IntersectionStatus::reachable;
+  const auto& tMatrix = surface.localToGlobalTransform(gctx).matrix();
+  const Vector3 vecLocal(intersection - tMatrix.block<3, 1>(0, 3));
+  if (!surface.insideBounds(tMatrix.block<3, 2>(0, 0).transpose() * vecLocal,
+                            boundaryTolerance)) {
+    status = IntersectionStatus::unreachable;
+  }
+  return Intersection3D(intersection, pathLength, status);
+}
+
+}  // namespace
+
 bool NavigationStream::initialize(const GeometryContext& gctx,
                                   const QueryPoint& queryPoint,
                                   const BoundaryTolerance& cTolerance,
@@ -31,13 +63,48 @@ bool NavigationStream::initialize(const GeometryContext& gctx,
   std::vector<NavigationTarget> additionalCandidates = {};
   additionalCandidates.reserve(m_candidates.size());
   std::unordered_set<const Surface*> processed{};
-  for (auto& candidate : m_candidates) {
+
+  // Estimate the path lengths to all unbounded candidate surfaces at once
+  m_intersectionBatch.clear();
+  for (const auto& candidate : m_candidates) {
+    m_intersectionBatch.add(gctx, candidate.surface());
+  }
+  const std::span<const double> maxPathLengths =
+      m_intersectionBatch.maxPathLengths(position, direction);
+  // Margin for the rounding differences between the estimate and the full
+  // intersection
+  const double minPathLength = -onSurfaceTolerance - s_pathLengthMargin;
+
+  for (auto [index, candidate] : enumerate(m_candidates)) {
     // Get the surface from the object intersection
     const Surface& surface = candidate.surface();
+    // Surfaces which are only crossed behind the query point stay invalid,
+    // which saves the full intersection and the boundary check. Unknown
+    // estimates are NaN and never discard a candidate.
+    if (maxPathLengths[index] < minPathLength) {
+      continue;
+    }
     // Check whether the surface already has been processed
     if (!processed.insert(&surface).second) {
       continue;
     }
+    // The estimate for a plane is its full path length, so only the boundary
+    // check is left. Discs are packed as planes but bounded in polar
+    // coordinates and go through the full intersection.
+    const double pathLength = maxPathLengths[index];
+    if (surface.type() == Surface::Plane && !std::isnan(pathLength)) {
+      if (pathLength < -onSurfaceTolerance) {
+        continue;
+      }
+      auto intersection =
+          planeIntersection(gctx, surface, position, direction, pathLength,
+                            cTolerance, onSurfaceTolerance);
+      if (intersection.isValid()) {
+        candidate.intersection() = intersection;
+        candidate.intersectionIndex() = 0;
+      }
+      continue;
+    }
     // Intersect the surface
     auto multiIntersection = surface.intersect(gctx, position, direction,
                                                cTolerance, onSurfaceTolerance);
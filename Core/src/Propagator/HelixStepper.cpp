@@ -0,0 +1,362 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/HelixStepper.hpp"
+
+#include "Acts/EventData/TransformationHelpers.hpp"
+#include "Acts/Propagator/detail/CovarianceEngine.hpp"
+#include "Acts/Utilities/MathHelpers.hpp"
+
+#include <cmath>
+
+namespace Acts {
+
+namespace {
+
+/// Helix functions of the turning angle phi which are numerically stable for
+/// small angles
+struct HelixFunctions {
+  double cosPhi = 1;
+  double sinPhi = 0;
+  /// sin(phi) / phi
+  double sinc = 1;
+  /// (1 - cos(phi)) / phi
+  double cosc = 0;
+  /// (cos(phi) - sin(phi) / phi) / phi
+  double f1 = 0;
+  /// (sin(phi) - (1 - cos(phi)) / phi) / phi
+  double f2 = 0.5;
+
+  explicit HelixFunctions(double phi)
+      : cosPhi(std::cos(phi)), sinPhi(std::sin(phi)) {
+    // below this angle the series expansions are exact to double precision
+    // while the closed forms start to suffer from cancellation
+    constexpr double smallPhi = 1e-2;
+    if (std::abs(phi) < smallPhi) {
+      const double phi2 = phi * phi;
+      sinc = 1 - phi2 / 6 + phi2 * phi2 / 120;
+      cosc = phi * (0.5 - phi2 / 24 + phi2 * phi2 / 720);
+      f1 = phi * (-1. / 3 + phi2 / 30 - phi2 * phi2 / 840);
+      f2 = 0.5 - phi2 / 8 + phi2 * phi2 / 144;
+    } else {
+      sinc = sinPhi / phi;
+      cosc = (1 - cosPhi) / phi;
+      f1 = (cosPhi - sinc) / phi;
+      f2 = (sinPhi - cosc) / phi;
+    }
+  }
+};
+
+/// Transport of position and direction along a helix in a constant field
+struct HelixTransport {
+  Vector3 bUnit = Vector3::UnitZ();
+  double bMagnitude = 0;
+  /// The turning angle
+  double phi = 0;
+  HelixFunctions f;
+  double dirAlongB = 0;
+  Vector3 bCrossDir;
+
+  Vector3 position;
+  Vector3 direction;
+
+  HelixTransport(const Vector3& pos, const Vector3& dir, double qop,
+                 const Vector3& bField, double h)
+      : bMagnitude(bField.norm()),
+        // The equation of motion dT/ds = qop * T x B rotates the direction
+        // around the field axis
+        phi(qop * bMagnitude * h),
+        f(phi) {
+    if (bMagnitude > 0) {
+      bUnit = bField / bMagnitude;
+    }
+    dirAlongB = bUnit.dot(dir);
+    bCrossDir = bUnit.cross(dir);
+
+    direction = f.cosPhi * dir - f.sinPhi * bCrossDir +
+                phi * f.cosc * dirAlongB * bUnit;
+    position = pos + h * (f.sinc * dir - f.cosc * bCrossDir +
+                          (1 - f.sinc) * dirAlongB * bUnit);
+  }
+};
+
+/// Maximum number of iterations to refine the path length to a surface
+constexpr unsigned int s_maxRefinements = 10;
+
+}  // namespace
+
+HelixStepper::HelixStepper(std::shared_ptr<const MagneticFieldProvider> bField)
+    : m_bField(std::move(bField)) {}
+
+HelixStepper::HelixStepper(const Config& config) : m_bField(config.bField) {}
+
+HelixStepper::State HelixStepper::makeState(const Options& options) const {
+  State state{options, m_bField->makeCache(options.magFieldContext)};
+  return state;
+}
+
+void HelixStepper::initialize(State& state, const BoundParameters& par) const {
+  initialize(state, par.parameters(), par.covariance(),
+             par.particleHypothesis(), par.referenceSurface());
+}
+
+void HelixStepper::initialize(State& state, const BoundVector& boundParams,
+                              const std::optional<BoundMatrix>& cov,
+                              ParticleHypothesis particleHypothesis,
+                              const Surface& surface) const {
+  FreeVector freeParams = transformBoundToFreeParameters(
+      surface, state.options.geoContext, boundParams);
+
+  state.particleHypothesis = particleHypothesis;
+
+  state.pathAccumulated = 0;
+  state.nSteps = 0;
+  state.nStepTrials = 0;
+  // the helix is exact, so the step size is only limited by the navigation
+  // and the user but not by an accuracy estimate
+  state.stepSize = ConstrainedStep();
+  state.stepSize.setUser(state.options.maxStepSize);
+  state.previousStepSize = 0;
+  state.statistics = StepperStatistics();
+
+  state.pars = freeParams;
+
+  // Init the jacobian matrix if needed
+  state.covTransport = cov.has_value();
+  if (state.covTransport) {
+    state.cov = *cov;
+    state.jacToGlobal = surface.boundToFreeJacobian(
+        state.options.geoContext, freeParams.segment<3>(eFreePos0),
+        freeParams.segment<3>(eFreeDir0));
+    state.jacobian = BoundMatrix::Identity();
+    state.jacTransport = FreeMatrix::Identity();
+    state.derivative = FreeVector::Zero();
+  }
+}
+
+IntersectionStatus HelixStepper::updateSurfaceStatus(
+    State& state, const Surface& surface, std::uint8_t index, Direction navDir,
+    const BoundaryTolerance& boundaryTolerance, double surfaceTolerance,
+    ConstrainedStep::Type stype, const Logger& logger) const {
+  const IntersectionStatus status =
+      detail::updateSingleSurfaceStatus<HelixStepper>(
+          *this, state, surface, index, navDir, boundaryTolerance,
+          surfaceTolerance, stype, logger);
+  if (status != IntersectionStatus::reachable) {
+    return status;
+  }
+
+  const Vector3 pos = position(state);
+  const Vector3 dir = direction(state);
+  auto fieldRes = getField(state, pos);
+  if (!fieldRes.ok()) {
+    return status;
+  }
+
+  // Newton iteration on the helix, the straight line path length from the
+  // current helix point is the correction to the helix path length. The
+  // solution index keeps the crossing of the navigation candidate.
+  double pathLength = state.stepSize.value(stype);
+  for (unsigned int i = 0; i < s_maxRefinements; ++i) {
+    const HelixTransport helix(pos, dir, qOverP(state), *fieldRes,
+                               navDir * pathLength);
+    const Intersection3D intersection =
+        surface
+            .intersect(state.options.geoContext, helix.position,
+                       navDir * helix.direction, BoundaryTolerance::Infinite(),
+                       surfaceTolerance)
+            .at(index);
+    if (!intersection.isValid()) {
+      break;
+    }
+    pathLength += intersection.pathLength();
+    if (std::abs(intersection.pathLength()) < surfaceTolerance) {
+      if (pathLength > 0) {
+        ACTS_VERBOSE("Path length refined along the helix from "
+                     << state.stepSize.value(stype) << " to " << pathLength);
+        state.stepSize.release(stype);
+        state.stepSize.update(pathLength, stype);
+      }
+      break;
+    }
+  }
+
+  return status;
+}
+
+Result<std::tuple<HelixStepper::BoundParameters, BoundMatrix, double>>
+HelixStepper::boundState(
+    State& state, const Surface& surface, bool transportCov,
+    const FreeToBoundCorrection& freeToBoundCorrection) const {
+  return detail::boundState(
+      state.options.geoContext, surface, state.cov, state.jacobian,
+      state.jacTransport, state.derivative, state.jacToGlobal, std::nullopt,
+      state.pars, state.particleHypothesis, state.covTransport && transportCov,
+      state.pathAccumulated, freeToBoundCorrection);
+}
+
+bool HelixStepper::prepareCurvilinearState(State& state) const {
+  // test whether the accumulated path has still its initial value.
+  if (state.pathAccumulated != 0) {
+    return true;
+  }
+
+  // if no step was executed the path length derivatives have not been
+  // computed but are needed to compute the curvilinear covariance
+  auto fieldRes = getField(state, position(state));
+  if (!fieldRes.ok()) {
+    return false;
+  }
+
+  const Vector3 dir = direction(state);
+  // dr/ds :
+  state.derivative.template head<3>() = dir;
+  // dt / ds
+  state.derivative(eFreeTime) = fastHypot(
+      1., state.particleHypothesis.mass() / absoluteMomentum(state));
+  // d (dr/ds) / ds :
+  state.derivative.template segment<3>(eFreeDir0) =
+      qOverP(state) * dir.cross(*fieldRes);
+  // d qop / ds  == 0
+  state.derivative(eFreeQOverP) = 0.;
+
+  return true;
+}
+
+std::tuple<HelixStepper::BoundParameters, BoundMatrix, double>
+HelixStepper::curvilinearState(State& state, bool transportCov) const {
+  return detail::curvilinearState(
+      state.cov, state.jacobian, state.jacTransport, state.derivative,
+      state.jacToGlobal, std::nullopt, state.pars, state.particleHypothesis,
+      state.covTransport && transportCov, state.pathAccumulated);
+}
+
+void HelixStepper::update(State& state, const FreeVector& freeParams,
+                          const BoundVector& /*boundParams*/,
+                          const Covariance& covariance,
+                          const Surface& surface) const {
+  state.pars = freeParams;
+  state.cov = covariance;
+  state.jacToGlobal = surface.boundToFreeJacobian(
+      state.options.geoContext, freeParams.template segment<3>(eFreePos0),
+      freeParams.template segment<3>(eFreeDir0));
+}
+
+void HelixStepper::update(State& state, const Vector3& uposition,
+                          const Vector3& udirection, double qOverP,
+                          double time) const {
+  state.pars.template segment<3>(eFreePos0) = uposition;
+  state.pars.template segment<3>(eFreeDir0) = udirection;
+  state.pars[eFreeTime] = time;
+  state.pars[eFreeQOverP] = qOverP;
+}
+
+void HelixStepper::transportCovarianceToCurvilinear(State& state) const {
+  detail::transportCovarianceToCurvilinear(
+      state.cov, state.jacobian, state.jacTransport, state.derivative,
+      state.jacToGlobal, std::nullopt,
+      state.pars.template segment<3>(eFreeDir0));
+}
+
+void HelixStepper::transportCovarianceToBound(
+    State& state, const Surface& surface,
+    const FreeToBoundCorrection& freeToBoundCorrection) const {
+  detail::transportCovarianceToBound(
+      state.options.geoContext, surface, state.cov, state.jacobian,
+      state.jacTransport, state.derivative, state.jacToGlobal, std::nullopt,
+      state.pars, freeToBoundCorrection);
+}
+
+Result<double> HelixStepper::step(State& state, Direction propDir,
+                                  const IVolumeMaterial* material) const {
+  static_cast<void>(material);
+
+  const double h = state.stepSize.value() * propDir;
+
+  const Vector3 pos = position(state);
+  const Vector3 dir = direction(state);
+  const double qop = qOverP(state);
+  const double m = particleHypothesis(state).mass();
+  const double p = absoluteMomentum(state);
+
+  // the field at the start position is taken to be constant along the step
+  auto fieldRes = getField(state, pos);
+  if (!fieldRes.ok()) {
+    return fieldRes.error();
+  }
+  const Vector3& bField = *fieldRes;
+  const HelixTransport helix(pos, dir, qop, bField, h);
+  const HelixFunctions& f = helix.f;
+  const Vector3& bUnit = helix.bUnit;
+  const Vector3& newDir = helix.direction;
+  // time propagates along distance as 1/b = sqrt(1 + m²/p²)
+  const double dtds = fastHypot(1., m / p);
+
+  state.pars.template segment<3>(eFreePos0) = helix.position;
+  state.pars.template segment<3>(eFreeDir0) = newDir;
+  state.pars[eFreeTime] += h * dtds;
+
+  // Propagate the jacobian
+  if (state.covTransport) {
+    SquareMatrix3 bCross;
+    // clang-format off
+    bCross <<           0, -bUnit.z(),  bUnit.y(),
+                bUnit.z(),          0, -bUnit.x(),
+               -bUnit.y(),  bUnit.x(),          0;
+    // clang-format on
+    const SquareMatrix3 bbT = bUnit * bUnit.transpose();
+
+    // The step transport matrix in global coordinates
+    FreeMatrix D = FreeMatrix::Identity();
+    // dr/dT
+    D.block<3, 3>(eFreePos0, eFreeDir0) =
+        h * (f.sinc * SquareMatrix3::Identity() - f.cosc * bCross +
+             (1 - f.sinc) * bbT);
+    // dT/dT
+    D.block<3, 3>(eFreeDir0, eFreeDir0) =
+        f.cosPhi * SquareMatrix3::Identity() - f.sinPhi * bCross +
+        helix.phi * f.cosc * bbT;
+    // dr/dqop
+    D.block<3, 1>(eFreePos0, eFreeQOverP) =
+        helix.bMagnitude * h * h *
+        (f.f1 * dir - f.f2 * helix.bCrossDir -
+         f.f1 * helix.dirAlongB * bUnit);
+    // dT/dqop
+    D.block<3, 1>(eFreeDir0, eFreeQOverP) =
+        helix.bMagnitude * h *
+        (-f.sinPhi * dir - f.cosPhi * helix.bCrossDir +
+         f.sinPhi * helix.dirAlongB * bUnit);
+    // dt/dqop
+    D(eFreeTime, eFreeQOverP) = h * m * m * qop / dtds;
+
+    state.jacTransport = D * state.jacTransport;
+
+    state.derivative.template head<3>() = newDir;
+    state.derivative(eFreeTime) = dtds;
+    state.derivative.template segment<3>(eFreeDir0) =
+        qop * newDir.cross(bField);
+    state.derivative(eFreeQOverP) = 0.;
+  }
+
+  // state the path length
+  state.pathAccumulated += h;
+  ++state.nSteps;
+  ++state.nStepTrials;
+
+  ++state.statistics.nAttemptedSteps;
+  ++state.statistics.nSuccessfulSteps;
+  if (propDir != Direction::fromScalarZeroAsPositive(h)) {
+    ++state.statistics.nReverseSteps;
+  }
+  state.statistics.pathLength += h;
+  state.statistics.absolutePathLength += std::abs(h);
+
+  return h;
+}
+
+}  // namespace Acts
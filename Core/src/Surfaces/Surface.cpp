@@ -25,6 +25,16 @@ Surface::Surface(const Transform3& transform)
 Surface::Surface(const SurfacePlacementBase& placement) noexcept
     : GeometryObject(), m_placement(&placement) {}
 
+Surface::Surface(const Surface& other) noexcept
+    : GeometryObject(other),
+      std::enable_shared_from_this<Surface>(other),
+      m_transform(other.m_transform),
+      m_placement(other.m_placement),
+      m_associatedLayer(other.m_associatedLayer),
+      m_surfaceMaterial(other.m_surfaceMaterial),
+      m_isSensitive(other.m_isSensitive),
+      m_thickness(other.m_thickness) {}
+
 Surface::Surface(const GeometryContext& gctx, const Surface& other,
                  const Transform3& shift) noexcept
     : GeometryObject(),
@@ -34,6 +44,17 @@ Surface::Surface(const GeometryContext& gctx, const Surface& other,
 
 Surface::~Surface() noexcept = default;
 
+Surface& Surface::operator=(const Surface& other) noexcept {
+  GeometryObject::operator=(other);
+  m_transform = other.m_transform;
+  m_placement = other.m_placement;
+  m_associatedLayer = other.m_associatedLayer;
+  m_surfaceMaterial = other.m_surfaceMaterial;
+  m_isSensitive = other.m_isSensitive;
+  m_thickness = other.m_thickness;
+  return *this;
+}
+
 std::ostream& operator<<(std::ostream& os, Surface::SurfaceType type) {
   return os << Surface::s_surfaceTypeNames[static_cast<std::size_t>(type)];
 }
@@ -321,6 +342,10 @@ const Layer* Surface::associatedLayer() const {
   return m_associatedLayer;
 }
 
+const TrackingGeometry* Surface::trackingGeometry() const {
+  return m_trackingGeometry;
+}
+
 const ISurfaceMaterial* Surface::surfaceMaterial() const {
   return m_surfaceMaterial.get();
 }
@@ -0,0 +1,137 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/SurfaceIntersectionBatch.hpp"
+
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace Acts {
+
+namespace {
+
+using ConstColumn = Eigen::Map<const Eigen::ArrayXd>;
+
+constexpr double s_nan = std::numeric_limits<double>::quiet_NaN();
+
+}  // namespace
+
+template <std::size_t N>
+void SurfaceIntersectionBatch::Columns<N>::clear() {
+  for (auto& column : values) {
+    column.clear();
+  }
+  indices.clear();
+}
+
+template <std::size_t N>
+void SurfaceIntersectionBatch::Columns<N>::add(
+    std::uint32_t index, const std::array<double, N>& packed) {
+  for (std::size_t i = 0; i < N; ++i) {
+    values[i].push_back(packed[i]);
+  }
+  indices.push_back(index);
+}
+
+void SurfaceIntersectionBatch::clear() {
+  m_planes.clear();
+  m_cylinders.clear();
+  m_pathLengths.clear();
+}
+
+void SurfaceIntersectionBatch::add(const GeometryContext& gctx,
+                                   const Surface& surface) {
+  const auto index = static_cast<std::uint32_t>(m_pathLengths.size());
+  m_pathLengths.push_back(s_nan);
+
+  const Surface::SurfaceType type = surface.type();
+  if (type != Surface::Plane && type != Surface::Disc &&
+      type != Surface::Cylinder) {
+    return;
+  }
+
+  const auto& matrix = surface.localToGlobalTransform(gctx).matrix();
+  if (type == Surface::Cylinder) {
+    const auto& cylinder = static_cast<const CylinderSurface&>(surface);
+    m_cylinders.add(index, {matrix(0, 2), matrix(1, 2), matrix(2, 2),
+                            matrix(0, 3), matrix(1, 3), matrix(2, 3),
+                            cylinder.bounds().get(CylinderBounds::eR)});
+  } else {
+    m_planes.add(index, {matrix(0, 2), matrix(1, 2), matrix(2, 2),
+                         matrix(0, 3), matrix(1, 3), matrix(2, 3)});
+  }
+}
+
+std::span<const double> SurfaceIntersectionBatch::maxPathLengths(
+    const Vector3& position, const Vector3& direction) {
+  const double px = position.x();
+  const double py = position.y();
+  const double pz = position.z();
+  const double dx = direction.x();
+  const double dy = direction.y();
+  const double dz = direction.z();
+
+  auto scatter = [&](const std::vector<std::uint32_t>& indices) {
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      const double pathLength = m_scratch[i];
+      m_pathLengths[indices[i]] =
+          std::isfinite(pathLength) ? pathLength : s_nan;
+    }
+  };
+
+  if (const auto n = static_cast<Eigen::Index>(m_planes.indices.size());
+      n > 0) {
+    const auto& v = m_planes.values;
+    ConstColumn nx(v[0].data(), n);
+    ConstColumn ny(v[1].data(), n);
+    ConstColumn nz(v[2].data(), n);
+    ConstColumn cx(v[3].data(), n);
+    ConstColumn cy(v[4].data(), n);
+    ConstColumn cz(v[5].data(), n);
+
+    m_scratch.resize(n);
+    Eigen::Map<Eigen::ArrayXd> pathLengths(m_scratch.data(), n);
+    // same as PlanarHelper::intersect, but for all planes at once
+    pathLengths = (nx * (cx - px) + ny * (cy - py) + nz * (cz - pz)) /
+                  (nx * dx + ny * dy + nz * dz);
+    scatter(m_planes.indices);
+  }
+
+  if (const std::size_t n = m_cylinders.indices.size(); n > 0) {
+    const auto& v = m_cylinders.values;
+    m_scratch.resize(n);
+    // same quadratic equation as CylinderSurface::intersectionSolver. there
+    // are usually only a few cylinders, so they are not worth a vectorized
+    // pass with temporary columns.
+    for (std::size_t i = 0; i < n; ++i) {
+      const Vector3 axis(v[0][i], v[1][i], v[2][i]);
+      const Vector3 center(v[3][i], v[4][i], v[5][i]);
+      const double radius = v[6][i];
+
+      const Vector3 pcXcd = (position - center).cross(axis);
+      const Vector3 ldXcd = direction.cross(axis);
+      const double a = ldXcd.dot(ldXcd);
+      const double b = 2. * ldXcd.dot(pcXcd);
+      const double c = pcXcd.dot(pcXcd) - radius * radius;
+      const double discriminant = b * b - 4. * a * c;
+
+      m_scratch[i] = (a > 0. && discriminant >= 0.)
+                         ? (std::sqrt(discriminant) - b) / (2. * a)
+                         : s_nan;
+    }
+    scatter(m_cylinders.indices);
+  }
+
+  return m_pathLengths;
+}
+
+}  // namespace Acts
@@ -147,7 +147,7 @@ ProcessCode DigitizationAlgorithm::execute(const AlgorithmContext& ctx) const {
 
   // Prepare output containers
   // need list here for stable addresses
-  MeasurementContainer measurements;
+  MeasurementContainer measurements(ctx.memoryResource);
   ClusterContainer clusters;
 
   MeasurementParticlesMap measurementParticlesMap;
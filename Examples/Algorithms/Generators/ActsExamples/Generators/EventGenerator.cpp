@@ -55,6 +55,8 @@ EventGenerator::EventGenerator(const Config& cfg, Acts::Logging::Level lvl)
   }
 
   m_outputEvent.maybeInitialize(m_cfg.outputEvent);
+
+  setStatelessInput();
 }
 
 std::string EventGenerator::name() const {
@@ -19,8 +19,10 @@
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/TrackHelpers.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/MeasurementSurfaceIndex.hpp"
 #include "ActsExamples/EventData/Seed.hpp"
 #include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/EventData/TrackContainerPool.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
@@ -119,6 +121,10 @@ class TrackFindingAlgorithm final : public IAlgorithm {
     /// Whether to use the Joseph formulation for the Kalman filter update. This
     /// is typically more stable but also more computationally expensive.
     bool useJosephFormulation = false;
+    /// Reuse the track containers of previous events instead of growing new
+    /// ones in every event. The reused containers are not allocated from the
+    /// per-event memory resource.
+    bool reuseTrackContainers = false;
 
     // Pixel and strip volume ids to be used for maxPixel/StripHoles cuts
     std::vector<std::uint32_t> pixelVolumeIds;
@@ -159,6 +165,8 @@ class TrackFindingAlgorithm final : public IAlgorithm {
  private:
   Config m_cfg;
   std::optional<Acts::TrackSelector> m_trackSelector;
+  std::shared_ptr<TrackContainerPool> m_trackContainerPool;
+  std::shared_ptr<const DenseSurfaceIndex> m_surfaceIndex;
 
   ReadDataHandle<MeasurementContainer> m_inputMeasurements{this,
                                                            "InputMeasurements"};
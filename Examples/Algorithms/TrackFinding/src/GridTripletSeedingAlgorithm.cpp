@@ -157,8 +157,10 @@ ProcessCode GridTripletSeedingAlgorithm::execute(
 
   Acts::SpacePointContainer2 coreSpacePoints(
       Acts::SpacePointColumns::PackedXY | Acts::SpacePointColumns::PackedZR |
-      Acts::SpacePointColumns::VarianceZ | Acts::SpacePointColumns::VarianceR |
-      Acts::SpacePointColumns::CopyFromIndex);
+          Acts::SpacePointColumns::VarianceZ |
+          Acts::SpacePointColumns::VarianceR |
+          Acts::SpacePointColumns::CopyFromIndex,
+      ctx.memoryResource);
   coreSpacePoints.reserve(grid.numberOfSpacePoints());
   std::vector<Acts::SpacePointIndexRange2> gridSpacePointRanges;
   gridSpacePointRanges.reserve(grid.numberOfBins());
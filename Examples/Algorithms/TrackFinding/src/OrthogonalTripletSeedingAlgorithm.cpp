@@ -104,9 +104,10 @@ ProcessCode OrthogonalTripletSeedingAlgorithm::execute(
 
   Acts::SpacePointContainer2 coreSpacePoints(
       Acts::SpacePointColumns::PackedXY | Acts::SpacePointColumns::PackedZR |
-      Acts::SpacePointColumns::Phi | Acts::SpacePointColumns::VarianceZ |
-      Acts::SpacePointColumns::VarianceR |
-      Acts::SpacePointColumns::CopyFromIndex);
+          Acts::SpacePointColumns::Phi | Acts::SpacePointColumns::VarianceZ |
+          Acts::SpacePointColumns::VarianceR |
+          Acts::SpacePointColumns::CopyFromIndex,
+      ctx.memoryResource);
   coreSpacePoints.reserve(spacePoints.size());
 
   Acts::Experimental::CylindricalSpacePointKDTreeBuilder kdTreeBuilder;
@@ -13,6 +13,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/ProxyAccessor.hpp"
+#include "Acts/EventData/ReferenceSurfaceStorage.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
@@ -34,6 +35,7 @@
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/MeasurementCalibration.hpp"
+#include "ActsExamples/EventData/MeasurementSurfaceIndex.hpp"
 #include "ActsExamples/EventData/Seed.hpp"
 #include "ActsExamples/EventData/SpacePoint.hpp"
 #include "ActsExamples/EventData/Track.hpp"
@@ -42,6 +44,7 @@
 
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
@@ -267,6 +270,9 @@ TrackFindingAlgorithm::TrackFindingAlgorithm(
   if (m_cfg.outputTracks.empty()) {
     throw std::invalid_argument("Missing tracks output collection");
   }
+  if (m_cfg.trackingGeometry == nullptr) {
+    throw std::invalid_argument("Missing tracking geometry");
+  }
 
   if (m_cfg.seedDeduplication && m_cfg.inputSeeds.empty()) {
     throw std::invalid_argument(
@@ -287,6 +293,12 @@ TrackFindingAlgorithm::TrackFindingAlgorithm(
         m_cfg.trackSelectorCfg.value());
   }
 
+  if (m_cfg.reuseTrackContainers) {
+    m_trackContainerPool = std::make_shared<TrackContainerPool>();
+  }
+
+  m_surfaceIndex = std::make_shared<DenseSurfaceIndex>(*m_cfg.trackingGeometry);
+
   m_inputMeasurements.initialize(m_cfg.inputMeasurements);
   m_inputInitialTrackParameters.initialize(m_cfg.inputInitialTrackParameters);
   m_inputSeeds.maybeInitialize(m_cfg.inputSeeds);
@@ -322,15 +334,24 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   MeasurementSelector measSel{
       Acts::MeasurementSelector(m_cfg.measurementSelectorCfg)};
 
-  IndexSourceLinkAccessor slAccessor;
-  slAccessor.container = &measurements.orderedIndices();
+  // group the measurements by surface once so that every surface lookup of
+  // the CKF is a single offset table access
+  MeasurementSurfaceIndex measurementIndex(m_surfaceIndex, measurements);
+  if (measurementIndex.nUnassigned() > 0) {
+    ACTS_WARNING(measurementIndex.nUnassigned()
+                 << " measurements are on surfaces unknown to the tracking "
+                    "geometry and are ignored");
+  }
+
+  MeasurementSurfaceIndexAccessor slAccessor;
+  slAccessor.container = &measurementIndex;
 
   using TrackStateCreatorType =
-      Acts::TrackStateCreator<IndexSourceLinkAccessor::Iterator,
+      Acts::TrackStateCreator<MeasurementSurfaceIndexAccessor::Iterator,
                               TrackContainer>;
   TrackStateCreatorType trackStateCreator;
   trackStateCreator.sourceLinkAccessor
-      .template connect<&IndexSourceLinkAccessor::range>(&slAccessor);
+      .template connect<&MeasurementSurfaceIndexAccessor::range>(&slAccessor);
   trackStateCreator.calibrator
       .template connect<&MeasurementCalibratorAdapter::calibrate>(&calibrator);
   trackStateCreator.measurementSelector
@@ -390,15 +411,35 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
                                           << " seeds.");
 
-  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  auto makeTrackContainer = [&](std::pmr::memory_resource* resource) {
+    TrackContainer container =
+        m_trackContainerPool != nullptr
+            ? m_trackContainerPool->acquire()
+            : TrackContainer{std::make_shared<Acts::VectorTrackContainer>(),
+                             std::make_shared<Acts::VectorMultiTrajectory>(
+                                 resource)};
+    // Almost all reference surfaces belong to the geometry, referencing them
+    // without ownership avoids the reference counting when branching
+    container.container().setReferenceSurfaceStorage(
+        Acts::ReferenceSurfaceStorage::NonOwningGeometry,
+        m_cfg.trackingGeometry);
+    container.trackStateContainer().setReferenceSurfaceStorage(
+        Acts::ReferenceSurfaceStorage::NonOwningGeometry,
+        m_cfg.trackingGeometry);
+    return container;
+  };
 
-  auto trackContainerTemp = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainerTemp =
-      std::make_shared<Acts::VectorMultiTrajectory>();
+  // The temporary container is cleared for every seed and grows again to a
+  // size that is not known in advance. A pool on top of the event resource
+  // recycles its released buffers, which a monotonic event arena would only
+  // free at the end of the event.
+  std::pmr::unsynchronized_pool_resource tempResource(
+      std::pmr::pool_options{.max_blocks_per_chunk = 0,
+                             .largest_required_pool_block = 1 << 20},
+      ctx.memoryResource);
 
-  TrackContainer tracks(trackContainer, trackStateContainer);
-  TrackContainer tracksTemp(trackContainerTemp, trackStateContainerTemp);
+  TrackContainer tracks = makeTrackContainer(ctx.memoryResource);
+  TrackContainer tracksTemp = makeTrackContainer(&tempResource);
 
   // Note that not all backends support PODs as column types
   tracks.addColumn<BranchStopper::BranchState>("MyBranchState");
@@ -408,6 +449,12 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   tracksTemp.addColumn<unsigned int>("trackGroup");
   Acts::ProxyAccessor<unsigned int> seedNumber("trackGroup");
 
+  // Reserve the output for about one track per seed and one track state per
+  // measurement, so it does not leave its outgrown buffers in the event
+  // resource while it is filled
+  tracks.container().reserve(initialParameters.size());
+  tracks.trackStateContainer().reserve(measurements.size());
+
   unsigned int nSeed = 0;
 
   // A map indicating whether a seed has been discovered already
@@ -679,12 +726,18 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   m_memoryStatistics.local().hist +=
       tracks.trackStateContainer().statistics().hist;
 
+  if (m_trackContainerPool != nullptr) {
+    m_trackContainerPool->recycle(std::move(tracksTemp));
+    m_outputTracks(ctx, m_trackContainerPool->release(std::move(tracks)));
+    return ProcessCode::SUCCESS;
+  }
+
   auto constTrackStateContainer =
       std::make_shared<Acts::ConstVectorMultiTrajectory>(
-          std::move(*trackStateContainer));
+          std::move(tracks.trackStateContainer()));
 
   auto constTrackContainer = std::make_shared<Acts::ConstVectorTrackContainer>(
-      std::move(*trackContainer));
+      std::move(tracks.container()));
 
   ConstTrackContainer constTracks{constTrackContainer,
                                   constTrackStateContainer};
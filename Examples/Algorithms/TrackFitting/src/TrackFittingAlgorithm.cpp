@@ -104,7 +104,8 @@ ProcessCode TrackFittingAlgorithm::execute(const AlgorithmContext& ctx) const {
       false};
 
   auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
+  auto trackStateContainer =
+      std::make_shared<Acts::VectorMultiTrajectory>(ctx.memoryResource);
   TrackContainer tracks(trackContainer, trackStateContainer);
 
   // reserve space for the track containers
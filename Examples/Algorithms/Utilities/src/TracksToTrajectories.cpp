@@ -38,10 +38,10 @@ ProcessCode TracksToTrajectories::execute(const AlgorithmContext& ctx) const {
   TrajectoriesContainer trajectories;
   trajectories.reserve(tracks.size());
 
-  static const Acts::ConstProxyAccessor<unsigned int> seedNumber("trackGroup");
-
   if (tracks.hasColumn(Acts::hashString("trackGroup"))) {
     // track group by seed is available, produce grouped trajectories
+    const Acts::ConstResolvedProxyAccessor<unsigned int> seedNumber(
+        tracks.container(), "trackGroup");
     std::optional<unsigned int> lastSeed;
 
     Trajectories::IndexedParameters parameters;
@@ -0,0 +1,103 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "ActsExamples/Utilities/Numa.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace ActsExamples {
+
+/// A magnetic field that keeps one copy of a field map per NUMA node.
+///
+/// Lookups from threads pinned to a NUMA node, see `Sequencer::Config::
+/// numaAware`, use a copy that is created on first use by a thread of that
+/// node, so its grid is allocated in node-local memory. Lookups from other
+/// threads use the original field.
+///
+/// @tparam field_t Copyable field map whose cache does not depend on the
+///         instance, e.g. `Acts::InterpolatedBFieldMap`
+template <typename field_t>
+class NumaReplicatedBField final : public Acts::MagneticFieldProvider {
+ public:
+  /// @param field The field to replicate
+  explicit NumaReplicatedBField(std::shared_ptr<const field_t> field)
+      : m_field(std::move(field)) {
+    const std::size_t nNodes = numaNodes().size();
+    m_flags = std::deque<std::once_flag>(nNodes);
+    m_replicas.resize(nNodes);
+    m_fastReplicas = std::vector<std::atomic<const field_t*>>(nNodes);
+  }
+
+  /// @copydoc Acts::MagneticFieldProvider::makeCache
+  MagneticFieldProvider::Cache makeCache(
+      const Acts::MagneticFieldContext& mctx) const override {
+    return m_field->makeCache(mctx);
+  }
+
+  /// @copydoc Acts::MagneticFieldProvider::getField
+  Acts::Result<Acts::Vector3> getField(
+      const Acts::Vector3& position,
+      MagneticFieldProvider::Cache& cache) const override {
+    return localField().getField(position, cache);
+  }
+
+  /// @copydoc Acts::MagneticFieldProvider::getFields
+  Acts::Result<void> getFields(
+      std::span<const Acts::Vector3> positions,
+      std::span<Acts::Vector3> fields,
+      MagneticFieldProvider::Cache& cache) const override {
+    return localField().getFields(positions, fields, cache);
+  }
+
+  /// The field used by the calling thread
+  const field_t& localField() const {
+    const int node = currentNumaNode();
+    if (node < 0 || static_cast<std::size_t>(node) >= m_replicas.size()) {
+      return *m_field;
+    }
+    const field_t* replica =
+        m_fastReplicas[node].load(std::memory_order_acquire);
+    if (replica == nullptr) {
+      std::call_once(m_flags[node], [&]() {
+        m_replicas[node] = std::make_shared<const field_t>(*m_field);
+        m_fastReplicas[node].store(m_replicas[node].get(),
+                                   std::memory_order_release);
+      });
+      replica = m_replicas[node].get();
+    }
+    return *replica;
+  }
+
+ private:
+  std::shared_ptr<const field_t> m_field;
+  mutable std::deque<std::once_flag> m_flags;
+  mutable std::vector<std::shared_ptr<const field_t>> m_replicas;
+  mutable std::vector<std::atomic<const field_t*>> m_fastReplicas;
+};
+
+/// Replicate an interpolated field map per NUMA node.
+///
+/// @param field The field to replicate
+/// @return a `NumaReplicatedBField` for interpolated field maps, @p field
+///         unchanged for any other field
+std::shared_ptr<const Acts::MagneticFieldProvider> replicatePerNumaNode(
+    std::shared_ptr<const Acts::MagneticFieldProvider> field);
+
+}  // namespace ActsExamples
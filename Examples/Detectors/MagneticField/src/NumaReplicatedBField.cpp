@@ -0,0 +1,29 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/MagneticField/NumaReplicatedBField.hpp"
+
+#include "ActsExamples/MagneticField/MagneticField.hpp"
+
+std::shared_ptr<const Acts::MagneticFieldProvider>
+ActsExamples::replicatePerNumaNode(
+    std::shared_ptr<const Acts::MagneticFieldProvider> field) {
+  if (auto field2 = std::dynamic_pointer_cast<
+          const detail::InterpolatedMagneticField2>(field)) {
+    return std::make_shared<
+        NumaReplicatedBField<detail::InterpolatedMagneticField2>>(
+        std::move(field2));
+  }
+  if (auto field3 = std::dynamic_pointer_cast<
+          const detail::InterpolatedMagneticField3>(field)) {
+    return std::make_shared<
+        NumaReplicatedBField<detail::InterpolatedMagneticField3>>(
+        std::move(field3));
+  }
+  return field;
+}
@@ -15,6 +15,7 @@
 #include "ActsExamples/EventData/Index.hpp"
 
 #include <cassert>
+#include <type_traits>
 
 namespace ActsExamples {
 
@@ -61,6 +62,11 @@ class IndexSourceLink final {
   }
 };
 
+// Source links are copied into every track state. Being trivially copyable
+// and small enough to be stored in place, they are copied as raw bytes.
+static_assert(std::is_trivially_copyable_v<IndexSourceLink>);
+static_assert(sizeof(IndexSourceLink) <= ACTS_SOURCELINK_SBO_SIZE);
+
 struct IndexSourceLinkSurfaceAccessor {
   const Acts::TrackingGeometry& geometry;
 
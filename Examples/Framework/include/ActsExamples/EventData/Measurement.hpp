@@ -20,6 +20,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <memory_resource>
 #include <type_traits>
 #include <vector>
 
@@ -66,6 +67,15 @@ class MeasurementContainer {
 
   MeasurementContainer();
 
+  /// @brief Construct an empty container whose measurement data is allocated
+  ///        from the given memory resource, e.g. a per-event arena
+  /// @param memoryResource The memory resource used for the measurement data
+  explicit MeasurementContainer(std::pmr::memory_resource* memoryResource);
+
+  /// @brief Get the memory resource used for the measurement data
+  /// @return The memory resource of the container
+  std::pmr::memory_resource* memoryResource() const;
+
   /// @brief Get the number of measurements
   /// @return The number of measurements
   std::size_t size() const;
@@ -167,12 +177,12 @@ class MeasurementContainer {
     std::uint8_t size{};
   };
 
-  std::vector<MeasurementEntry> m_entries;
+  std::pmr::vector<MeasurementEntry> m_entries;
 
-  std::vector<Acts::GeometryIdentifier> m_geometryIds;
-  std::vector<std::uint8_t> m_subspaceIndices;
-  std::vector<double> m_parameters;
-  std::vector<double> m_covariances;
+  std::pmr::vector<Acts::GeometryIdentifier> m_geometryIds;
+  std::pmr::vector<std::uint8_t> m_subspaceIndices;
+  std::pmr::vector<double> m_parameters;
+  std::pmr::vector<double> m_covariances;
 
   OrderedIndices m_orderedIndices;
 };
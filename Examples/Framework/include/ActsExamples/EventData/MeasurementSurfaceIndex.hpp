@@ -0,0 +1,162 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+class TrackingGeometry;
+}
+
+namespace ActsExamples {
+
+class MeasurementContainer;
+
+/// Dense numbering of the surfaces of a tracking geometry.
+///
+/// The surfaces are numbered in geometry identifier order. The numbering only
+/// depends on the geometry and is meant to be built once and shared between
+/// events.
+class DenseSurfaceIndex {
+ public:
+  /// Type alias for the dense surface index
+  using Index = std::uint32_t;
+
+  /// Index returned for surfaces which are not part of the numbering
+  static constexpr Index kInvalidIndex = std::numeric_limits<Index>::max();
+
+  /// Number all surfaces of a tracking geometry
+  /// @param geometry The tracking geometry
+  explicit DenseSurfaceIndex(const Acts::TrackingGeometry& geometry);
+
+  /// Number the given surfaces
+  /// @param geometryIds The geometry identifiers of the surfaces
+  explicit DenseSurfaceIndex(std::vector<Acts::GeometryIdentifier> geometryIds);
+
+  /// @return The number of surfaces
+  std::size_t size() const { return m_geometryIds.size(); }
+
+  /// Get the dense index of a surface
+  /// @param geometryId The geometry identifier of the surface
+  /// @return The dense index or @ref kInvalidIndex if the surface is unknown
+  Index index(Acts::GeometryIdentifier geometryId) const {
+    auto it = m_indices.find(geometryId);
+    return it != m_indices.end() ? it->second : kInvalidIndex;
+  }
+
+  /// Get the geometry identifier of a surface
+  /// @param index The dense index of the surface
+  /// @return The geometry identifier of the surface
+  Acts::GeometryIdentifier geometryId(Index index) const {
+    return m_geometryIds[index];
+  }
+
+ private:
+  std::vector<Acts::GeometryIdentifier> m_geometryIds;
+  std::unordered_map<Acts::GeometryIdentifier, Index> m_indices;
+};
+
+/// Measurement source links grouped by surface in a compressed sparse row
+/// layout.
+///
+/// The source links are stored contiguously in surface order and an offset
+/// table addressed by the dense surface index gives the range of each
+/// surface. The index is built once per event and replaces the binary search
+/// of the geometry ordered multiset by a single lookup.
+class MeasurementSurfaceIndex {
+ public:
+  /// Type alias for the stored source links
+  using SourceLinks = std::vector<IndexSourceLink>;
+
+  /// Build the index for the given measurements
+  /// @param surfaces The dense surface numbering
+  /// @param measurements The measurements to index
+  /// @note Measurements on surfaces unknown to the numbering are not indexed
+  MeasurementSurfaceIndex(std::shared_ptr<const DenseSurfaceIndex> surfaces,
+                          const MeasurementContainer& measurements);
+
+  /// @return The dense surface numbering
+  const DenseSurfaceIndex& surfaces() const { return *m_surfaces; }
+
+  /// @return All indexed source links in surface order
+  const SourceLinks& sourceLinks() const { return m_sourceLinks; }
+
+  /// Get the source link range of a surface
+  /// @param surfaceIndex The dense index of the surface
+  /// @return The begin and end iterators of the range
+  std::pair<SourceLinks::const_iterator, SourceLinks::const_iterator> range(
+      DenseSurfaceIndex::Index surfaceIndex) const {
+    if (surfaceIndex == DenseSurfaceIndex::kInvalidIndex) {
+      return {m_sourceLinks.end(), m_sourceLinks.end()};
+    }
+    assert(surfaceIndex + 1 < m_offsets.size());
+    return {m_sourceLinks.begin() + m_offsets[surfaceIndex],
+            m_sourceLinks.begin() + m_offsets[surfaceIndex + 1]};
+  }
+
+  /// Get the source link range of a surface
+  /// @param geometryId The geometry identifier of the surface
+  /// @return The begin and end iterators of the range
+  std::pair<SourceLinks::const_iterator, SourceLinks::const_iterator> range(
+      Acts::GeometryIdentifier geometryId) const {
+    return range(m_surfaces->index(geometryId));
+  }
+
+  /// Get the source links of a surface
+  /// @param geometryId The geometry identifier of the surface
+  /// @return The source links on the surface
+  std::span<const IndexSourceLink> sourceLinks(
+      Acts::GeometryIdentifier geometryId) const {
+    auto [begin, end] = range(geometryId);
+    return {begin, end};
+  }
+
+  /// @return The number of measurements on surfaces unknown to the numbering
+  std::size_t nUnassigned() const { return m_nUnassigned; }
+
+ private:
+  std::shared_ptr<const DenseSurfaceIndex> m_surfaces;
+  std::vector<std::uint32_t> m_offsets;
+  SourceLinks m_sourceLinks;
+  std::size_t m_nUnassigned = 0;
+};
+
+/// Accessor for the surface indexed measurements
+///
+/// Drop-in replacement of @ref IndexSourceLinkAccessor for the Combinatorial
+/// Kalman Filter.
+struct MeasurementSurfaceIndexAccessor {
+  using BaseIterator = MeasurementSurfaceIndex::SourceLinks::const_iterator;
+
+  using Iterator = Acts::SourceLinkAdapterIterator<BaseIterator>;
+
+  const MeasurementSurfaceIndex* container = nullptr;
+
+  // get the range of elements on the requested surface
+  std::pair<Iterator, Iterator> range(const Acts::Surface& surface) const {
+    assert(container != nullptr);
+    auto [begin, end] = container->range(surface.geometryId());
+    return {Iterator{begin}, Iterator{end}};
+  }
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,63 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/EventData/Track.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Pool of track container backends which are reused across events.
+///
+/// Containers are cleared before they are handed out again, which keeps the
+/// capacity of all columns including the dynamic ones. This avoids growing the
+/// columns from zero in every event.
+///
+/// Containers which are published to the white board are converted with
+/// @ref release and return their storage to the pool once the last reference
+/// to them is dropped, on whichever thread that happens.
+///
+/// @note The pool has to be owned by a @c std::shared_ptr. Containers which
+///       are released after the pool is destroyed are simply deleted.
+/// @note Pooled track states use the default memory resource and not the
+///       per-event memory resource, as they outlive the event.
+class TrackContainerPool
+    : public std::enable_shared_from_this<TrackContainerPool> {
+ public:
+  /// Get an empty track container, reusing pooled storage if available
+  /// @return Track container with pooled or new backends
+  TrackContainer acquire();
+
+  /// Return a track container that is not needed anymore
+  /// @param tracks The track container to recycle
+  void recycle(TrackContainer&& tracks);
+
+  /// Convert a track container into a read-only container whose storage is
+  /// returned to the pool when it is destroyed
+  /// @param tracks The track container to publish
+  /// @return Read-only track container sharing the storage
+  ConstTrackContainer release(TrackContainer&& tracks);
+
+  /// @return The number of idle track containers in the pool
+  std::size_t size() const;
+
+ private:
+  void recycle(std::unique_ptr<Acts::VectorTrackContainer> tracks);
+  void recycle(std::unique_ptr<Acts::VectorMultiTrajectory> trackStates);
+
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<Acts::VectorTrackContainer>> m_tracks;
+  std::vector<std::unique_ptr<Acts::VectorMultiTrajectory>> m_trackStates;
+};
+
+}  // namespace ActsExamples
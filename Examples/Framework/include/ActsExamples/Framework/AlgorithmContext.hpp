@@ -13,6 +13,8 @@
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "ActsPlugins/FpeMonitoring/FpeMonitor.hpp"
 
+#include <memory_resource>
+
 namespace ActsExamples {
 
 class WhiteBoard;
@@ -53,6 +55,11 @@ struct AlgorithmContext {
   std::size_t threadId;                   ///< Thread ID
 
   ActsPlugins::FpeMonitor* fpeMonitor = nullptr;
+
+  /// Per-event memory resource. Event data containers that are allocated
+  /// from it must not outlive the event store.
+  std::pmr::memory_resource* memoryResource =
+      std::pmr::get_default_resource();
 };
 
 }  // namespace ActsExamples
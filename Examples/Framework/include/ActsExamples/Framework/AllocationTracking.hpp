@@ -0,0 +1,129 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+
+namespace ActsExamples {
+
+/// Memory accounted to one sequence element for one event.
+///
+/// Heap allocations reach the counter through an @ref AllocationScope,
+/// allocations through a memory resource can be added directly. The counter
+/// may be updated from several threads.
+class AllocationCounter {
+ public:
+  /// Account an allocation
+  /// @param bytes Size of the allocation
+  void allocate(std::size_t bytes) noexcept {
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    const std::int64_t live =
+        m_live.fetch_add(static_cast<std::int64_t>(bytes),
+                         std::memory_order_relaxed) +
+        static_cast<std::int64_t>(bytes);
+    std::int64_t peak = m_peak.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !m_peak.compare_exchange_weak(peak, live,
+                                         std::memory_order_relaxed)) {
+    }
+  }
+
+  /// Account a deallocation
+  /// @param bytes Size of the deallocation
+  void deallocate(std::size_t bytes) noexcept {
+    m_live.fetch_sub(static_cast<std::int64_t>(bytes),
+                     std::memory_order_relaxed);
+  }
+
+  /// Account an object stored on the white board
+  /// @param bytes Estimated size of the object
+  void store(std::size_t bytes) noexcept {
+    m_stored.fetch_add(static_cast<std::int64_t>(bytes),
+                       std::memory_order_relaxed);
+  }
+
+  /// Number of allocations so far
+  std::int64_t allocations() const {
+    return m_allocations.load(std::memory_order_relaxed);
+  }
+  /// Bytes currently allocated. Can be negative if memory allocated before
+  /// was released.
+  std::int64_t live() const { return m_live.load(std::memory_order_relaxed); }
+  /// Maximum of the bytes allocated at the same time
+  std::int64_t peak() const { return m_peak.load(std::memory_order_relaxed); }
+  /// Estimated size of the objects stored on the white board
+  std::int64_t stored() const {
+    return m_stored.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<std::int64_t> m_allocations = 0;
+  std::atomic<std::int64_t> m_live = 0;
+  std::atomic<std::int64_t> m_peak = 0;
+  std::atomic<std::int64_t> m_stored = 0;
+};
+
+/// Accounts the heap allocations and deallocations of the calling thread to
+/// a counter while the scope is alive.
+///
+/// The global allocation functions are replaced by the framework library to
+/// feed the counter of the innermost scope. Scopes nest and a scope without
+/// counter pauses the accounting, e.g. while a memory resource that is
+/// accounted itself refills from the heap. Allocations of tasks running on
+/// other threads are not seen.
+class AllocationScope {
+ public:
+  /// @param counter The counter to account to, or nullptr to pause
+  explicit AllocationScope(AllocationCounter* counter) noexcept;
+
+  AllocationScope(const AllocationScope&) = delete;
+  AllocationScope& operator=(const AllocationScope&) = delete;
+
+  /// Restores the enclosing scope
+  ~AllocationScope() noexcept;
+
+  /// @return The counter of the innermost scope of the calling thread
+  static AllocationCounter* current() noexcept;
+
+ private:
+  AllocationCounter* m_previous;
+};
+
+/// Estimate the memory held by an object, e.g. when it is stored on the
+/// white board.
+///
+/// Ranges contribute their elements, containers with a capacity their
+/// reserved storage. Elements that are ranges are estimated recursively,
+/// any other heap memory owned by the elements is not seen.
+///
+/// @param object The object to estimate
+/// @return The estimated size in bytes
+template <typename T>
+std::size_t estimateObjectSize(const T& object) {
+  std::size_t size = sizeof(T);
+  if constexpr (std::ranges::sized_range<const T>) {
+    using Value = std::ranges::range_value_t<const T>;
+    std::size_t n = std::ranges::size(object);
+    if constexpr (requires { object.capacity(); }) {
+      n = object.capacity();
+    }
+    size += n * sizeof(Value);
+    if constexpr (std::ranges::sized_range<const Value>) {
+      for (const auto& element : object) {
+        size += estimateObjectSize(element) - sizeof(Value);
+      }
+    }
+  }
+  return size;
+}
+
+}  // namespace ActsExamples
@@ -13,6 +13,7 @@
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <optional>
 #include <stdexcept>
 #include <typeinfo>
 #include <unordered_map>
@@ -70,39 +71,78 @@ class DataHandleBase {
 
   std::string fullName() const { return m_parent->name() + "." + name(); }
 
+  /// Resolve the key to its slot in a white board slot layout.
+  ///
+  /// Afterwards, white boards using the same layout are accessed by slot
+  /// index instead of by key. Other white boards are still accessed by key.
+  /// Uninitialized handles and keys unknown to the layout are not resolved.
+  ///
+  /// @param layout The slot layout, which has to outlive all accesses
+  void resolveSlot(const WhiteBoard::SlotLayout& layout) const;
+
  protected:
   void registerAsWriteHandle();
   void registerAsReadHandle();
 
+  /// Get the resolved slot for a white board, if it uses the layout this
+  /// handle was resolved against
+  std::optional<std::size_t> slotFor(const WhiteBoard& wb) const {
+    if (m_slotLayout != nullptr && wb.m_slotLayout.get() == m_slotLayout) {
+      return m_slot;
+    }
+    return std::nullopt;
+  }
+
   // Trampoline functions to avoid having the WhiteBoard as a friend
   template <typename T>
   void add(WhiteBoard& wb, T&& object) const {
+    if (auto slot = slotFor(wb)) {
+      wb.addToSlot(*slot, std::forward<T>(object));
+      return;
+    }
     wb.add(m_key.value(), std::forward<T>(object));
   }
 
   template <typename T>
   const T& get(const WhiteBoard& wb) const {
+    if (auto slot = slotFor(wb)) {
+      return wb.getFromSlot<T>(*slot);
+    }
     return wb.get<T>(m_key.value());
   }
 
   template <typename T>
   T pop(WhiteBoard& wb) const {
+    if (auto slot = slotFor(wb)) {
+      return wb.popFromSlot<T>(*slot);
+    }
     return wb.pop<T>(m_key.value());
   }
 
   std::pair<Acts::AnyMoveOnly*, std::uint64_t> getHolder(
       const WhiteBoard& wb) const {
+    if (auto slot = slotFor(wb)) {
+      return wb.getSlotHolder(*slot);
+    }
     return wb.getHolder(m_key.value());
   }
 
   void addHolder(WhiteBoard& wb, std::unique_ptr<Acts::AnyMoveOnly> holder,
                  std::uint64_t typeHash) const {
+    if (auto slot = slotFor(wb)) {
+      wb.addSlotHolder(*slot, std::move(holder), typeHash);
+      return;
+    }
     wb.addHolder(m_key.value(), std::move(holder), typeHash);
   }
 
   SequenceElement* m_parent{nullptr};
   std::string m_name;
   std::optional<std::string> m_key{};
+
+  // Cached slot resolution, see resolveSlot()
+  mutable const WhiteBoard::SlotLayout* m_slotLayout{nullptr};
+  mutable std::size_t m_slot{0};
 };
 
 /// Base class for write data handles.
@@ -0,0 +1,56 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace ActsExamples {
+
+/// Monotonic arena for the allocations of one event.
+///
+/// Memory is handed out from a growing set of buffers and is only released
+/// when the resource is destroyed, which makes allocation a pointer bump and
+/// deallocation a no-op. Allocations are serialized with a mutex, so the
+/// resource can be shared by the sequence elements of one event even if
+/// they run concurrently.
+///
+/// @note Objects allocated from the arena must not outlive it. Containers
+///       following the `std::pmr` conventions copy into the default memory
+///       resource, so copying data out of an event is always safe.
+class EventMemoryResource final : public std::pmr::memory_resource {
+ public:
+  /// @param initialSize Size of the first buffer in bytes
+  /// @param upstream Resource the buffers are allocated from
+  explicit EventMemoryResource(
+      std::size_t initialSize,
+      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+  EventMemoryResource(const EventMemoryResource&) = delete;
+  EventMemoryResource& operator=(const EventMemoryResource&) = delete;
+
+  /// Total number of bytes handed out by the arena
+  std::size_t bytesAllocated() const;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override;
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+  mutable std::mutex m_mutex;
+  std::pmr::monotonic_buffer_resource m_arena;
+  std::size_t m_bytesAllocated = 0;
+};
+
+}  // namespace ActsExamples
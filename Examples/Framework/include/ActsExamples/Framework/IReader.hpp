@@ -12,6 +12,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include <cstddef>
 #include <string>
 #include <utility>
 
@@ -44,6 +45,20 @@ class IReader : public SequenceElement {
     return ProcessCode::SUCCESS;
   }
 
+  /// Prepare the reader to run in a worker process of a multi-process
+  /// sequencer. Called in the worker process before the first event.
+  ///
+  /// Inputs opened before the worker was forked, e.g. files, are shared with
+  /// the other processes including their read position, so readers that keep
+  /// inputs open across events must reopen them here. By default, only
+  /// readers declared with `setStatelessInput` support running in worker
+  /// processes.
+  ///
+  /// @param worker The index of the worker process
+  virtual ProcessCode beginWorker(std::size_t /*worker*/) {
+    return m_statelessInput ? ProcessCode::SUCCESS : ProcessCode::ABORT;
+  }
+
   /// Internal execute method forwards to the read method as mutable
   /// @param context The algorithm context
   ProcessCode internalExecute(const AlgorithmContext& context) final {
@@ -58,6 +73,14 @@ class IReader : public SequenceElement {
 
   /// Return the type for debug output
   std::string_view typeName() const override { return "Reader"; }
+
+ protected:
+  /// Declare that the reader keeps no inputs open across events, e.g. it
+  /// opens a separate file per event, so it can run in worker processes
+  void setStatelessInput() { m_statelessInput = true; }
+
+ private:
+  bool m_statelessInput = false;
 };
 
 }  // namespace ActsExamples
@@ -12,6 +12,11 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/SequenceElement.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+
 namespace ActsExamples {
 
 /// Event data writer interface.
@@ -38,11 +43,73 @@ class IWriter : public SequenceElement {
     return ProcessCode::SUCCESS;
   }
 
+  /// Handles the output of a writer in the worker processes of a
+  /// multi-process sequencer, see `setWorkerOutput`.
+  class WorkerOutput {
+   public:
+    virtual ~WorkerOutput() = default;
+
+    /// Redirect output that is shared between the processes, e.g. an open
+    /// file, to a separate output of the worker, see `workerFilepath`.
+    /// Called in the worker process before the first event.
+    /// @param worker The index of the worker process
+    virtual ProcessCode beginWorker(std::size_t worker) = 0;
+
+    /// Merge the outputs of the worker processes. Called in the main process
+    /// after all workers completed and the writer was finalized.
+    /// @param nWorkers The number of worker processes
+    virtual ProcessCode mergeWorkers(std::size_t nWorkers) = 0;
+  };
+
+  /// Worker output of writers that write a separate file per event, which
+  /// needs neither preparation nor merging.
+  class PerEventWorkerOutput final : public WorkerOutput {
+   public:
+    ProcessCode beginWorker(std::size_t /*worker*/) override {
+      return ProcessCode::SUCCESS;
+    }
+    ProcessCode mergeWorkers(std::size_t /*nWorkers*/) override {
+      return ProcessCode::SUCCESS;
+    }
+  };
+
+  /// Prepare the writer to run in a worker process of a multi-process
+  /// sequencer. Called in the worker process before the first event.
+  ///
+  /// Forwards to the worker output of the writer. Without one, the writer
+  /// does not support running in worker processes.
+  ///
+  /// @param worker The index of the worker process
+  virtual ProcessCode beginWorker(std::size_t worker) {
+    return m_workerOutput != nullptr ? m_workerOutput->beginWorker(worker)
+                                     : ProcessCode::ABORT;
+  }
+
+  /// Merge the outputs of the worker processes of a multi-process sequencer.
+  /// Called in the main process after all workers completed and the writer
+  /// was finalized.
+  ///
+  /// @param nWorkers The number of worker processes
+  virtual ProcessCode mergeWorkers(std::size_t nWorkers) {
+    return m_workerOutput != nullptr ? m_workerOutput->mergeWorkers(nWorkers)
+                                     : ProcessCode::SUCCESS;
+  }
+
   /// Fulfill the algorithm interface
   ProcessCode initialize() override { return ProcessCode::SUCCESS; }
 
   /// Return the type for debug output
   std::string_view typeName() const override { return "Writer"; }
+
+ protected:
+  /// Enable running the writer in worker processes
+  /// @param workerOutput Handles the output in the worker processes
+  void setWorkerOutput(std::unique_ptr<WorkerOutput> workerOutput) {
+    m_workerOutput = std::move(workerOutput);
+  }
+
+ private:
+  std::unique_ptr<WorkerOutput> m_workerOutput;
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,127 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ActsExamples {
+
+class WhiteBoard;
+
+/// Event data reader that wraps a concrete reader instance and reads the
+/// upcoming events on a background thread into a bounded queue.
+///
+/// The upstream reader is called for consecutive events starting from the
+/// first requested event, so that I/O and decompression overlap with the
+/// processing of the events that are already available. The content of
+/// the prefetched event is transferred to the event store on request.
+class PrefetchingReader final : public IReader {
+ public:
+  struct Config {
+    /// The upstream reader that should be used
+    std::shared_ptr<IReader> upstreamReader;
+
+    /// Maximum number of events read ahead of the processing. The limit is
+    /// exceeded if an event beyond the queued ones is requested, so that
+    /// the background thread can never block the event loop.
+    std::size_t queueSize = 4;
+  };
+
+  /// Construct the reader
+  PrefetchingReader(const Config& config, Acts::Logging::Level level);
+
+  PrefetchingReader(const PrefetchingReader&) = delete;
+  PrefetchingReader& operator=(const PrefetchingReader&) = delete;
+
+  /// Stops the background thread if it is still running
+  ~PrefetchingReader() override;
+
+  /// Return the config
+  const Config& config() const { return m_cfg; }
+
+  /// Give the reader a understandable name
+  std::string name() const override {
+    return "Prefetching" + m_cfg.upstreamReader->name();
+  }
+
+  /// The prefetching reader provides the events of the upstream reader
+  std::pair<std::size_t, std::size_t> availableEvents() const override {
+    return m_cfg.upstreamReader->availableEvents();
+  }
+
+  /// Wait for the requested event and transfer it to the event store
+  ProcessCode read(const AlgorithmContext& ctx) override;
+
+  /// Set the first event that is read ahead and forward to the upstream
+  /// reader
+  ProcessCode skip(std::size_t events) override;
+
+  /// Forward to the upstream reader, the background thread is only started
+  /// with the first event
+  ProcessCode beginWorker(std::size_t worker) override {
+    return m_cfg.upstreamReader->beginWorker(worker);
+  }
+
+  /// Forward to the upstream reader
+  ProcessCode initialize() override;
+
+  /// Stop the background thread and forward to the upstream reader
+  ProcessCode finalize() override;
+
+ private:
+  /// An event read by the background thread
+  struct Entry {
+    std::unique_ptr<WhiteBoard> store;
+    ProcessCode code = ProcessCode::SUCCESS;
+    std::exception_ptr exception;
+  };
+
+  /// Body of the background thread
+  void prefetch();
+
+  /// Signal the background thread to stop and wait for it
+  void stop();
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  std::once_flag m_startFlag;
+  std::thread m_thread;
+
+  std::mutex m_mutex;
+  /// Signalled whenever an event was added to the queue
+  std::condition_variable m_eventReady;
+  /// Signalled whenever space in the queue becomes available
+  std::condition_variable m_spaceReady;
+  std::map<std::size_t, Entry> m_queue;
+  /// First event that is read by the background thread
+  std::size_t m_firstEvent = 0;
+  /// Next event to be read by the background thread
+  std::size_t m_nextEvent = 0;
+  /// Highest event number that has been requested so far plus one
+  std::size_t m_requestedEnd = 0;
+  /// Set once the background thread has read its last event
+  bool m_done = false;
+  bool m_stop = false;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -28,6 +28,8 @@
 #include <vector>
 
 #include <tbb/enumerable_thread_specific.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
 
 namespace ActsExamples {
 
@@ -73,6 +75,13 @@ class Sequencer {
     std::string outputDir;
     /// output name of the timing file
     std::string outputTimingFile = "timing.csv";
+    /// If true, the begin and end of every decorator and sequence element
+    /// execution is recorded per event and thread, and written as a Chrome
+    /// trace event file that can be inspected with Perfetto or
+    /// chrome://tracing
+    bool recordTrace = false;
+    /// output name of the trace file
+    std::string outputTraceFile = "trace.json";
     /// Callback that is invoked in the event loop.
     /// @warning This function can be called from multiple threads and should therefore be thread-safe
     IterationCallback iterationCallback = []() {};
@@ -88,6 +97,74 @@ class Sequencer {
     bool failOnUnmaskedFpe = true;
     /// The number of stack frames to include in the FPE report.
     std::size_t fpeStackTraceLength = 8;
+
+    /// If true, the sequence elements of one event are scheduled concurrently
+    /// based on the data dependencies declared by their read/write data
+    /// handles, instead of strictly in the order they were added.
+    /// Elements without any data handles act as barriers. Accessing a white
+    /// board key that an element does not declare through a data handle
+    /// fails the event, since the element could otherwise run before the
+    /// producer of that key. Skipping keeps the sequential semantics: if an
+    /// element skips the event, the elements after it in the sequence are
+    /// not started anymore and the event is dropped, while the elements
+    /// before it still run. Elements after it that already run concurrently
+    /// complete, but their white board objects are dropped with the event.
+    /// Writers wait for all elements before them, so a skipped event is
+    /// never written. Has no effect in single-threaded mode.
+    bool intraEventParallelism = false;
+
+    /// If true, writers do not run in the event loop. Finished events are
+    /// instead handed to one dedicated thread per writer through bounded
+    /// queues, decoupling the processing throughput from the I/O speed.
+    bool asyncWriters = false;
+    /// Maximum number of finished events queued per asynchronous writer
+    std::size_t writerQueueSize = 16;
+    /// If true, asynchronous writers receive the events in event-number
+    /// order. Skipped events are not written. The reordering runs on a
+    /// dedicated thread, events finished ahead of an earlier one are kept in
+    /// memory until that one is done.
+    bool writeEventsInOrder = false;
+
+    /// If true, every event gets a monotonic memory arena that is exposed
+    /// through `AlgorithmContext::memoryResource` and released together with
+    /// the event store, removing most allocations from the event loop.
+    bool eventArena = false;
+    /// Size of the first buffer of the event arena in bytes, the arena grows
+    /// if more memory is needed
+    std::size_t eventArenaSize = 16 * 1024 * 1024;
+
+    /// If true, one task arena is created per NUMA node with its threads
+    /// pinned to the node, and the events are partitioned between the arenas
+    /// in proportion to their number of threads. The threads are distributed
+    /// evenly over the nodes if `numThreads` is given. Falls back to a single
+    /// arena if the machine topology is unknown or has a single node.
+    bool numaAware = false;
+
+    /// If larger than one, this number of worker processes is forked after
+    /// the sequence elements were initialized. The workers share the memory
+    /// of the main process copy-on-write, e.g. the geometry and the magnetic
+    /// field, and each processes a contiguous share of the events with
+    /// `numThreads` threads. All readers and writers must support running in
+    /// worker processes, see `IReader::beginWorker` and
+    /// `IWriter::beginWorker`. Once all workers completed, the main process
+    /// finalizes the sequence elements, merges the writer outputs and
+    /// summarizes the timing of all workers. Fails if any other thread is
+    /// running when forking, e.g. because the task scheduler was started
+    /// before.
+    std::size_t numProcesses = 1;
+
+    /// If true, the memory every sequence element allocates is accounted
+    /// per event: the number of allocations, the peak during the execution,
+    /// the net amount left after it, and the estimated size of the objects
+    /// it puts on the white board. Heap allocations are seen through the
+    /// replaced global allocation functions, see `AllocationScope`, and
+    /// allocations through `AlgorithmContext::memoryResource` through the
+    /// resource itself. Allocations of tasks an element spawns on other
+    /// threads are not seen, and the net amount can be negative if an
+    /// element releases memory it did not allocate.
+    bool trackMemory = false;
+    /// output name of the memory accounting file
+    std::string outputMemoryFile = "memory.csv";
   };
 
   explicit Sequencer(const Config &cfg);
@@ -155,6 +232,10 @@ class Sequencer {
   const Config &config() const { return m_cfg; }
 
  private:
+  /// Run the event loop, or in multi-process mode distribute the events to
+  /// the worker processes and merge their outputs.
+  int runEvents();
+
   /// List of all configured algorithm names.
   std::vector<std::string> listAlgorithmNames() const;
   /// Determine range of (requested) events;
@@ -167,6 +248,21 @@ class Sequencer {
 
   void fpeReport() const;
 
+  /// Data dependencies between the sequence elements, derived from the keys
+  /// of their data handles.
+  struct DependencyGraph {
+    /// Elements that can only run after the element at the same index
+    std::vector<std::vector<std::size_t>> successors;
+    /// Number of elements that have to complete before each element
+    std::vector<std::size_t> nPredecessors;
+    /// White board keys each element declares through its data handles,
+    /// empty for barriers which may access any key
+    std::vector<std::optional<WhiteBoard::KeySet>> declaredKeys;
+  };
+
+  /// Build the dependency graph of the configured sequence elements
+  DependencyGraph buildDependencyGraph() const;
+
   struct SequenceElementWithFpeResult {
     std::shared_ptr<SequenceElement> sequenceElement;
     std::unique_ptr<
@@ -175,8 +271,18 @@ class Sequencer {
             tbb::enumerable_thread_specific<ActsPlugins::FpeMonitor::Result>>();
   };
 
+  /// Task arena constrained to a single NUMA node
+  struct NumaArena {
+    int node = -1;
+    int concurrency = 0;
+    std::unique_ptr<tbb::task_arena> arena;
+    /// Records the node of the threads entering the arena
+    std::unique_ptr<tbb::task_scheduler_observer> observer;
+  };
+
   Config m_cfg;
   tbbWrap::task_arena m_taskArena;
+  std::vector<NumaArena> m_numaArenas;
   std::vector<std::shared_ptr<IContextDecorator>> m_decorators;
   std::vector<std::shared_ptr<IReader>> m_readers;
   std::vector<std::shared_ptr<IWriter>> m_writers;
@@ -187,6 +293,13 @@ class Sequencer {
 
   DataHandleBase::StateMapType m_whiteBoardState;
 
+  /// White board slots of the keys used by the data handles, assigned when
+  /// the event loop starts
+  std::shared_ptr<const WhiteBoard::SlotLayout> m_slotLayout;
+
+  /// Index of the worker process, set in the worker processes only
+  std::optional<std::size_t> m_worker;
+
   std::atomic<std::size_t> m_nSkippedEvents = 0;
   std::atomic<std::size_t> m_nUnmaskedFpe = 0;
 
@@ -11,16 +11,21 @@
 #include "Acts/Utilities/Any.hpp"
 #include "Acts/Utilities/HashedString.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AllocationTracking.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -32,6 +37,29 @@ namespace ActsExamples {
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
 /// Its lifetime is bound to the lifetime of the white board.
+///
+/// Keys that are known upfront can be assigned dense slots through a
+/// @ref SlotLayout. Objects stored under those keys live in a flat vector and
+/// data handles resolved against the same layout access them by index,
+/// without hashing the key. All other keys are kept in a string-keyed map.
+///
+/// Adding, reading and removing objects is thread-safe, so that independent
+/// sequence elements can access the same white board concurrently. The lock
+/// is only held for the lookup itself: the reference returned by a read stays
+/// valid after it is released, because the objects are held through shared
+/// pointers in node-based storage and adding other keys, including a rehash
+/// of the map, never relocates them. Removing the same key while a reference
+/// to it is in use does invalidate it, so consumers of a key have to be
+/// ordered after all of its readers.
+///
+/// While a @ref DeclaredKeysScope is active on the calling thread, every
+/// access by key is checked against the keys declared by the running
+/// sequence element, so that accesses the scheduler does not know about are
+/// reported instead of silently racing with their producer.
+///
+/// A white board can own a memory resource, e.g. a per-event arena, that
+/// the stored objects allocate from. It is released only after all stored
+/// objects have been destroyed.
 class WhiteBoard {
  public:
   struct StringHash {
@@ -49,35 +77,116 @@ class WhiteBoard {
       std::unordered_map<std::string, StoreValue, StringHash, std::equal_to<>>;
   using AliasMapType = std::unordered_multimap<std::string, std::string,
                                                StringHash, std::equal_to<>>;
+  using KeySet = std::unordered_set<std::string, StringHash, std::equal_to<>>;
+
+  /// Restricts the white board accesses of the current thread to a set of
+  /// declared keys for the lifetime of the scope.
+  ///
+  /// Accessing any other key throws std::logic_error. Scopes can be nested,
+  /// the innermost one is in effect.
+  class DeclaredKeysScope {
+   public:
+    /// @param owner Name of the accessing element, used in error messages
+    /// @param keys Keys the element may access, has to outlive the scope
+    DeclaredKeysScope(std::string_view owner, const KeySet& keys);
+    ~DeclaredKeysScope();
+
+    DeclaredKeysScope(const DeclaredKeysScope&) = delete;
+    DeclaredKeysScope& operator=(const DeclaredKeysScope&) = delete;
+
+   private:
+    friend class WhiteBoard;
+
+    std::string_view m_owner;
+    const KeySet* m_keys;
+    const DeclaredKeysScope* m_previous;
+  };
+
+  /// Assignment of keys to dense slot indices, shared by all white boards of
+  /// one event loop.
+  struct SlotLayout {
+    /// Slot index of each key
+    std::unordered_map<std::string, std::size_t, StringHash, std::equal_to<>>
+        slots;
+    /// Key of each slot
+    std::vector<std::string> keys;
+    /// Slots of the aliases of each slot
+    std::vector<std::vector<std::size_t>> aliases;
+
+    /// Get the slot of a key, assigning a new one if needed
+    std::size_t addKey(const std::string& key);
+
+    /// Register an alias of a key, assigning slots to both if needed
+    void addAlias(const std::string& key, const std::string& alias);
+
+    std::size_t size() const { return keys.size(); }
+  };
 
   explicit WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
                           Acts::getDefaultLogger("WhiteBoard",
                                                  Acts::Logging::INFO),
-                      AliasMapType objectAliases = {});
+                      AliasMapType objectAliases = {},
+                      std::shared_ptr<const SlotLayout> slotLayout = nullptr,
+                      std::shared_ptr<std::pmr::memory_resource>
+                          memoryResource = nullptr);
 
   WhiteBoard(const WhiteBoard& other) = delete;
   WhiteBoard& operator=(const WhiteBoard&) = delete;
 
-  WhiteBoard(WhiteBoard&& other) = default;
-  WhiteBoard& operator=(WhiteBoard&& other) = default;
+  WhiteBoard(WhiteBoard&& other) noexcept;
+  WhiteBoard& operator=(WhiteBoard&& other) noexcept;
 
   bool exists(const std::string& name) const;
 
   /// Copies key from another whiteboard to this whiteboard.
   /// This is a low overhead operation, since the data holders are
-  /// shared pointers.
+  /// shared pointers. The memory resource of the other whiteboard is kept
+  /// alive as long as this whiteboard.
   /// Throws an exception if this whiteboard already contains one of
   /// the keys in the other whiteboard.
   void copyFrom(const WhiteBoard& other);
 
   std::vector<std::string> getKeys() const;
 
+  /// The slot layout used by this white board, may be null
+  const SlotLayout* slotLayout() const { return m_slotLayout.get(); }
+
+  /// The memory resource owned by this white board, or the default memory
+  /// resource if it does not own one
+  std::pmr::memory_resource* memoryResource() const {
+    return m_memoryResource != nullptr ? m_memoryResource.get()
+                                       : std::pmr::get_default_resource();
+  }
+
  private:
   /// Find similar names for suggestions with levenshtein-distance
   std::vector<std::string_view> similarNames(const std::string_view& name,
                                              int distThreshold,
                                              std::size_t maxNumber) const;
 
+  /// Throw if a declared keys scope is active on this thread and does not
+  /// contain the name
+  static void checkDeclared(std::string_view name);
+
+  /// Account the estimated size of an object to the allocation scope of
+  /// the element storing it
+  template <typename T>
+  static void accountStored(const T& object) {
+    if (auto* counter = AllocationScope::current(); counter != nullptr) {
+      counter->store(estimateObjectSize(object));
+    }
+  }
+
+  /// Find the stored value for a name, either in its slot or in the map.
+  /// Returns nullptr if nothing is stored. Requires holding the mutex.
+  const StoreValue* find(std::string_view name) const;
+
+  /// Store a value under a name, either in its slot or in the map.
+  /// Returns false if the name is already taken and overwriting is disabled.
+  /// Requires holding the mutex exclusively.
+  bool store(const std::string& name, const StoreValue& value,
+             bool overwrite);
+
   /// Store a value on the white board.
   ///
   /// @param name Non-empty identifier to store it under
@@ -93,17 +202,37 @@ class WhiteBoard {
                  std::unique_ptr<Acts::AnyMoveOnly> holder,
                  std::uint64_t typeHash);
 
+  /// Store a value in a slot of the white board's layout.
+  ///
+  /// @param slot Slot index in the layout
+  /// @param holder The value to store
+  /// @param typeHash Hash of the stored type for runtime verification
+  /// @throws std::invalid_argument on duplicate name
+  void addSlotHolder(std::size_t slot,
+                     std::shared_ptr<Acts::AnyMoveOnly> holder,
+                     std::uint64_t typeHash);
+
   /// Store an object on the white board and transfer ownership.
   ///
   /// @param name Non-empty identifier to store it under
   /// @param object Movable reference to the transferable object
   template <typename T>
   void add(const std::string& name, T&& object) {
+    accountStored(object);
     addHolder(name,
               std::make_shared<Acts::AnyMoveOnly>(std::forward<T>(object)),
               Acts::typeHash<T>());
   }
 
+  /// Store an object in a slot of the white board's layout.
+  template <typename T>
+  void addToSlot(std::size_t slot, T&& object) {
+    accountStored(object);
+    addSlotHolder(slot,
+                  std::make_shared<Acts::AnyMoveOnly>(std::forward<T>(object)),
+                  Acts::typeHash<T>());
+  }
+
   /// Get access to a stored object.
   ///
   /// @param[in] name Identifier for the object
@@ -112,22 +241,59 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// Get access to an object stored in a slot of the white board's layout.
+  template <typename T>
+  const T& getFromSlot(std::size_t slot) const;
+
   template <typename T>
   Acts::AnyMoveOnly* getHolder(const std::string& name) const;
 
+  template <typename T>
+  Acts::AnyMoveOnly* getSlotHolder(std::size_t slot) const;
+
+  /// Validate existence and type of a stored value. Requires holding the
+  /// mutex.
+  template <typename T>
+  Acts::AnyMoveOnly* checkedHolder(const StoreValue* value,
+                                   const std::string& name) const;
+
   /// Returns (pointer to stored value, type hash). Throws if not found.
   std::pair<Acts::AnyMoveOnly*, std::uint64_t> getHolder(
       const std::string& name) const;
 
+  /// Returns (pointer to stored value, type hash) of a slot. Throws if
+  /// empty.
+  std::pair<Acts::AnyMoveOnly*, std::uint64_t> getSlotHolder(
+      std::size_t slot) const;
+
   template <typename T>
   T pop(const std::string& name);
 
+  template <typename T>
+  T popFromSlot(std::size_t slot);
+
   std::unique_ptr<const Acts::Logger> m_logger;
 
+  // The memory resources are declared before the stores, so that they are
+  // released only after the stored objects have been destroyed
+  std::shared_ptr<std::pmr::memory_resource> m_memoryResource;
+
+  /// Memory resources of the white boards objects were copied from
+  std::vector<std::shared_ptr<std::pmr::memory_resource>>
+      m_retainedMemoryResources;
+
   StoreMapType m_store;
 
   AliasMapType m_objectAliases;
 
+  std::shared_ptr<const SlotLayout> m_slotLayout;
+
+  /// Values stored in the slots of the layout, empty holder if unset
+  std::vector<StoreValue> m_slotStore;
+
+  /// Guards the store against concurrent modification
+  mutable std::shared_mutex m_mutex;
+
   const Acts::Logger& logger() const { return *m_logger; }
 
   static std::string typeMismatchMessage(const std::string& name,
@@ -136,14 +302,46 @@ class WhiteBoard {
   friend class DataHandleBase;
 };
 
-inline WhiteBoard::WhiteBoard(std::unique_ptr<const Acts::Logger> logger,
-                              AliasMapType objectAliases)
-    : m_logger(std::move(logger)), m_objectAliases(std::move(objectAliases)) {}
+inline WhiteBoard::WhiteBoard(
+    std::unique_ptr<const Acts::Logger> logger, AliasMapType objectAliases,
+    std::shared_ptr<const SlotLayout> slotLayout,
+    std::shared_ptr<std::pmr::memory_resource> memoryResource)
+    : m_logger(std::move(logger)),
+      m_memoryResource(std::move(memoryResource)),
+      m_objectAliases(std::move(objectAliases)),
+      m_slotLayout(std::move(slotLayout)) {
+  if (m_slotLayout != nullptr) {
+    m_slotStore.resize(m_slotLayout->size());
+  }
+}
+
+inline WhiteBoard::WhiteBoard(WhiteBoard&& other) noexcept
+    : m_logger(std::move(other.m_logger)),
+      m_memoryResource(std::move(other.m_memoryResource)),
+      m_retainedMemoryResources(std::move(other.m_retainedMemoryResources)),
+      m_store(std::move(other.m_store)),
+      m_objectAliases(std::move(other.m_objectAliases)),
+      m_slotLayout(std::move(other.m_slotLayout)),
+      m_slotStore(std::move(other.m_slotStore)) {}
+
+inline WhiteBoard& WhiteBoard::operator=(WhiteBoard&& other) noexcept {
+  m_logger = std::move(other.m_logger);
+  // Release the current objects before the memory they may live in
+  m_store.clear();
+  m_slotStore.clear();
+  m_memoryResource = std::move(other.m_memoryResource);
+  m_retainedMemoryResources = std::move(other.m_retainedMemoryResources);
+  m_store = std::move(other.m_store);
+  m_objectAliases = std::move(other.m_objectAliases);
+  m_slotLayout = std::move(other.m_slotLayout);
+  m_slotStore = std::move(other.m_slotStore);
+  return *this;
+}
 
 template <typename T>
-Acts::AnyMoveOnly* WhiteBoard::getHolder(const std::string& name) const {
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
+Acts::AnyMoveOnly* WhiteBoard::checkedHolder(const StoreValue* value,
+                                             const std::string& name) const {
+  if (value == nullptr) {
     const auto names = similarNames(name, 10, 3);
 
     std::stringstream ss;
@@ -158,7 +356,7 @@ Acts::AnyMoveOnly* WhiteBoard::getHolder(const std::string& name) const {
     throw std::out_of_range("Object '" + name + "' does not exists" + ss.str());
   }
 
-  auto& [holder, storedTypeHash] = it->second;
+  const auto& [holder, storedTypeHash] = *value;
   if (storedTypeHash != Acts::typeHash<T>()) {
     const char* holderTypeName =
         holder->typeInfo() ? holder->typeInfo()->name() : "unknown";
@@ -170,6 +368,22 @@ Acts::AnyMoveOnly* WhiteBoard::getHolder(const std::string& name) const {
   return holder.get();
 }
 
+template <typename T>
+Acts::AnyMoveOnly* WhiteBoard::getHolder(const std::string& name) const {
+  checkDeclared(name);
+  std::shared_lock lock{m_mutex};
+  return checkedHolder<T>(find(name), name);
+}
+
+template <typename T>
+Acts::AnyMoveOnly* WhiteBoard::getSlotHolder(std::size_t slot) const {
+  checkDeclared(m_slotLayout->keys.at(slot));
+  std::shared_lock lock{m_mutex};
+  const StoreValue& value = m_slotStore.at(slot);
+  return checkedHolder<T>(value.first != nullptr ? &value : nullptr,
+                          m_slotLayout->keys[slot]);
+}
+
 template <typename T>
 inline const T& WhiteBoard::get(const std::string& name) const {
   ACTS_VERBOSE("Attempt to get object '" << name << "' of type "
@@ -179,17 +393,46 @@ inline const T& WhiteBoard::get(const std::string& name) const {
   return holder->template as<T>();
 }
 
+template <typename T>
+inline const T& WhiteBoard::getFromSlot(std::size_t slot) const {
+  ACTS_VERBOSE("Attempt to get object from slot "
+               << slot << " of type " << typeid(T).name());
+  auto* holder = getSlotHolder<T>(slot);
+  return holder->template as<T>();
+}
+
 template <typename T>
 T WhiteBoard::pop(const std::string& name) {
   ACTS_VERBOSE("Pop object '" << name << "'");
   (void)getHolder<T>(name);  // validates type and existence
+  std::unique_lock lock{m_mutex};
+  if (m_slotLayout != nullptr) {
+    if (auto it = m_slotLayout->slots.find(name);
+        it != m_slotLayout->slots.end()) {
+      auto holder = std::move(m_slotStore[it->second].first);
+      m_slotStore[it->second] = {};
+      return holder->template take<T>();
+    }
+  }
   auto node = m_store.extract(name);
   return node.mapped().first->template take<T>();
 }
 
+template <typename T>
+T WhiteBoard::popFromSlot(std::size_t slot) {
+  ACTS_VERBOSE("Pop object from slot " << slot);
+  (void)getSlotHolder<T>(slot);  // validates type and existence
+  std::unique_lock lock{m_mutex};
+  auto holder = std::move(m_slotStore[slot].first);
+  m_slotStore[slot] = {};
+  return holder->template take<T>();
+}
+
 inline bool WhiteBoard::exists(const std::string& name) const {
   // TODO remove this function?
-  return m_store.contains(name);
+  checkDeclared(name);
+  std::shared_lock lock{m_mutex};
+  return find(name) != nullptr;
 }
 
 }  // namespace ActsExamples
@@ -0,0 +1,34 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <vector>
+
+namespace ActsExamples {
+
+/// List the NUMA nodes of the machine.
+///
+/// @return NUMA node ids as used by the task scheduler
+///
+/// Contains a single entry `-1` if the topology is unknown, e.g. if the task
+/// scheduler was built without hwloc support.
+std::vector<int> numaNodes();
+
+/// Index of the NUMA node the calling thread is pinned to.
+///
+/// @return index into `numaNodes()`, or `-1` if the thread is not pinned
+///
+/// Threads are only pinned if the `Sequencer` runs with one task arena per
+/// NUMA node.
+int currentNumaNode();
+
+/// Set the index of the NUMA node the calling thread is pinned to.
+void setCurrentNumaNode(int node);
+
+}  // namespace ActsExamples
@@ -33,6 +33,13 @@ std::string joinPaths(const std::string& dir, const std::string& name);
 std::string perEventFilepath(const std::string& dir, const std::string& name,
                              std::size_t event);
 
+/// Construct the file path used by a worker process of a multi-process
+/// sequencer, e.g. `dir/name.root` becomes `dir/name.worker3.root`.
+///
+/// @params path file path of the complete output
+/// @params worker index of the worker process
+std::string workerFilepath(const std::string& path, std::size_t worker);
+
 /// Determine the range of available events in a directory of per-event files.
 ///
 /// @params dir input directory, current directory if empty
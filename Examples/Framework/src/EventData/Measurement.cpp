@@ -15,6 +15,18 @@ namespace ActsExamples {
 
 MeasurementContainer::MeasurementContainer() = default;
 
+MeasurementContainer::MeasurementContainer(
+    std::pmr::memory_resource* memoryResource)
+    : m_entries(memoryResource),
+      m_geometryIds(memoryResource),
+      m_subspaceIndices(memoryResource),
+      m_parameters(memoryResource),
+      m_covariances(memoryResource) {}
+
+std::pmr::memory_resource* MeasurementContainer::memoryResource() const {
+  return m_entries.get_allocator().resource();
+}
+
 std::size_t MeasurementContainer::size() const {
   return m_entries.size();
 }
@@ -0,0 +1,93 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/EventData/MeasurementSurfaceIndex.hpp"
+
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace ActsExamples {
+
+namespace {
+
+std::vector<Acts::GeometryIdentifier> collectGeometryIds(
+    const Acts::TrackingGeometry& geometry) {
+  std::vector<Acts::GeometryIdentifier> geometryIds;
+  // all surfaces are numbered, as measurements are not restricted to
+  // sensitive surfaces
+  geometry.visitSurfaces(
+      [&](const Acts::Surface* surface) {
+        geometryIds.push_back(surface->geometryId());
+      },
+      false);
+  return geometryIds;
+}
+
+}  // namespace
+
+DenseSurfaceIndex::DenseSurfaceIndex(const Acts::TrackingGeometry& geometry)
+    : DenseSurfaceIndex(collectGeometryIds(geometry)) {}
+
+DenseSurfaceIndex::DenseSurfaceIndex(
+    std::vector<Acts::GeometryIdentifier> geometryIds)
+    : m_geometryIds(std::move(geometryIds)) {
+  // the numbering follows the geometry identifier order so that the indexed
+  // measurements end up in the same order as in the ordered multiset
+  std::sort(m_geometryIds.begin(), m_geometryIds.end());
+  m_geometryIds.erase(std::unique(m_geometryIds.begin(), m_geometryIds.end()),
+                      m_geometryIds.end());
+  if (m_geometryIds.size() >= kInvalidIndex) {
+    throw std::out_of_range("Too many surfaces for a dense surface index");
+  }
+
+  m_indices.reserve(m_geometryIds.size());
+  for (Index i = 0; i < m_geometryIds.size(); ++i) {
+    m_indices.emplace(m_geometryIds[i], i);
+  }
+}
+
+MeasurementSurfaceIndex::MeasurementSurfaceIndex(
+    std::shared_ptr<const DenseSurfaceIndex> surfaces,
+    const MeasurementContainer& measurements)
+    : m_surfaces(std::move(surfaces)) {
+  if (m_surfaces == nullptr) {
+    throw std::invalid_argument("Missing dense surface index");
+  }
+
+  const auto& orderedIndices = measurements.orderedIndices();
+  m_offsets.assign(m_surfaces->size() + 1, 0);
+  m_sourceLinks.reserve(orderedIndices.size());
+
+  // the ordered indices and the dense numbering share the same order, so the
+  // source links can be appended while only the counts have to be collected.
+  // consecutive measurements are usually on the same surface which saves most
+  // of the lookups.
+  Acts::GeometryIdentifier lastGeometryId;
+  DenseSurfaceIndex::Index lastIndex = DenseSurfaceIndex::kInvalidIndex;
+  for (const IndexSourceLink& sourceLink : orderedIndices) {
+    if (sourceLink.geometryId() != lastGeometryId ||
+        lastIndex == DenseSurfaceIndex::kInvalidIndex) {
+      lastGeometryId = sourceLink.geometryId();
+      lastIndex = m_surfaces->index(lastGeometryId);
+    }
+    if (lastIndex == DenseSurfaceIndex::kInvalidIndex) {
+      ++m_nUnassigned;
+      continue;
+    }
+    ++m_offsets[lastIndex + 1];
+    m_sourceLinks.push_back(sourceLink);
+  }
+
+  std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+}
+
+}  // namespace ActsExamples
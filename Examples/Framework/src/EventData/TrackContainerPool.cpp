@@ -0,0 +1,104 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/EventData/TrackContainerPool.hpp"
+
+#include <algorithm>
+
+namespace ActsExamples {
+
+TrackContainer TrackContainerPool::acquire() {
+  std::unique_ptr<Acts::VectorTrackContainer> tracks;
+  std::unique_ptr<Acts::VectorMultiTrajectory> trackStates;
+  {
+    std::lock_guard lock(m_mutex);
+    if (!m_tracks.empty()) {
+      tracks = std::move(m_tracks.back());
+      m_tracks.pop_back();
+    }
+    if (!m_trackStates.empty()) {
+      trackStates = std::move(m_trackStates.back());
+      m_trackStates.pop_back();
+    }
+  }
+
+  // clearing keeps the capacity of all columns
+  if (tracks != nullptr) {
+    tracks->clear();
+  } else {
+    tracks = std::make_unique<Acts::VectorTrackContainer>();
+  }
+  if (trackStates != nullptr) {
+    trackStates->clear();
+  } else {
+    trackStates = std::make_unique<Acts::VectorMultiTrajectory>();
+  }
+
+  return TrackContainer{std::shared_ptr<Acts::VectorTrackContainer>(
+                            std::move(tracks)),
+                        std::shared_ptr<Acts::VectorMultiTrajectory>(
+                            std::move(trackStates))};
+}
+
+void TrackContainerPool::recycle(TrackContainer&& tracks) {
+  recycle(std::make_unique<Acts::VectorTrackContainer>(
+      std::move(tracks.container())));
+  recycle(std::make_unique<Acts::VectorMultiTrajectory>(
+      std::move(tracks.trackStateContainer())));
+}
+
+ConstTrackContainer TrackContainerPool::release(TrackContainer&& tracks) {
+  std::weak_ptr<TrackContainerPool> self = weak_from_this();
+
+  // the storage is moved back into mutable containers once the last user of
+  // the read-only containers is gone
+  std::shared_ptr<Acts::ConstVectorTrackContainer> constTracks(
+      new Acts::ConstVectorTrackContainer(std::move(tracks.container())),
+      [self](Acts::ConstVectorTrackContainer* container) {
+        auto storage =
+            std::make_unique<Acts::VectorTrackContainer>(std::move(*container));
+        delete container;
+        if (auto pool = self.lock()) {
+          pool->recycle(std::move(storage));
+        }
+      });
+
+  std::shared_ptr<Acts::ConstVectorMultiTrajectory> constTrackStates(
+      new Acts::ConstVectorMultiTrajectory(
+          std::move(tracks.trackStateContainer())),
+      [self](Acts::ConstVectorMultiTrajectory* trajectory) {
+        auto storage = std::make_unique<Acts::VectorMultiTrajectory>(
+            std::move(*trajectory));
+        delete trajectory;
+        if (auto pool = self.lock()) {
+          pool->recycle(std::move(storage));
+        }
+      });
+
+  return ConstTrackContainer{std::move(constTracks),
+                             std::move(constTrackStates)};
+}
+
+std::size_t TrackContainerPool::size() const {
+  std::lock_guard lock(m_mutex);
+  return std::min(m_tracks.size(), m_trackStates.size());
+}
+
+void TrackContainerPool::recycle(
+    std::unique_ptr<Acts::VectorTrackContainer> tracks) {
+  std::lock_guard lock(m_mutex);
+  m_tracks.push_back(std::move(tracks));
+}
+
+void TrackContainerPool::recycle(
+    std::unique_ptr<Acts::VectorMultiTrajectory> trackStates) {
+  std::lock_guard lock(m_mutex);
+  m_trackStates.push_back(std::move(trackStates));
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,101 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/AllocationTracking.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+// Replaces the global allocation functions to account the heap allocations
+// to the counter of the innermost allocation scope of the calling thread.
+// The usable size of the allocation is accounted, which is known again on
+// deallocation. The array and nothrow variants forward to the replaced
+// functions by default.
+
+namespace {
+
+constinit thread_local ActsExamples::AllocationCounter* t_counter = nullptr;
+
+std::size_t usableSize(void* ptr) {
+#if defined(__APPLE__)
+  return malloc_size(ptr);
+#else
+  return malloc_usable_size(ptr);
+#endif
+}
+
+void* accountAllocation(void* ptr) {
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  if (t_counter != nullptr) {
+    t_counter->allocate(usableSize(ptr));
+  }
+  return ptr;
+}
+
+void accountDeallocation(void* ptr) {
+  if (ptr != nullptr && t_counter != nullptr) {
+    t_counter->deallocate(usableSize(ptr));
+  }
+  std::free(ptr);
+}
+
+}  // namespace
+
+namespace ActsExamples {
+
+AllocationScope::AllocationScope(AllocationCounter* counter) noexcept
+    : m_previous(t_counter) {
+  t_counter = counter;
+}
+
+AllocationScope::~AllocationScope() noexcept {
+  t_counter = m_previous;
+}
+
+AllocationCounter* AllocationScope::current() noexcept {
+  return t_counter;
+}
+
+}  // namespace ActsExamples
+
+void* operator new(std::size_t size) {
+  return accountAllocation(std::malloc(size == 0 ? 1 : size));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  const auto align = static_cast<std::size_t>(alignment);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const std::size_t padded = (size + align - 1) / align * align;
+  return accountAllocation(
+      std::aligned_alloc(align, padded == 0 ? align : padded));
+}
+
+void operator delete(void* ptr) noexcept {
+  accountDeallocation(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  accountDeallocation(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept {
+  accountDeallocation(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  accountDeallocation(ptr);
+}
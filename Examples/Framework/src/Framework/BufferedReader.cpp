@@ -51,6 +51,8 @@ BufferedReader::BufferedReader(const Config &config, Acts::Logging::Level level)
   }
 
   ACTS_INFO("Filled " << m_buffer.size() << " events into the buffer");
+
+  setStatelessInput();
 }
 
 ProcessCode BufferedReader::read(const AlgorithmContext &ctx) {
@@ -74,11 +74,24 @@ void WriteDataHandleBase::initialize(std::string_view key) {
                                 "' cannot receive empty key"};
   }
   m_key = key;
+  m_slotLayout = nullptr;
 }
 
 void DataHandleBase::maybeInitialize(std::optional<std::string_view> key) {
   if (key.has_value() && !key.value().empty()) {
     m_key = key.value();
+    m_slotLayout = nullptr;
+  }
+}
+
+void DataHandleBase::resolveSlot(const WhiteBoard::SlotLayout& layout) const {
+  m_slotLayout = nullptr;
+  if (!isInitialized()) {
+    return;
+  }
+  if (auto it = layout.slots.find(key()); it != layout.slots.end()) {
+    m_slotLayout = &layout;
+    m_slot = it->second;
   }
 }
 
@@ -120,6 +133,7 @@ void ReadDataHandleBase::initialize(std::string_view key) {
                                 "' cannot receive empty key"};
   }
   m_key = key;
+  m_slotLayout = nullptr;
 }
 
 bool ReadDataHandleBase::isCompatible(const DataHandleBase& other) const {
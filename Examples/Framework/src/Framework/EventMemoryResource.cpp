@@ -0,0 +1,41 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/EventMemoryResource.hpp"
+
+#include <algorithm>
+
+namespace ActsExamples {
+
+EventMemoryResource::EventMemoryResource(std::size_t initialSize,
+                                         std::pmr::memory_resource* upstream)
+    : m_arena(std::max<std::size_t>(initialSize, 1), upstream) {}
+
+std::size_t EventMemoryResource::bytesAllocated() const {
+  std::lock_guard lock{m_mutex};
+  return m_bytesAllocated;
+}
+
+void* EventMemoryResource::do_allocate(std::size_t bytes,
+                                       std::size_t alignment) {
+  std::lock_guard lock{m_mutex};
+  m_bytesAllocated += bytes;
+  return m_arena.allocate(bytes, alignment);
+}
+
+void EventMemoryResource::do_deallocate(void* /*p*/, std::size_t /*bytes*/,
+                                        std::size_t /*alignment*/) {
+  // Memory is released all at once when the arena is destroyed
+}
+
+bool EventMemoryResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,180 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/PrefetchingReader.hpp"
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace ActsExamples {
+
+PrefetchingReader::PrefetchingReader(const Config &config,
+                                     Acts::Logging::Level level)
+    : m_cfg(config) {
+  if (!m_cfg.upstreamReader) {
+    throw std::invalid_argument("No upstream reader provided!");
+  }
+  if (m_cfg.queueSize == 0) {
+    throw std::invalid_argument("Prefetch queue size must be positive");
+  }
+
+  m_logger = Acts::getDefaultLogger(name(), level);
+
+  // Register write and read handles of the upstream reader
+  for (auto rh : m_cfg.upstreamReader->readHandles()) {
+    registerReadHandle(*rh);
+  }
+
+  for (auto wh : m_cfg.upstreamReader->writeHandles()) {
+    registerWriteHandle(*wh);
+  }
+
+  m_firstEvent = m_cfg.upstreamReader->availableEvents().first;
+}
+
+PrefetchingReader::~PrefetchingReader() {
+  stop();
+}
+
+ProcessCode PrefetchingReader::initialize() {
+  return m_cfg.upstreamReader->initialize();
+}
+
+ProcessCode PrefetchingReader::finalize() {
+  stop();
+  return m_cfg.upstreamReader->finalize();
+}
+
+ProcessCode PrefetchingReader::skip(std::size_t events) {
+  {
+    std::lock_guard lock{m_mutex};
+    if (m_thread.joinable()) {
+      ACTS_ERROR("Can not skip events after prefetching has started");
+      return ProcessCode::ABORT;
+    }
+    m_firstEvent = events;
+  }
+  return m_cfg.upstreamReader->skip(events);
+}
+
+ProcessCode PrefetchingReader::read(const AlgorithmContext &ctx) {
+  std::call_once(m_startFlag, [this]() {
+    std::lock_guard lock{m_mutex};
+    m_nextEvent = m_firstEvent;
+    m_thread = std::thread([this]() { prefetch(); });
+  });
+
+  const std::size_t event = ctx.eventNumber;
+
+  Entry entry;
+  {
+    std::unique_lock lock{m_mutex};
+    if (event < m_firstEvent ||
+        (event < m_nextEvent && !m_queue.contains(event))) {
+      ACTS_ERROR("Event " << event
+                          << " is not available for prefetching, events have "
+                             "to be read once in increasing order");
+      return ProcessCode::ABORT;
+    }
+
+    // Requesting an event beyond the queue lifts the size limit until the
+    // background thread reached it
+    if (event >= m_requestedEnd) {
+      m_requestedEnd = event + 1;
+      m_spaceReady.notify_all();
+    }
+
+    m_eventReady.wait(lock, [&]() {
+      return m_queue.contains(event) || (m_done && event >= m_nextEvent);
+    });
+
+    auto it = m_queue.find(event);
+    if (it == m_queue.end()) {
+      ACTS_ERROR("Upstream reader stopped before event " << event);
+      return ProcessCode::ABORT;
+    }
+    entry = std::move(it->second);
+    m_queue.erase(it);
+    m_spaceReady.notify_all();
+  }
+
+  if (entry.exception) {
+    std::rethrow_exception(entry.exception);
+  }
+  if (entry.code != ProcessCode::SUCCESS) {
+    return entry.code;
+  }
+
+  ctx.eventStore.copyFrom(*entry.store);
+  ACTS_DEBUG("Transferred prefetched event " << event);
+
+  return ProcessCode::SUCCESS;
+}
+
+void PrefetchingReader::prefetch() {
+  const std::size_t end = m_cfg.upstreamReader->availableEvents().second;
+
+  while (true) {
+    std::size_t event = 0;
+    {
+      std::unique_lock lock{m_mutex};
+      m_spaceReady.wait(lock, [&]() {
+        return m_stop || m_queue.size() < m_cfg.queueSize ||
+               m_nextEvent < m_requestedEnd;
+      });
+      if (m_stop || m_nextEvent >= end) {
+        m_done = true;
+        m_eventReady.notify_all();
+        return;
+      }
+      event = m_nextEvent;
+    }
+
+    Entry entry;
+    entry.store = std::make_unique<WhiteBoard>(m_logger->clone());
+    try {
+      AlgorithmContext ctx(0, event, *entry.store, 0);
+      entry.code = m_cfg.upstreamReader->read(ctx);
+    } catch (...) {
+      entry.exception = std::current_exception();
+    }
+    const bool failed =
+        entry.exception != nullptr || entry.code != ProcessCode::SUCCESS;
+
+    ACTS_VERBOSE("Prefetched event " << event);
+
+    std::lock_guard lock{m_mutex};
+    m_queue.emplace(event, std::move(entry));
+    ++m_nextEvent;
+    // Events after a failure are not read anymore, the failure is reported
+    // when the failed event is requested
+    m_done = failed;
+    m_eventReady.notify_all();
+    if (failed) {
+      return;
+    }
+  }
+}
+
+void PrefetchingReader::stop() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+  m_spaceReady.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+}  // namespace ActsExamples
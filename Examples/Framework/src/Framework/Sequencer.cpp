@@ -12,6 +12,8 @@
 #include "Acts/Utilities/Table.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/AllocationTracking.hpp"
+#include "ActsExamples/Framework/EventMemoryResource.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsExamples/Framework/IReader.hpp"
@@ -19,23 +21,42 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Numa.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 #include "ActsPlugins/FpeMonitoring/FpeMonitor.hpp"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cctype>
+#include <cerrno>
 #include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <deque>
+#include <exception>
+#include <filesystem>
 #include <fstream>
 #include <functional>
+#include <iostream>
 #include <iterator>
 #include <limits>
+#include <map>
+#include <memory_resource>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <ostream>
 #include <ratio>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
 
 #ifdef ACTS_BUILD_EXAMPLES_ROOT
 #include <TROOT.h>
@@ -43,6 +64,18 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/stacktrace/stacktrace.hpp>
+#include <sys/wait.h>
+#include <tbb/concurrent_queue.h>
+#include <tbb/info.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#endif
 
 namespace ActsExamples {
 
@@ -78,6 +111,28 @@ std::optional<bool> parseBoolEnv(const char* envName) {
       "'. Supported values are: 0/1/false/true/no/yes/off/on");
 }
 
+// Publishes the NUMA node of an arena to the threads working in it
+class NumaNodeObserver final : public tbb::task_scheduler_observer {
+ public:
+  NumaNodeObserver(tbb::task_arena& arena, int node)
+      : tbb::task_scheduler_observer(arena), m_node(node) {
+    observe(true);
+  }
+
+  ~NumaNodeObserver() override { observe(false); }
+
+  void on_scheduler_entry(bool /*isWorker*/) override {
+    setCurrentNumaNode(m_node);
+  }
+
+  void on_scheduler_exit(bool /*isWorker*/) override {
+    setCurrentNumaNode(-1);
+  }
+
+ private:
+  int m_node;
+};
+
 }  // namespace
 
 Sequencer::Sequencer(const Sequencer::Config& cfg)
@@ -94,10 +149,46 @@ Sequencer::Sequencer(const Sequencer::Config& cfg)
   if (m_cfg.numThreads == 1) {
     ACTS_INFO("Create Sequencer (single-threaded)");
   } else {
+    ACTS_INFO("Create Sequencer with " << m_cfg.numThreads << " threads");
+  }
+
+  // Asynchronous writers run concurrently to the event loop even if it is
+  // single-threaded
+  if (m_cfg.numThreads != 1 || m_cfg.asyncWriters) {
 #ifdef ACTS_BUILD_EXAMPLES_ROOT
     ROOT::EnableThreadSafety();
 #endif
-    ACTS_INFO("Create Sequencer with " << m_cfg.numThreads << " threads");
+  }
+
+  if (m_cfg.numaAware && m_cfg.numThreads != 1) {
+    const std::vector<int> nodes = numaNodes();
+    if (nodes.size() < 2) {
+      ACTS_WARNING("NUMA-aware scheduling requested, but "
+                   << (nodes.front() < 0 ? "the NUMA topology is unknown"
+                                         : "there is a single NUMA node")
+                   << ": using a single task arena");
+    } else {
+      const int nNodes = static_cast<int>(nodes.size());
+      for (int i = 0; i < nNodes; ++i) {
+        NumaArena numaArena;
+        numaArena.node = nodes[i];
+        numaArena.concurrency =
+            (m_cfg.numThreads < 0)
+                ? tbb::info::default_concurrency(nodes[i])
+                : m_cfg.numThreads / nNodes + (i < m_cfg.numThreads % nNodes);
+        if (numaArena.concurrency == 0) {
+          continue;
+        }
+        numaArena.arena = std::make_unique<tbb::task_arena>(
+            tbb::task_arena::constraints{nodes[i], numaArena.concurrency});
+        numaArena.observer =
+            std::make_unique<NumaNodeObserver>(*numaArena.arena, i);
+        ACTS_INFO("Create task arena with " << numaArena.concurrency
+                                            << " threads on NUMA node "
+                                            << nodes[i]);
+        m_numaArenas.push_back(std::move(numaArena));
+      }
+    }
   }
 
   if (auto disableFpeEnv = parseBoolEnv("ACTS_SEQUENCER_DISABLE_FPEMON");
@@ -282,6 +373,102 @@ std::pair<std::size_t, std::size_t> Sequencer::determineEventsRange() const {
   return {begSelected, endSelected};
 }
 
+Sequencer::DependencyGraph Sequencer::buildDependencyGraph() const {
+  const std::size_t nElements = m_sequenceElements.size();
+  std::vector<std::set<std::size_t>> predecessors(nElements);
+
+  // Last element that put an object under a key on the white board and the
+  // elements that read it since then
+  struct KeyState {
+    std::optional<std::size_t> writer;
+    std::vector<std::size_t> readers;
+  };
+  std::unordered_map<std::string, KeyState> keyStates;
+  std::optional<std::size_t> lastBarrier;
+
+  DependencyGraph graph;
+  graph.declaredKeys.resize(nElements);
+
+  for (std::size_t i = 0; i < nElements; ++i) {
+    const SequenceElement& element = *m_sequenceElements[i].sequenceElement;
+    auto& pred = predecessors[i];
+
+    // Without data handles we cannot know what the element accesses, so it
+    // has to wait for everything before it and block everything after it
+    if (element.readHandles().empty() && element.writeHandles().empty()) {
+      for (std::size_t j = 0; j < i; ++j) {
+        pred.insert(j);
+      }
+      lastBarrier = i;
+      continue;
+    }
+    if (lastBarrier.has_value()) {
+      pred.insert(*lastBarrier);
+    }
+    // Writers have side effects beyond the white board that cannot be
+    // dropped if an element before them skips the event later on
+    if (dynamic_cast<const IWriter*>(&element) != nullptr) {
+      for (std::size_t j = 0; j < i; ++j) {
+        pred.insert(j);
+      }
+    }
+    auto& declared = graph.declaredKeys[i].emplace();
+
+    for (const auto* handle : element.readHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      declared.insert(handle->key());
+      auto& state = keyStates[handle->key()];
+      if (state.writer.has_value()) {
+        pred.insert(*state.writer);
+      }
+      if (dynamic_cast<const ConsumeDataHandleBase*>(handle) != nullptr) {
+        // Consuming removes the object, so all other readers have to be done
+        pred.insert(state.readers.begin(), state.readers.end());
+        state.writer = i;
+        state.readers.clear();
+      } else {
+        state.readers.push_back(i);
+      }
+    }
+
+    for (const auto* handle : element.writeHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      std::vector<std::string> keys = {handle->key()};
+      for (const auto& [key, alias] : boost::make_iterator_range(
+               m_whiteboardObjectAliases.equal_range(handle->key()))) {
+        keys.push_back(alias);
+      }
+      for (const auto& key : keys) {
+        declared.insert(key);
+        auto& state = keyStates[key];
+        if (state.writer.has_value()) {
+          pred.insert(*state.writer);
+        }
+        pred.insert(state.readers.begin(), state.readers.end());
+        state.writer = i;
+        state.readers.clear();
+      }
+    }
+
+    pred.erase(i);
+  }
+
+  graph.successors.resize(nElements);
+  graph.nPredecessors.resize(nElements, 0);
+  for (std::size_t i = 0; i < nElements; ++i) {
+    graph.nPredecessors[i] = predecessors[i].size();
+    for (std::size_t j : predecessors[i]) {
+      graph.successors[j].push_back(i);
+    }
+  }
+
+  return graph;
+}
+
 // helpers for per-algorithm timing information
 namespace {
 using Clock = std::chrono::high_resolution_clock;
@@ -300,6 +487,140 @@ struct StopWatch {
   ~StopWatch() { store += Clock::now() - start; }
 };
 
+// Records the begin and end of decorator, sequence element and event
+// executions on every thread for export in the Chrome trace event format.
+class TraceRecorder {
+ public:
+  // Identifier used for spans covering a full event
+  static constexpr std::size_t kEventSpan =
+      std::numeric_limits<std::size_t>::max();
+
+  explicit TraceRecorder(Timepoint origin)
+      : m_origin(origin),
+        m_buffers([]() { return ThreadBuffer{osThreadId(), {}}; }) {}
+
+  void record(std::size_t identifier, std::size_t event, Timepoint begin,
+              Timepoint end) {
+    m_buffers.local().spans.push_back({identifier, event, begin, end});
+  }
+
+  // Write all spans as JSON. Identifiers index into the given names, which
+  // are expected to have the form `<category>:<name>`.
+  void write(const std::string& path,
+             const std::vector<std::string>& names) const {
+    std::ofstream file(path);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    auto micros = [&](Timepoint t) {
+      return std::chrono::duration<double, std::micro>(t - m_origin).count();
+    };
+
+    bool first = true;
+    for (const auto& buffer : m_buffers) {
+      file << (first ? "" : ",\n") << R"({"name":"thread_name","ph":"M",)"
+           << R"("pid":0,"tid":)" << buffer.thread
+           << R"(,"args":{"name":"thread )" << buffer.thread << "\"}}";
+      first = false;
+
+      for (const auto& span : buffer.spans) {
+        std::string category = "Event";
+        std::string name = "Event " + std::to_string(span.event);
+        if (span.identifier != kEventSpan) {
+          const auto& identifier = names.at(span.identifier);
+          const auto split = identifier.find(':');
+          category = identifier.substr(0, split);
+          name = identifier.substr(split + 1);
+        }
+        file << ",\n{\"name\":\"" << escape(name) << "\",\"cat\":\""
+             << escape(category) << R"(","ph":"X","pid":0,"tid":)"
+             << buffer.thread << ",\"ts\":" << micros(span.begin)
+             << ",\"dur\":" << micros(span.end) - micros(span.begin)
+             << ",\"args\":{\"event\":" << span.event << "}}";
+      }
+    }
+    file << "\n]}\n";
+  }
+
+ private:
+  struct Span {
+    std::size_t identifier;
+    std::size_t event;
+    Timepoint begin;
+    Timepoint end;
+  };
+
+  struct ThreadBuffer {
+    std::uint64_t thread;
+    std::vector<Span> spans;
+  };
+
+  // Operating system id of the calling thread, as shown by other tools
+  static std::uint64_t osThreadId() {
+#if defined(__linux__)
+    return static_cast<std::uint64_t>(::syscall(SYS_gettid));
+#elif defined(__APPLE__)
+    std::uint64_t id = 0;
+    pthread_threadid_np(nullptr, &id);
+    return id;
+#else
+    return std::hash<std::thread::id>{}(std::this_thread::get_id());
+#endif
+  }
+
+  static std::string escape(const std::string& in) {
+    std::string out;
+    for (char c : in) {
+      switch (c) {
+        case '"':
+          out += "\\\"";
+          break;
+        case '\\':
+          out += "\\\\";
+          break;
+        case '\n':
+          out += "\\n";
+          break;
+        case '\r':
+          out += "\\r";
+          break;
+        case '\t':
+          out += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            std::array<char, 7> code{};
+            std::snprintf(code.data(), code.size(), "\\u%04x",
+                          static_cast<unsigned int>(c));
+            out += code.data();
+          } else {
+            out += c;
+          }
+      }
+    }
+    return out;
+  }
+
+  Timepoint m_origin;
+  tbb::enumerable_thread_specific<ThreadBuffer> m_buffers;
+};
+
+// RAII-based recording of a trace span, no-op without a recorder
+struct TraceScope {
+  TraceRecorder* recorder;
+  std::size_t identifier;
+  std::size_t event;
+  Timepoint start = Clock::now();
+
+  TraceScope(TraceRecorder* r, std::size_t i, std::size_t e)
+      : recorder(r), identifier(i), event(e) {}
+  TraceScope(const TraceScope&) = delete;
+  ~TraceScope() {
+    if (recorder != nullptr) {
+      recorder->record(identifier, event, start, Clock::now());
+    }
+  }
+};
+
 // Convert duration to a printable string w/ reasonable unit.
 template <typename D>
 inline std::string asString(D duration) {
@@ -396,9 +717,442 @@ void printTiming(const std::vector<std::string>& identifiers,
 
   ACTS_INFO("Timing breakdown:\n" << table);
 }
+
+// Accounts the memory that one sequence element allocates through the
+// memory resource of its context. The heap allocations of the resource
+// itself are not accounted again, e.g. when an arena grows.
+class MemoryAccountingResource final : public std::pmr::memory_resource {
+ public:
+  MemoryAccountingResource(std::pmr::memory_resource* upstream,
+                           AllocationCounter& counter)
+      : m_upstream(upstream), m_counter(&counter) {}
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    void* p = nullptr;
+    {
+      AllocationScope pause(nullptr);
+      p = m_upstream->allocate(bytes, alignment);
+    }
+    m_counter->allocate(bytes);
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override {
+    {
+      AllocationScope pause(nullptr);
+      m_upstream->deallocate(p, bytes, alignment);
+    }
+    m_counter->deallocate(bytes);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  std::pmr::memory_resource* m_upstream;
+  AllocationCounter* m_counter;
+};
+
+// Memory used by one sequence element for one event
+struct MemoryRecord {
+  std::size_t event = 0;
+  std::size_t element = 0;
+  // Number of allocations during the execution
+  std::int64_t allocations = 0;
+  // Maximum allocated during the execution
+  std::int64_t peak = 0;
+  // Still allocated when the execution finished
+  std::int64_t net = 0;
+  // Estimated size of the objects put on the white board
+  std::int64_t stored = 0;
+};
+
+// Per-event allocation counters and memory resources, one for every sequence
+// element. They are owned by the event store so they outlive the objects
+// allocated from them, the records are handed over once the event store is
+// released.
+struct EventMemory {
+  using Collector = std::function<void(const EventMemory&)>;
+
+  std::shared_ptr<std::pmr::memory_resource> arena;
+  std::pmr::memory_resource* upstream = nullptr;
+  std::deque<AllocationCounter> counters;
+  std::deque<MemoryAccountingResource> elements;
+  std::vector<std::optional<MemoryRecord>> records;
+  Collector collector;
+
+  EventMemory(std::shared_ptr<std::pmr::memory_resource> arena_,
+              std::size_t nElements, Collector collector_)
+      : arena(std::move(arena_)),
+        upstream(arena != nullptr ? arena.get()
+                                  : std::pmr::get_default_resource()),
+        counters(nElements),
+        records(nElements),
+        collector(std::move(collector_)) {
+    for (auto& counter : counters) {
+      elements.emplace_back(upstream, counter);
+    }
+  }
+
+  EventMemory(const EventMemory&) = delete;
+  EventMemory& operator=(const EventMemory&) = delete;
+
+  ~EventMemory() {
+    if (collector) {
+      collector(*this);
+    }
+  }
+};
+
+void storeMemory(const std::vector<std::string>& identifiers,
+                 std::size_t firstElement,
+                 const std::vector<MemoryRecord>& records,
+                 const std::string& path) {
+  std::ofstream file(path);
+
+  file << "identifier,event,allocations,peak_bytes,net_bytes,stored_bytes\n";
+
+  for (const auto& record : records) {
+    file << identifiers[firstElement + record.element] << "," << record.event
+         << "," << record.allocations << "," << record.peak << ","
+         << record.net << "," << record.stored << "\n";
+  }
+  file << "\n";
+}
+
+void printMemory(const std::vector<std::string>& identifiers,
+                 std::size_t firstElement,
+                 const std::vector<MemoryRecord>& records,
+                 const Acts::Logger& logger) {
+  if (records.empty()) {
+    return;
+  }
+
+  struct Summary {
+    std::size_t nEvents = 0;
+    std::int64_t allocations = 0;
+    std::int64_t maxPeak = 0;
+    double sumPeak = 0;
+    double sumNet = 0;
+    double sumStored = 0;
+  };
+  std::vector<Summary> summaries(identifiers.size() - firstElement);
+  for (const auto& record : records) {
+    auto& summary = summaries[record.element];
+    summary.nEvents++;
+    summary.allocations += record.allocations;
+    summary.maxPeak = std::max(summary.maxPeak, record.peak);
+    summary.sumPeak += static_cast<double>(record.peak);
+    summary.sumNet += static_cast<double>(record.net);
+    summary.sumStored += static_cast<double>(record.stored);
+  }
+
+  constexpr double MB = 1024. * 1024.;
+  Acts::Table table;
+  using enum Acts::Table::Alignment;
+  table.addColumn("Algorithm", "{}", Left);
+  table.addColumn("Allocations/Event", "{:.1f}", Right);
+  table.addColumn("Max Peak (MB)", "{:.2f}", Right);
+  table.addColumn("Peak/Event (MB)", "{:.2f}", Right);
+  table.addColumn("Net/Event (MB)", "{:.2f}", Right);
+  table.addColumn("Stored/Event (MB)", "{:.2f}", Right);
+
+  // Sort by the maximum peak (descending)
+  std::vector<std::size_t> sortedIndices(summaries.size());
+  std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+  std::ranges::sort(sortedIndices, [&](std::size_t a, std::size_t b) {
+    return summaries[a].maxPeak > summaries[b].maxPeak;
+  });
+
+  for (std::size_t idx : sortedIndices) {
+    const auto& summary = summaries[idx];
+    if (summary.nEvents == 0) {
+      continue;
+    }
+    const double n = static_cast<double>(summary.nEvents);
+    table.addRow(identifiers[firstElement + idx],
+                 static_cast<double>(summary.allocations) / n,
+                 static_cast<double>(summary.maxPeak) / MB,
+                 summary.sumPeak / n / MB, summary.sumNet / n / MB,
+                 summary.sumStored / n / MB);
+  }
+
+  ACTS_INFO("Memory breakdown:\n" << table);
+}
+
+// Finished event waiting to be written
+struct PendingEvent {
+  std::unique_ptr<WhiteBoard> store;
+  AlgorithmContext context;
+  std::shared_ptr<EventMemory> memory;
+};
+
+// Hands finished events to one dedicated thread per writer through bounded
+// queues. The event store is released once all writers are done with it.
+// Optionally, events are reordered so that writers see them in event-number
+// order. The reordering happens on a dedicated thread as well, so that the
+// event processing threads never wait for an earlier event to finish.
+class AsyncWriterStage {
+ public:
+  using Process =
+      std::function<void(std::size_t, const PendingEvent&, Duration&)>;
+
+  AsyncWriterStage(std::size_t nWriters, std::size_t capacity, bool ordered,
+                   std::size_t firstEvent, Process process)
+      : m_capacity(std::max<std::size_t>(capacity, 1)),
+        m_ordered(ordered),
+        m_nextEvent(firstEvent),
+        m_process(std::move(process)),
+        m_queues(nWriters),
+        m_clocks(nWriters, Duration::zero()) {
+    for (std::size_t i = 0; i < nWriters; ++i) {
+      m_queues[i].set_capacity(static_cast<std::ptrdiff_t>(m_capacity));
+      m_threads.emplace_back([this, i]() { work(i); });
+    }
+    if (m_ordered) {
+      m_submissions.set_capacity(static_cast<std::ptrdiff_t>(m_capacity));
+      m_orderThread = std::thread([this]() { order(); });
+    }
+  }
+
+  AsyncWriterStage(const AsyncWriterStage&) = delete;
+  AsyncWriterStage& operator=(const AsyncWriterStage&) = delete;
+
+  ~AsyncWriterStage() { stop(); }
+
+  // Submit a finished event. A null event marks a skipped event, which is
+  // not written but still advances the event order. Only blocks if the
+  // writers fall behind, never to wait for an earlier event.
+  void submit(std::size_t eventNumber, std::shared_ptr<PendingEvent> event) {
+    if (m_failed) {
+      abort();
+      rethrowIfFailed();
+    }
+    if (m_aborted) {
+      return;
+    }
+    if (!m_ordered) {
+      if (event != nullptr) {
+        dispatch(event);
+      }
+      return;
+    }
+    m_submissions.push(Submission{eventNumber, std::move(event), false});
+  }
+
+  // Stop writing events, e.g. because an event will never be submitted
+  void abort() { m_aborted = true; }
+
+  // Write all remaining events and wait for the writer threads
+  void finish() {
+    stop();
+    rethrowIfFailed();
+  }
+
+  const std::vector<Duration>& clocks() const { return m_clocks; }
+
+ private:
+  struct Submission {
+    std::size_t eventNumber = 0;
+    std::shared_ptr<PendingEvent> event;
+    bool last = false;
+  };
+
+  void dispatch(const std::shared_ptr<PendingEvent>& event) {
+    for (auto& queue : m_queues) {
+      queue.push(event);
+    }
+  }
+
+  // Collect submitted events and dispatch them in event-number order.
+  // Events that finish ahead of an earlier one are held back here, so the
+  // reorder buffer grows with how far event processing runs ahead.
+  void order() {
+    std::map<std::size_t, std::shared_ptr<PendingEvent>> reorderBuffer;
+    while (true) {
+      Submission submission;
+      m_submissions.pop(submission);
+      if (submission.last) {
+        return;
+      }
+      if (m_aborted) {
+        reorderBuffer.clear();
+        continue;
+      }
+      reorderBuffer.emplace(submission.eventNumber,
+                            std::move(submission.event));
+      while (!reorderBuffer.empty() &&
+             reorderBuffer.begin()->first == m_nextEvent) {
+        auto next = std::move(reorderBuffer.begin()->second);
+        reorderBuffer.erase(reorderBuffer.begin());
+        if (next != nullptr) {
+          dispatch(next);
+        }
+        ++m_nextEvent;
+      }
+    }
+  }
+
+  void work(std::size_t iWriter) {
+    auto& queue = m_queues[iWriter];
+    while (true) {
+      std::shared_ptr<PendingEvent> event;
+      queue.pop(event);
+      if (event == nullptr) {
+        return;
+      }
+      // Keep draining after a failure so producers never block
+      if (m_failed) {
+        continue;
+      }
+      try {
+        m_process(iWriter, *event, m_clocks[iWriter]);
+      } catch (...) {
+        std::scoped_lock lock{m_exceptionMutex};
+        if (!m_failed.exchange(true)) {
+          m_exception = std::current_exception();
+        }
+      }
+    }
+  }
+
+  void stop() {
+    if (m_orderThread.joinable()) {
+      m_submissions.push(Submission{0, nullptr, true});
+      m_orderThread.join();
+    }
+    if (m_threads.empty()) {
+      return;
+    }
+    for (auto& queue : m_queues) {
+      queue.push(nullptr);
+    }
+    for (auto& thread : m_threads) {
+      thread.join();
+    }
+    m_threads.clear();
+  }
+
+  void rethrowIfFailed() {
+    if (m_failed) {
+      std::scoped_lock lock{m_exceptionMutex};
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+  std::size_t m_capacity;
+  bool m_ordered;
+  // Only accessed by the ordering thread
+  std::size_t m_nextEvent;
+  Process m_process;
+
+  tbb::concurrent_bounded_queue<Submission> m_submissions;
+  std::thread m_orderThread;
+
+  std::vector<tbb::concurrent_bounded_queue<std::shared_ptr<PendingEvent>>>
+      m_queues;
+  std::vector<Duration> m_clocks;
+  std::vector<std::thread> m_threads;
+
+  std::atomic<bool> m_aborted = false;
+
+  std::mutex m_exceptionMutex;
+  std::atomic<bool> m_failed = false;
+  std::exception_ptr m_exception;
+};
+
+// Aborts the writer stage when an event is left with an exception, so that
+// other events do not wait for it to be submitted
+struct AbortWriterStageOnFailure {
+  AsyncWriterStage* stage = nullptr;
+  int nExceptions = std::uncaught_exceptions();
+
+  ~AbortWriterStageOnFailure() {
+    if (stage != nullptr && std::uncaught_exceptions() > nExceptions) {
+      stage->abort();
+    }
+  }
+};
+
+// Number of threads of this process, or zero if it can not be determined
+std::size_t countProcessThreads() {
+#if defined(__linux__)
+  std::error_code ec;
+  std::size_t count = 0;
+  for (std::filesystem::directory_iterator it("/proc/self/task", ec), end;
+       !ec && it != end; it.increment(ec)) {
+    ++count;
+  }
+  return ec ? 0 : count;
+#else
+  return 0;
+#endif
+}
+
+// A worker process reports the number of skipped events and unmasked FPEs,
+// followed by the time spent in each algorithm in nanoseconds, to the main
+// process through a pipe
+using WorkerReport = std::vector<std::int64_t>;
+
+bool writeWorkerReport(int fd, const WorkerReport& report) {
+  const auto* data = reinterpret_cast<const char*>(report.data());
+  std::size_t remaining = report.size() * sizeof(std::int64_t);
+  while (remaining > 0) {
+    const ssize_t n = write(fd, data, remaining);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    remaining -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+bool readWorkerReport(int fd, WorkerReport& report) {
+  auto* data = reinterpret_cast<char*>(report.data());
+  std::size_t remaining = report.size() * sizeof(std::int64_t);
+  while (remaining > 0) {
+    const ssize_t n = read(fd, data, remaining);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    // The pipe is closed without a report if the worker failed early
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    remaining -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
 }  // namespace
 
 int Sequencer::run() {
+  int result = EXIT_FAILURE;
+  try {
+    result = runEvents();
+  } catch (const std::exception& e) {
+    if (!m_worker.has_value()) {
+      throw;
+    }
+    ACTS_FATAL("Worker " << *m_worker << " failed: " << e.what());
+  }
+  // Worker processes must not return into the caller of the main process
+  if (m_worker.has_value()) {
+    std::cout.flush();
+    std::fflush(nullptr);
+    std::_Exit(result);
+  }
+  return result;
+}
+
+int Sequencer::runEvents() {
   // measure overall wall clock
   Timepoint clockWallStart = Clock::now();
   // per-algorithm time measures
@@ -408,7 +1162,9 @@ int Sequencer::run() {
 
   // processing only works w/ a well-known number of events
   // error message is already handled by the helper function
-  const auto [firstEvent, lastEvent] = determineEventsRange();
+  std::size_t firstEvent = 0;
+  std::size_t lastEvent = 0;
+  std::tie(firstEvent, lastEvent) = determineEventsRange();
   if ((firstEvent == std::numeric_limits<std::size_t>::max()) &&
       (lastEvent == std::numeric_limits<std::size_t>::max())) {
     return EXIT_FAILURE;
@@ -452,6 +1208,252 @@ int Sequencer::run() {
     }
   }
 
+  // Writers are either executed in the event loop or deferred to the
+  // asynchronous writer stage
+  std::vector<bool> deferred(m_sequenceElements.size(), false);
+  std::vector<std::size_t> asyncWriterIndices;
+  if (m_cfg.asyncWriters) {
+    for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+      const auto& alg = m_sequenceElements[i].sequenceElement;
+      if (dynamic_cast<const IWriter*>(alg.get()) == nullptr) {
+        continue;
+      }
+      // Deferred writers see the event store after all other elements ran,
+      // so nothing may consume their inputs in the meantime
+      for (std::size_t j = i + 1; j < m_sequenceElements.size(); ++j) {
+        const auto& later = m_sequenceElements[j].sequenceElement;
+        for (const auto* consume : later->readHandles()) {
+          if (dynamic_cast<const ConsumeDataHandleBase*>(consume) == nullptr ||
+              !consume->isInitialized()) {
+            continue;
+          }
+          for (const auto* read : alg->readHandles()) {
+            if (read->isInitialized() && read->key() == consume->key()) {
+              throw SequenceConfigurationException{
+                  "Asynchronous writer '" + alg->name() + "' reads key '" +
+                  read->key() + "' consumed later by '" + later->name() +
+                  "'"};
+            }
+          }
+        }
+      }
+      deferred[i] = true;
+      asyncWriterIndices.push_back(i);
+    }
+    ACTS_INFO("Run " << asyncWriterIndices.size()
+                     << " writers asynchronously with a queue size of "
+                     << m_cfg.writerQueueSize
+                     << (m_cfg.writeEventsInOrder ? " in event order" : ""));
+  }
+
+  // Assign dense white board slots to all keys known from the data handles,
+  // so that handle accesses do not need to hash the key
+  auto slotLayout = std::make_shared<WhiteBoard::SlotLayout>();
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto& handles : {alg->readHandles(), alg->writeHandles()}) {
+      for (const auto* handle : handles) {
+        if (handle->isInitialized()) {
+          slotLayout->addKey(handle->key());
+        }
+      }
+    }
+  }
+  for (const auto& [key, alias] : m_whiteboardObjectAliases) {
+    if (slotLayout->slots.contains(key)) {
+      slotLayout->addAlias(key, alias);
+    }
+  }
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto& handles : {alg->readHandles(), alg->writeHandles()}) {
+      for (const auto* handle : handles) {
+        handle->resolveSlot(*slotLayout);
+      }
+    }
+  }
+  m_slotLayout = std::move(slotLayout);
+  ACTS_DEBUG("Resolved " << m_slotLayout->size() << " white board slots");
+
+  // End of the run, also in the main process of a multi-process run
+  auto finalizeElements = [&]() {
+    ACTS_VERBOSE("Finalize sequence elements");
+    for (auto& [alg, fpe] : m_sequenceElements) {
+      ACTS_VERBOSE("Finalize " << alg->typeName() << ": " << alg->name());
+      try {
+        if (alg->finalize() != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to process event data");
+        }
+      } catch (const std::exception& e) {
+        ACTS_FATAL("Failed to finalize " << alg->typeName() << " \""
+                                         << alg->name() << "\"" << e.what());
+        throw;
+      }
+    }
+
+    fpeReport();
+  };
+  auto summarizeTiming = [&]() {
+    Duration totalWall = Clock::now() - clockWallStart;
+    Duration totalReal = std::accumulate(
+        clocksAlgorithms.begin(), clocksAlgorithms.end(), Duration::zero());
+    std::size_t numEvents = lastEvent - firstEvent;
+    if (m_nSkippedEvents > 0) {
+      ACTS_INFO("Attention: Skipped " << m_nSkippedEvents
+                                      << " events during execution");
+      ACTS_INFO(
+          "As this can happen if any algorithm is configured to skip events, "
+          "processed event and timing information are not accurate.");
+    }
+    ACTS_INFO("Processed " << numEvents << " events in "
+                           << asString(totalWall) << " (wall clock)");
+    ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
+    ACTS_DEBUG("Average time per algorithm:");
+    for (std::size_t i = 0; i < names.size(); ++i) {
+      ACTS_DEBUG("  " << names[i] << ": "
+                      << perEvent(clocksAlgorithms[i], numEvents));
+    }
+
+    printTiming(names, clocksAlgorithms, numEvents, logger());
+
+    if (!m_cfg.outputDir.empty()) {
+      storeTiming(names, clocksAlgorithms, numEvents,
+                  joinPaths(m_cfg.outputDir, m_cfg.outputTimingFile));
+    }
+  };
+
+  // In multi-process mode, the main process only distributes the events,
+  // merges the outputs and summarizes the run. The workers continue with
+  // their share of the events.
+  int workerReport = -1;
+  if (m_cfg.numProcesses > 1) {
+    // Only the forking thread exists in the workers, so any other thread, e.g.
+    // of an already started task scheduler, would leave them inconsistent
+    const std::size_t nThreads = countProcessThreads();
+    if (nThreads > 1) {
+      throw SequenceConfigurationException(
+          "Can not fork worker processes while " + std::to_string(nThreads) +
+          " threads are running, the task scheduler must not have been "
+          "started before");
+    } else if (nThreads == 0) {
+      ACTS_WARNING("Can not verify that no other threads are running before "
+                   "forking the worker processes");
+    }
+
+    const std::size_t nEvents = lastEvent - firstEvent;
+    std::vector<pid_t> workers;
+    std::vector<int> reports;
+    auto terminateWorkers = [&]() {
+      for (std::size_t w = 0; w < workers.size(); ++w) {
+        kill(workers[w], SIGTERM);
+        waitpid(workers[w], nullptr, 0);
+        close(reports[w]);
+      }
+    };
+    for (std::size_t w = 0; w < m_cfg.numProcesses; ++w) {
+      const std::size_t begin = firstEvent + nEvents * w / m_cfg.numProcesses;
+      const std::size_t end =
+          firstEvent + nEvents * (w + 1) / m_cfg.numProcesses;
+      ACTS_INFO("Fork worker " << w << " for events [" << begin << ", " << end
+                               << ")");
+      std::array<int, 2> pipeFds{};
+      if (pipe(pipeFds.data()) != 0) {
+        terminateWorkers();
+        throw std::runtime_error("Failed to create worker report pipe");
+      }
+      // Buffered output would otherwise be printed by every worker again
+      std::cout.flush();
+      std::fflush(nullptr);
+      const pid_t pid = fork();
+      if (pid < 0) {
+        close(pipeFds[0]);
+        close(pipeFds[1]);
+        terminateWorkers();
+        throw std::runtime_error("Failed to fork worker process");
+      }
+      if (pid == 0) {
+        for (int report : reports) {
+          close(report);
+        }
+        close(pipeFds[0]);
+        workerReport = pipeFds[1];
+        m_worker = w;
+        firstEvent = begin;
+        lastEvent = end;
+        break;
+      }
+      close(pipeFds[1]);
+      workers.push_back(pid);
+      reports.push_back(pipeFds[0]);
+    }
+
+    if (!m_worker.has_value()) {
+      bool failed = false;
+      WorkerReport report(2 + names.size());
+      for (std::size_t w = 0; w < workers.size(); ++w) {
+        const bool received = readWorkerReport(reports[w], report);
+        close(reports[w]);
+        int status = 0;
+        if (waitpid(workers[w], &status, 0) < 0 || !WIFEXITED(status) ||
+            WEXITSTATUS(status) != EXIT_SUCCESS) {
+          ACTS_ERROR("Worker " << w << " failed");
+          failed = true;
+          continue;
+        }
+        if (!received) {
+          ACTS_ERROR("Worker " << w << " did not report its run summary");
+          failed = true;
+          continue;
+        }
+        m_nSkippedEvents += static_cast<std::size_t>(report[0]);
+        m_nUnmaskedFpe += static_cast<std::size_t>(report[1]);
+        for (std::size_t i = 0; i < names.size(); ++i) {
+          clocksAlgorithms[i] += std::chrono::duration_cast<Duration>(
+              std::chrono::nanoseconds(report[2 + i]));
+        }
+      }
+      ACTS_INFO("All " << workers.size() << " workers completed");
+
+      // The elements of the main process did not see any event, the writers
+      // release their outputs before the worker outputs are merged into them
+      finalizeElements();
+      for (const auto& writer : m_writers) {
+        if (!failed &&
+            writer->mergeWorkers(workers.size()) != ProcessCode::SUCCESS) {
+          ACTS_ERROR("Failed to merge the worker outputs of writer '"
+                     << writer->name() << "'");
+          failed = true;
+        }
+      }
+      if (failed) {
+        return EXIT_FAILURE;
+      }
+      summarizeTiming();
+
+      if (m_cfg.failOnUnmaskedFpe && m_nUnmaskedFpe > 0) {
+        return EXIT_FAILURE;
+      }
+      return EXIT_SUCCESS;
+    }
+
+    m_logger = Acts::getDefaultLogger("Sequencer#" + std::to_string(*m_worker),
+                                      m_cfg.logLevel);
+    m_cfg.outputTraceFile = workerFilepath(m_cfg.outputTraceFile, *m_worker);
+    m_cfg.outputMemoryFile = workerFilepath(m_cfg.outputMemoryFile, *m_worker);
+    for (const auto& reader : m_readers) {
+      if (reader->beginWorker(*m_worker) != ProcessCode::SUCCESS) {
+        throw SequenceConfigurationException(
+            "Reader '" + reader->name() +
+            "' does not support running in worker processes");
+      }
+    }
+    for (const auto& writer : m_writers) {
+      if (writer->beginWorker(*m_worker) != ProcessCode::SUCCESS) {
+        throw SequenceConfigurationException(
+            "Writer '" + writer->name() +
+            "' does not support running in worker processes");
+      }
+    }
+  }
+
   // Inform readers that we're going to start from a specific event number
   for (const auto& reader : m_readers) {
     if (reader->skip(firstEvent) != ProcessCode::SUCCESS) {
@@ -469,9 +1471,134 @@ int Sequencer::run() {
 
   std::atomic<std::size_t> nextEvent = firstEvent;
 
-  m_taskArena.execute([&] {
+  std::optional<TraceRecorder> trace;
+  if (m_cfg.recordTrace) {
+    trace.emplace(clockWallStart);
+  }
+  TraceRecorder* tracePtr = trace ? &trace.value() : nullptr;
+
+  std::vector<MemoryRecord> memoryRecords;
+  std::mutex memoryRecordsMutex;
+  auto collectMemoryRecords = [&](const EventMemory& memory) {
+    std::lock_guard lock{memoryRecordsMutex};
+    for (const auto& record : memory.records) {
+      if (record.has_value()) {
+        memoryRecords.push_back(*record);
+      }
+    }
+  };
+
+  // Execute a single sequence element for one event. Returns false if the
+  // element requested to skip the rest of the event.
+  auto executeElement = [&](std::size_t i, AlgorithmContext& context,
+                            Duration& clock, EventMemory* memory) {
+    auto& [alg, fpe] = m_sequenceElements[i];
+    std::optional<ActsPlugins::FpeMonitor> mon;
+    if (m_cfg.trackFpes) {
+      mon.emplace();
+      context.fpeMonitor = &mon.value();
+    }
+    std::optional<AllocationScope> allocationScope;
+    if (memory != nullptr) {
+      context.memoryResource = &memory->elements[i];
+      allocationScope.emplace(&memory->counters[i]);
+    }
+    StopWatch sw(clock);
+    TraceScope ts(tracePtr, m_decorators.size() + i, context.eventNumber);
+    ACTS_VERBOSE("Execute " << alg->typeName() << ": " << alg->name());
+    try {
+      auto processCode = alg->internalExecute(context);
+      if (processCode == ProcessCode::SKIP) {
+        ACTS_VERBOSE("Skip event signal received from "
+                     << alg->typeName() << ": " << alg->name());
+        return false;
+      } else if (processCode != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    } catch (const std::exception& e) {
+      ACTS_FATAL("Failed to execute " << alg->typeName() << " \""
+                                      << alg->name() << "\": " << e.what());
+      throw;
+    }
+    ACTS_VERBOSE("Completed " << alg->typeName() << ": " << alg->name());
+
+    if (memory != nullptr) {
+      allocationScope.reset();
+      const auto& counter = memory->counters[i];
+      memory->records[i] = MemoryRecord{context.eventNumber, i,
+                                        counter.allocations(), counter.peak(),
+                                        counter.live(), counter.stored()};
+    }
+
+    if (mon) {
+      auto& local = fpe->local();
+
+      for (const auto& info : mon->result().stackTraces()) {
+        const auto count = info.count;
+        const auto type = info.type;
+        const auto& st = *info.st;
+        auto [maskLoc, nMasked] = fpeMaskCount(st, type);
+        if (nMasked < count) {
+          std::stringstream ss;
+          ss << "FPE of type " << type
+             << " exceeded configured per-event threshold of " << nMasked
+             << " (mask: " << maskLoc << ") (seen: " << count << " FPEs)\n"
+             << ActsPlugins::FpeMonitor::stackTraceToString(
+                    st, m_cfg.fpeStackTraceLength);
+
+          m_nUnmaskedFpe += (count - nMasked);
+
+          if (m_cfg.failOnFirstFpe && m_cfg.failOnUnmaskedFpe) {
+            ACTS_ERROR(ss.str());
+            local.merge(mon->result());  // merge so we get correct
+                                         // results after throwing
+            throw FpeFailure{ss.str()};
+          } else if (m_cfg.failOnUnmaskedFpe && !local.contains(info)) {
+            ACTS_INFO(ss.str());
+          }
+        }
+      }
+
+      local.merge(mon->result());
+    }
+    context.fpeMonitor = nullptr;
+    return true;
+  };
+
+  // Intra-event scheduling needs actual threads to be useful
+  const bool scheduleConcurrently =
+      m_cfg.intraEventParallelism && tbbWrap::enableTBB();
+  DependencyGraph graph;
+  if (scheduleConcurrently) {
+    graph = buildDependencyGraph();
+    ACTS_INFO("Scheduling sequence elements concurrently within events");
+    for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+      const auto& alg = m_sequenceElements[i].sequenceElement;
+      ACTS_DEBUG("  " << alg->typeName() << " '" << alg->name()
+                      << "' waits for " << graph.nPredecessors[i]
+                      << " element(s)");
+    }
+  }
+
+  std::optional<AsyncWriterStage> writerStage;
+  if (!asyncWriterIndices.empty()) {
+    writerStage.emplace(
+        asyncWriterIndices.size(), m_cfg.writerQueueSize,
+        m_cfg.writeEventsInOrder, firstEvent,
+        [&](std::size_t iWriter, const PendingEvent& pending, Duration& clock) {
+          const std::size_t i = asyncWriterIndices[iWriter];
+          AlgorithmContext context = pending.context;
+          context.algorithmNumber += i + 1;
+          executeElement(i, context, clock, pending.memory.get());
+        });
+  }
+
+  // Process events in the calling task arena. Event numbers are taken from
+  // the shared counter until all events are done, so several arenas can do
+  // this concurrently and balance their load.
+  auto processEvents = [&]() {
     tbbWrap::parallel_for(
-        tbb::blocked_range<std::size_t>(firstEvent, lastEvent),
+        tbb::blocked_range<std::size_t>(0, nTotalEvents),
         [&](const tbb::blocked_range<std::size_t>& r) {
           std::vector<Duration> localClocksAlgorithms(names.size(),
                                                       Duration::zero());
@@ -480,29 +1607,52 @@ int Sequencer::run() {
           for (std::size_t n = r.begin(); n != r.end(); ++n) {
             ACTS_VERBOSE("Thread about to pick next event");
 
+            std::size_t event = nextEvent++;
+            if (event >= lastEvent) {
+              // Other arenas took the remaining events
+              break;
+            }
+
             for (const auto& writer : m_writers) {
               if (writer->beginEvent(threadId) != ProcessCode::SUCCESS) {
                 throw std::runtime_error("Failed to process event data");
               }
             }
 
-            std::size_t event = nextEvent++;
+            AbortWriterStageOnFailure abortGuard{
+                writerStage ? &writerStage.value() : nullptr};
+            TraceScope eventScope(tracePtr, TraceRecorder::kEventSpan, event);
 
             ACTS_DEBUG("start processing event " << event << " on thread "
                                                  << threadId);
             m_cfg.iterationCallback();
-            // Use per-event store
-            WhiteBoard eventStore(
+            // Use per-event store, which might outlive this iteration if it
+            // is handed over to asynchronous writers
+            std::shared_ptr<std::pmr::memory_resource> eventArena;
+            if (m_cfg.eventArena) {
+              eventArena =
+                  std::make_shared<EventMemoryResource>(m_cfg.eventArenaSize);
+            }
+            std::shared_ptr<EventMemory> eventMemory;
+            if (m_cfg.trackMemory) {
+              eventMemory = std::make_shared<EventMemory>(
+                  std::move(eventArena), m_sequenceElements.size(),
+                  collectMemoryRecords);
+              // The store owns the accounting resources through the arena
+              eventArena = std::shared_ptr<std::pmr::memory_resource>(
+                  eventMemory, eventMemory->upstream);
+            }
+            auto eventStore = std::make_unique<WhiteBoard>(
                 Acts::getDefaultLogger("EventStore#" + std::to_string(event),
                                        m_cfg.logLevel),
-                m_whiteboardObjectAliases);
-            // If we ever wanted to run algorithms in parallel, this needs to
-            // be changed to Algorithm context copies
-            AlgorithmContext context(0, event, eventStore, threadId);
+                m_whiteboardObjectAliases, m_slotLayout, eventArena);
+            AlgorithmContext context(0, event, *eventStore, threadId);
+            context.memoryResource = eventStore->memoryResource();
             std::size_t ialgo = 0;
 
             /// Decorate the context
             for (auto& cdr : m_decorators) {
+              TraceScope ts(tracePtr, ialgo, event);
               StopWatch sw(localClocksAlgorithms[ialgo++]);
               ACTS_VERBOSE("Execute context decorator: " << cdr->name());
               if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
@@ -511,69 +1661,106 @@ int Sequencer::run() {
             }
 
             ACTS_VERBOSE("Execute sequence elements");
-
-            for (auto& [alg, fpe] : m_sequenceElements) {
-              std::optional<ActsPlugins::FpeMonitor> mon;
-              if (m_cfg.trackFpes) {
-                mon.emplace();
-                context.fpeMonitor = &mon.value();
+            bool skipped = false;
+
+            if (scheduleConcurrently) {
+              // Every element owns a dedicated copy of the context, numbered
+              // as if the elements were executed in sequence
+              const std::size_t firstAlgorithm = ialgo;
+              std::vector<std::atomic<std::size_t>> nPending(
+                  m_sequenceElements.size());
+              for (std::size_t i = 0; i < nPending.size(); ++i) {
+                nPending[i] = graph.nPredecessors[i];
               }
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute " << alg->typeName() << ": "
-                                      << alg->name());
-              try {
-                auto processCode = alg->internalExecute(++context);
-                if (processCode == ProcessCode::SKIP) {
-                  ACTS_VERBOSE("Skip event signal received from "
-                               << alg->typeName() << ": " << alg->name());
+              // Lowest index of an element that skipped the event. As in
+              // sequential mode, elements after it in the sequence are not
+              // executed anymore, but the ones before it still are.
+              const std::size_t nElements = m_sequenceElements.size();
+              std::atomic<std::size_t> skipIndex = nElements;
+
+              tbb::task_group group;
+              std::function<void(std::size_t)> schedule = [&](std::size_t i) {
+                group.run([&, i]() {
+                  if (i < skipIndex && !deferred[i]) {
+                    AlgorithmContext elementContext = context;
+                    elementContext.algorithmNumber += i + 1;
+                    // Isolated, so that the declared keys of this element
+                    // are not applied to tasks of other elements stolen
+                    // while it waits for its own nested tasks
+                    bool completed = tbb::this_task_arena::isolate([&]() {
+                      std::optional<WhiteBoard::DeclaredKeysScope> scope;
+                      if (const auto& keys = graph.declaredKeys[i]) {
+                        scope.emplace(
+                            m_sequenceElements[i].sequenceElement->name(),
+                            *keys);
+                      }
+                      return executeElement(
+                          i, elementContext,
+                          localClocksAlgorithms[firstAlgorithm + i],
+                          eventMemory.get());
+                    });
+                    if (!completed) {
+                      std::size_t previous = skipIndex;
+                      while (i < previous &&
+                             !skipIndex.compare_exchange_weak(previous, i)) {
+                      }
+                      if (previous == nElements) {
+                        m_nSkippedEvents++;
+                      }
+                    }
+                  }
+                  for (std::size_t j : graph.successors[i]) {
+                    if (--nPending[j] == 0) {
+                      schedule(j);
+                    }
+                  }
+                });
+              };
+
+              // Isolate the event so this thread does not start processing
+              // another event while waiting for the elements of this one
+              tbb::this_task_arena::isolate([&]() {
+                for (std::size_t i = 0; i < nPending.size(); ++i) {
+                  if (graph.nPredecessors[i] == 0) {
+                    schedule(i);
+                  }
+                }
+                group.wait();
+              });
+              skipped = skipIndex < nElements;
+              // Elements after the skipping one could already have been
+              // running. Their white board objects are dropped together with
+              // the event store, drop their memory records as well so the
+              // outcome matches sequential execution.
+              if (skipped && eventMemory != nullptr) {
+                for (std::size_t i = skipIndex + 1; i < nElements; ++i) {
+                  eventMemory->records[i].reset();
+                }
+              }
+            } else {
+              for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+                ++context;
+                if (deferred[i]) {
+                  continue;
+                }
+                if (!executeElement(i, context,
+                                    localClocksAlgorithms[ialgo + i],
+                                    eventMemory.get())) {
                   m_nSkippedEvents++;
+                  skipped = true;
                   break;
-                } else if (processCode != ProcessCode::SUCCESS) {
-                  throw std::runtime_error("Failed to process event data");
                 }
-              } catch (const std::exception& e) {
-                ACTS_FATAL("Failed to execute " << alg->typeName() << " \""
-                                                << alg->name()
-                                                << "\": " << e.what());
-                throw;
               }
-              ACTS_VERBOSE("Completed " << alg->typeName() << ": "
-                                        << alg->name());
-
-              if (mon) {
-                auto& local = fpe->local();
-
-                for (const auto& info : mon->result().stackTraces()) {
-                  const auto count = info.count;
-                  const auto type = info.type;
-                  const auto& st = *info.st;
-                  auto [maskLoc, nMasked] = fpeMaskCount(st, type);
-                  if (nMasked < count) {
-                    std::stringstream ss;
-                    ss << "FPE of type " << type
-                       << " exceeded configured per-event threshold of "
-                       << nMasked << " (mask: " << maskLoc
-                       << ") (seen: " << count << " FPEs)\n"
-                       << ActsPlugins::FpeMonitor::stackTraceToString(
-                              st, m_cfg.fpeStackTraceLength);
-
-                    m_nUnmaskedFpe += (count - nMasked);
-
-                    if (m_cfg.failOnFirstFpe && m_cfg.failOnUnmaskedFpe) {
-                      ACTS_ERROR(ss.str());
-                      local.merge(mon->result());  // merge so we get correct
-                                                   // results after throwing
-                      throw FpeFailure{ss.str()};
-                    } else if (m_cfg.failOnUnmaskedFpe &&
-                               !local.contains(info)) {
-                      ACTS_INFO(ss.str());
-                    }
-                  }
-                }
+            }
 
-                local.merge(mon->result());
+            if (writerStage) {
+              std::shared_ptr<PendingEvent> pending;
+              if (!skipped) {
+                pending = std::make_shared<PendingEvent>(PendingEvent{
+                    std::move(eventStore), context, std::move(eventMemory)});
+                pending->context.algorithmNumber = m_decorators.size();
               }
-              context.fpeMonitor = nullptr;
+              writerStage->submit(event, std::move(pending));
             }
 
             nProcessedEvents++;
@@ -595,50 +1782,82 @@ int Sequencer::run() {
             }
           }
         });
-  });
+  };
 
-  ACTS_VERBOSE("Finalize sequence elements");
-  for (auto& [alg, fpe] : m_sequenceElements) {
-    ACTS_VERBOSE("Finalize " << alg->typeName() << ": " << alg->name());
-    try {
-      if (alg->finalize() != ProcessCode::SUCCESS) {
-        throw std::runtime_error("Failed to process event data");
+  if (m_numaArenas.empty()) {
+    m_taskArena.execute([&] { processEvents(); });
+  } else {
+    // Process events on all NUMA nodes concurrently. They share the event
+    // counter, so a node that falls behind does not hold up the others.
+    std::vector<std::exception_ptr> failures(m_numaArenas.size());
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < m_numaArenas.size(); ++i) {
+      ACTS_DEBUG("Process events on NUMA node "
+                 << m_numaArenas[i].node << " with "
+                 << m_numaArenas[i].concurrency << " threads");
+      threads.emplace_back([&, i]() {
+        try {
+          m_numaArenas[i].arena->execute([&] { processEvents(); });
+        } catch (...) {
+          failures[i] = std::current_exception();
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (const auto& failure : failures) {
+      if (failure) {
+        std::rethrow_exception(failure);
       }
-    } catch (const std::exception& e) {
-      ACTS_FATAL("Failed to finalize " << alg->typeName() << " \""
-                                       << alg->name() << "\"" << e.what());
-      throw;
     }
   }
 
-  fpeReport();
-
-  // summarize timing
-  Duration totalWall = Clock::now() - clockWallStart;
-  Duration totalReal = std::accumulate(
-      clocksAlgorithms.begin(), clocksAlgorithms.end(), Duration::zero());
-  std::size_t numEvents = lastEvent - firstEvent;
-  if (m_nSkippedEvents > 0) {
-    ACTS_INFO("Attention: Skipped " << m_nSkippedEvents
-                                    << " events during execution");
-    ACTS_INFO(
-        "As this can happen if any algorithm is configured to skip events, "
-        "processed event and timing information are not accurate.");
+  if (writerStage) {
+    writerStage->finish();
+    for (std::size_t i = 0; i < asyncWriterIndices.size(); ++i) {
+      clocksAlgorithms[m_decorators.size() + asyncWriterIndices[i]] +=
+          writerStage->clocks()[i];
+    }
   }
-  ACTS_INFO("Processed " << numEvents << " events in " << asString(totalWall)
-                         << " (wall clock)");
-  ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
-  ACTS_DEBUG("Average time per algorithm:");
-  for (std::size_t i = 0; i < names.size(); ++i) {
-    ACTS_DEBUG("  " << names[i] << ": "
-                    << perEvent(clocksAlgorithms[i], numEvents));
+
+  finalizeElements();
+
+  if (m_worker.has_value()) {
+    // The main process summarizes the timing of all workers
+    WorkerReport report;
+    report.reserve(2 + names.size());
+    report.push_back(static_cast<std::int64_t>(m_nSkippedEvents.load()));
+    report.push_back(static_cast<std::int64_t>(m_nUnmaskedFpe.load()));
+    for (const auto& clock : clocksAlgorithms) {
+      report.push_back(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(clock).count());
+    }
+    const bool reported = writeWorkerReport(workerReport, report);
+    close(workerReport);
+    if (!reported) {
+      throw std::runtime_error("Failed to report to the main process");
+    }
+  } else {
+    summarizeTiming();
   }
 
-  printTiming(names, clocksAlgorithms, numEvents, logger());
+  if (m_cfg.trackMemory) {
+    std::ranges::sort(memoryRecords, [](const auto& a, const auto& b) {
+      return std::tie(a.event, a.element) < std::tie(b.event, b.element);
+    });
+    printMemory(names, m_decorators.size(), memoryRecords, logger());
+
+    if (!m_cfg.outputDir.empty()) {
+      storeMemory(names, m_decorators.size(), memoryRecords,
+                  joinPaths(m_cfg.outputDir, m_cfg.outputMemoryFile));
+    }
+  }
 
-  if (!m_cfg.outputDir.empty()) {
-    storeTiming(names, clocksAlgorithms, numEvents,
-                joinPaths(m_cfg.outputDir, m_cfg.outputTimingFile));
+  if (trace) {
+    const auto tracePath = joinPaths(m_cfg.outputDir, m_cfg.outputTraceFile);
+    trace->write(tracePath, names);
+    ACTS_INFO("Wrote execution trace to '" << tracePath << "'");
   }
 
   if (m_cfg.failOnUnmaskedFpe && m_nUnmaskedFpe > 0) {
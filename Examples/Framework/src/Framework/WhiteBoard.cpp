@@ -58,8 +58,53 @@ inline int levenshteinDistance(const std::string_view &a,
   return d(a.size(), b.size());
 }
 
+/// Innermost declared keys scope of the current thread
+thread_local const WhiteBoard::DeclaredKeysScope *currentDeclaredKeys =
+    nullptr;
+
 }  // namespace
 
+WhiteBoard::DeclaredKeysScope::DeclaredKeysScope(std::string_view owner,
+                                                 const KeySet &keys)
+    : m_owner(owner), m_keys(&keys), m_previous(currentDeclaredKeys) {
+  currentDeclaredKeys = this;
+}
+
+WhiteBoard::DeclaredKeysScope::~DeclaredKeysScope() {
+  currentDeclaredKeys = m_previous;
+}
+
+void WhiteBoard::checkDeclared(std::string_view name) {
+  const DeclaredKeysScope *scope = currentDeclaredKeys;
+  if (scope == nullptr || scope->m_keys->contains(name)) {
+    return;
+  }
+  throw std::logic_error(
+      "'" + std::string{scope->m_owner} + "' accesses white board key '" +
+      std::string{name} +
+      "' without declaring it through a data handle, so it can not be "
+      "scheduled concurrently");
+}
+
+std::size_t WhiteBoard::SlotLayout::addKey(const std::string &key) {
+  auto [it, inserted] = slots.try_emplace(key, keys.size());
+  if (inserted) {
+    keys.push_back(key);
+    aliases.emplace_back();
+  }
+  return it->second;
+}
+
+void WhiteBoard::SlotLayout::addAlias(const std::string &key,
+                                      const std::string &alias) {
+  const std::size_t keySlot = addKey(key);
+  const std::size_t aliasSlot = addKey(alias);
+  if (std::ranges::find(aliases[keySlot], aliasSlot) ==
+      aliases[keySlot].end()) {
+    aliases[keySlot].push_back(aliasSlot);
+  }
+}
+
 std::vector<std::string_view> WhiteBoard::similarNames(
     const std::string_view &name, int distThreshold,
     std::size_t maxNumber) const {
@@ -69,6 +114,15 @@ std::vector<std::string_view> WhiteBoard::similarNames(
       names.push_back({d, n});
     }
   }
+  for (std::size_t slot = 0; slot < m_slotStore.size(); ++slot) {
+    if (m_slotStore[slot].first == nullptr) {
+      continue;
+    }
+    const auto &n = m_slotLayout->keys[slot];
+    if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
+      names.push_back({d, n});
+    }
+  }
   for (const auto &[from, to] : m_objectAliases) {
     if (const auto d = levenshteinDistance(from, name); d < distThreshold) {
       names.push_back({d, from});
@@ -92,8 +146,70 @@ std::string WhiteBoard::typeMismatchMessage(const std::string &name,
                      boost::core::demangle(act)};
 }
 
+const WhiteBoard::StoreValue *WhiteBoard::find(std::string_view name) const {
+  if (m_slotLayout != nullptr) {
+    if (auto it = m_slotLayout->slots.find(name);
+        it != m_slotLayout->slots.end()) {
+      const StoreValue &value = m_slotStore[it->second];
+      return value.first != nullptr ? &value : nullptr;
+    }
+  }
+  auto it = m_store.find(name);
+  return it != m_store.end() ? &it->second : nullptr;
+}
+
+bool WhiteBoard::store(const std::string &name, const StoreValue &value,
+                       bool overwrite) {
+  if (m_slotLayout != nullptr) {
+    if (auto it = m_slotLayout->slots.find(name);
+        it != m_slotLayout->slots.end()) {
+      StoreValue &slotValue = m_slotStore[it->second];
+      if (slotValue.first != nullptr && !overwrite) {
+        return false;
+      }
+      slotValue = value;
+      return true;
+    }
+  }
+  if (overwrite) {
+    m_store[name] = value;
+    return true;
+  }
+  return m_store.try_emplace(name, value).second;
+}
+
 void WhiteBoard::copyFrom(const WhiteBoard &other) {
-  for (auto &[key, val] : other.m_store) {
+  std::vector<std::pair<std::string, StoreValue>> values;
+  std::vector<std::shared_ptr<std::pmr::memory_resource>> memoryResources;
+  {
+    std::shared_lock otherLock{other.m_mutex};
+    if (other.m_memoryResource != nullptr) {
+      memoryResources.push_back(other.m_memoryResource);
+    }
+    memoryResources.insert(memoryResources.end(),
+                           other.m_retainedMemoryResources.begin(),
+                           other.m_retainedMemoryResources.end());
+    for (const auto &[key, val] : other.m_store) {
+      values.emplace_back(key, val);
+    }
+    for (std::size_t slot = 0; slot < other.m_slotStore.size(); ++slot) {
+      if (other.m_slotStore[slot].first != nullptr) {
+        values.emplace_back(other.m_slotLayout->keys[slot],
+                            other.m_slotStore[slot]);
+      }
+    }
+  }
+  {
+    std::unique_lock lock{m_mutex};
+    for (auto &memoryResource : memoryResources) {
+      if (memoryResource != m_memoryResource &&
+          std::ranges::find(m_retainedMemoryResources, memoryResource) ==
+              m_retainedMemoryResources.end()) {
+        m_retainedMemoryResources.push_back(std::move(memoryResource));
+      }
+    }
+  }
+  for (const auto &[key, val] : values) {
     addHolder(key, val.first, val.second);
     ACTS_VERBOSE("Copied key '" << key << "' to whiteboard");
   }
@@ -105,29 +221,28 @@ void WhiteBoard::addHolder(const std::string &name,
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
+  checkDeclared(name);
 
   if (holder == nullptr) {
     throw std::invalid_argument("Object '" + name + "' is nullptr");
   }
 
   StoreValue storeVal{holder, typeHash};
-  auto [storeIt, success] = m_store.try_emplace(name, storeVal);
-
-  if (!success) {
+  std::unique_lock lock{m_mutex};
+  if (!store(name, storeVal, false)) {
     throw std::invalid_argument("Object '" + name + "' already exists");
   }
   ACTS_VERBOSE("Added object '"
                << name << "' of type '"
-               << boost::core::demangle(
-                      storeIt->second.first->typeInfo()
-                          ? storeIt->second.first->typeInfo()->name()
-                          : "unknown")
+               << boost::core::demangle(holder->typeInfo()
+                                            ? holder->typeInfo()->name()
+                                            : "unknown")
                << "'");
 
   // deal with aliases
   auto range = m_objectAliases.equal_range(name);
   for (auto it = range.first; it != range.second; ++it) {
-    m_store[it->second] = storeVal;
+    store(it->second, storeVal, true);
     ACTS_VERBOSE("Added alias object '" << it->second << "'");
   }
 }
@@ -139,21 +254,66 @@ void WhiteBoard::addHolder(const std::string &name,
             typeHash);
 }
 
+void WhiteBoard::addSlotHolder(std::size_t slot,
+                               std::shared_ptr<Acts::AnyMoveOnly> holder,
+                               std::uint64_t typeHash) {
+  const std::string &name = m_slotLayout->keys.at(slot);
+  checkDeclared(name);
+  if (holder == nullptr) {
+    throw std::invalid_argument("Object '" + name + "' is nullptr");
+  }
+
+  StoreValue storeVal{std::move(holder), typeHash};
+  std::unique_lock lock{m_mutex};
+  if (m_slotStore[slot].first != nullptr) {
+    throw std::invalid_argument("Object '" + name + "' already exists");
+  }
+  m_slotStore[slot] = storeVal;
+  ACTS_VERBOSE("Added object '" << name << "' to slot " << slot);
+
+  // aliases of slotted keys are slotted as well
+  for (std::size_t aliasSlot : m_slotLayout->aliases[slot]) {
+    m_slotStore[aliasSlot] = storeVal;
+    ACTS_VERBOSE("Added alias object '" << m_slotLayout->keys[aliasSlot]
+                                        << "'");
+  }
+}
+
 std::vector<std::string> WhiteBoard::getKeys() const {
   std::vector<std::string> keys;
+  std::shared_lock lock{m_mutex};
   for (const auto &[key, val] : m_store) {
     keys.push_back(key);
   }
+  for (std::size_t slot = 0; slot < m_slotStore.size(); ++slot) {
+    if (m_slotStore[slot].first != nullptr) {
+      keys.push_back(m_slotLayout->keys[slot]);
+    }
+  }
   return keys;
 }
 
 std::pair<Acts::AnyMoveOnly *, std::uint64_t> WhiteBoard::getHolder(
     const std::string &name) const {
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
+  checkDeclared(name);
+  std::shared_lock lock{m_mutex};
+  const StoreValue *value = find(name);
+  if (value == nullptr) {
     throw std::out_of_range("Object '" + name + "' does not exists");
   }
-  return {it->second.first.get(), it->second.second};
+  return {value->first.get(), value->second};
+}
+
+std::pair<Acts::AnyMoveOnly *, std::uint64_t> WhiteBoard::getSlotHolder(
+    std::size_t slot) const {
+  checkDeclared(m_slotLayout->keys.at(slot));
+  std::shared_lock lock{m_mutex};
+  const StoreValue &value = m_slotStore.at(slot);
+  if (value.first == nullptr) {
+    throw std::out_of_range("Object '" + m_slotLayout->keys[slot] +
+                            "' does not exists");
+  }
+  return {value.first.get(), value.second};
 }
 
 }  // namespace ActsExamples
@@ -0,0 +1,30 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Utilities/Numa.hpp"
+
+#include <tbb/info.h>
+
+namespace {
+
+thread_local int s_currentNumaNode = -1;
+
+}  // namespace
+
+std::vector<int> ActsExamples::numaNodes() {
+  auto nodes = tbb::info::numa_nodes();
+  return {nodes.begin(), nodes.end()};
+}
+
+int ActsExamples::currentNumaNode() {
+  return s_currentNumaNode;
+}
+
+void ActsExamples::setCurrentNumaNode(int node) {
+  s_currentNumaNode = node;
+}
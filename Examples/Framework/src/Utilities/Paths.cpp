@@ -16,6 +16,7 @@
 #include <filesystem>
 #include <regex>
 #include <stdexcept>
+#include <string>
 
 std::string ActsExamples::ensureWritableDirectory(const std::string& dir) {
   using std::filesystem::current_path;
@@ -53,6 +54,15 @@ std::string ActsExamples::perEventFilepath(const std::string& dir,
   }
 }
 
+std::string ActsExamples::workerFilepath(const std::string& path,
+                                         std::size_t worker) {
+  std::filesystem::path workerPath(path);
+  workerPath.replace_filename(workerPath.stem().native() + ".worker" +
+                              std::to_string(worker) +
+                              workerPath.extension().native());
+  return workerPath.native();
+}
+
 std::pair<std::size_t, std::size_t> ActsExamples::determineEventFilesRange(
     const std::string& dir, const std::string& name) {
   using std::filesystem::current_path;
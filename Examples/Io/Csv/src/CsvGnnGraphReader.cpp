@@ -31,6 +31,8 @@ CsvGnnGraphReader::CsvGnnGraphReader(const Config& config,
   }
 
   m_outputGraph.initialize(m_cfg.outputGraph);
+
+  setStatelessInput();
 }
 
 std::pair<std::size_t, std::size_t> CsvGnnGraphReader::availableEvents() const {
@@ -12,6 +12,7 @@
 #include "ActsExamples/Io/Csv/CsvInputOutput.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <memory>
 #include <vector>
 
 #include "CsvOutputData.hpp"
@@ -20,7 +21,9 @@ namespace ActsExamples {
 
 CsvGnnGraphWriter::CsvGnnGraphWriter(const Config& config,
                                      Acts::Logging::Level level)
-    : WriterT(config.inputGraph, "CsvGnnGraphWriter", level), m_cfg(config) {}
+    : WriterT(config.inputGraph, "CsvGnnGraphWriter", level), m_cfg(config) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
+}
 
 ProcessCode CsvGnnGraphWriter::writeT(const AlgorithmContext& ctx,
                                       const Graph& graph) {
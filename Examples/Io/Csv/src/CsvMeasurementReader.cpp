@@ -61,6 +61,8 @@ CsvMeasurementReader::CsvMeasurementReader(const Config& config,
   if (!m_cfg.outputClusters.empty()) {
     checkRange("cells.csv");
   }
+
+  setStatelessInput();
 }
 
 std::string CsvMeasurementReader::CsvMeasurementReader::name() const {
@@ -19,6 +19,7 @@
 #include "ActsExamples/Utilities/Paths.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
 
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
@@ -31,6 +32,7 @@ CsvMeasurementWriter::CsvMeasurementWriter(const Config& config,
                                            Acts::Logging::Level level)
     : WriterT(config.inputMeasurements, "CsvMeasurementWriter", level),
       m_cfg(config) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   // Input container for measurements is already checked by base constructor
   if (m_cfg.inputMeasurementSimHitsMap.empty()) {
     throw std::invalid_argument(
@@ -35,6 +35,8 @@ CsvMuonSegmentReader::CsvMuonSegmentReader(const Config& config,
   }
 
   m_outputSegments.initialize(m_cfg.outputSegments);
+
+  setStatelessInput();
 }
 
 std::string CsvMuonSegmentReader::CsvMuonSegmentReader::name() const {
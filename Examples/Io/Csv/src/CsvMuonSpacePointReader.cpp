@@ -33,6 +33,8 @@ CsvMuonSpacePointReader::CsvMuonSpacePointReader(const Config& config,
   }
 
   m_outputSpacePoints.initialize(m_cfg.outputSpacePoints);
+
+  setStatelessInput();
 }
 
 std::string CsvMuonSpacePointReader::CsvMuonSpacePointReader::name() const {
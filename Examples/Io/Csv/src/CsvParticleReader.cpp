@@ -40,6 +40,8 @@ CsvParticleReader::CsvParticleReader(const Config& config,
   }
 
   m_outputParticles.initialize(m_cfg.outputParticles);
+
+  setStatelessInput();
 }
 
 std::string CsvParticleReader::name() const {
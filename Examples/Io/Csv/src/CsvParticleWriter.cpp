@@ -13,6 +13,7 @@
 #include "ActsExamples/Io/Csv/CsvInputOutput.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -23,6 +24,7 @@ namespace ActsExamples {
 CsvParticleWriter::CsvParticleWriter(const Config& cfg,
                                      Acts::Logging::Level lvl)
     : WriterT(cfg.inputParticles, "CsvParticleWriter", lvl), m_cfg(cfg) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   // inputParticles is already checked by base constructor
   if (m_cfg.outputStem.empty()) {
     throw std::invalid_argument("Missing output filename stem");
@@ -13,6 +13,8 @@
 #include "ActsExamples/Utilities/EventDataTransforms.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <memory>
+
 #include "CsvOutputData.hpp"
 
 namespace ActsExamples {
@@ -21,6 +23,7 @@ CsvProtoTrackWriter::CsvProtoTrackWriter(const Config& config,
                                          Acts::Logging::Level level)
     : WriterT(config.inputProtoTracks, "CsvProtoTrackWriter", level),
       m_cfg(config) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   m_inputSpacePoints.initialize(m_cfg.inputSpacePoints);
 }
 
@@ -16,6 +16,7 @@
 #include <fstream>
 #include <ios>
 #include <iostream>
+#include <memory>
 #include <numbers>
 #include <stdexcept>
 #include <string>
@@ -50,6 +51,7 @@ CsvSeedWriter::CsvSeedWriter(const Config& config, Acts::Logging::Level level)
     : WriterT<TrackParametersContainer>(config.inputTrackParameters,
                                         "CsvSeedWriter", level),
       m_cfg(config) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   if (m_cfg.inputSeeds.empty()) {
     throw std::invalid_argument("Missing space points input collection");
   }
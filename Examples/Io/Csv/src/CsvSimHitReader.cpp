@@ -39,6 +39,8 @@ CsvSimHitReader::CsvSimHitReader(const Config& config,
   }
 
   m_outputSimHits.initialize(m_cfg.outputSimHits);
+
+  setStatelessInput();
 }
 
 std::string CsvSimHitReader::CsvSimHitReader::name() const {
@@ -19,6 +19,7 @@
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -29,6 +30,7 @@ namespace ActsExamples {
 CsvSimHitWriter::CsvSimHitWriter(const Config& config,
                                  Acts::Logging::Level level)
     : WriterT(config.inputSimHits, "CsvSimHitWriter", level), m_cfg(config) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   // inputSimHits is already checked by base constructor
   if (m_cfg.outputStem.empty()) {
     throw std::invalid_argument("Missing output filename stem");
@@ -17,6 +17,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "CsvOutputData.hpp"
 
@@ -41,6 +42,8 @@ CsvSpacePointReader::CsvSpacePointReader(const Config& cfg,
   m_logger = Acts::getDefaultLogger("CsvSpacePointReader", lvl);
 
   m_outputSpacePoints.initialize(m_cfg.outputSpacePoints);
+
+  setStatelessInput();
 }
 
 std::string CsvSpacePointReader::CsvSpacePointReader::name() const {
@@ -68,32 +71,55 @@ ProcessCode CsvSpacePointReader::read(const AlgorithmContext& ctx) {
   BoostDescribeCsvReader<SpacePointData> reader(path);
   SpacePointData data;
 
+  // the columns are gathered first and appended in bulk
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<float> varianceR;
+  std::vector<float> varianceZ;
+  std::vector<Acts::SourceLink> sourceLinks;
+  std::vector<SpacePointData> rows;
   while (reader.read(data)) {
-    auto sp = spacePoints.createSpacePoint();
-    sp.assignSourceLinks(std::array{Acts::SourceLink(data.measurement_id)});
-    sp.x() = data.sp_x;
-    sp.y() = data.sp_y;
-    sp.z() = data.sp_z;
-    sp.varianceR() = data.sp_covr;
-    sp.varianceZ() = data.sp_covz;
-
+    x.push_back(data.sp_x);
+    y.push_back(data.sp_y);
+    z.push_back(data.sp_z);
+    varianceR.push_back(data.sp_covr);
+    varianceZ.push_back(data.sp_covz);
+    sourceLinks.emplace_back(data.measurement_id);
     if (m_cfg.extendCollection) {
+      rows.push_back(data);
+    }
+  }
+
+  const std::size_t nSpacePoints = x.size();
+  spacePoints.createSpacePoints(static_cast<std::uint32_t>(nSpacePoints),
+                                {.x = x,
+                                 .y = y,
+                                 .z = z,
+                                 .varianceZ = varianceZ,
+                                 .varianceR = varianceR,
+                                 .sourceLinks = sourceLinks});
+
+  if (m_cfg.extendCollection) {
+    for (std::size_t i = 0; i < nSpacePoints; ++i) {
+      const SpacePointData& row = rows[i];
+      auto sp = spacePoints[static_cast<Acts::SpacePointIndex2>(i)];
+
       const Acts::Vector3 topStripVector =
-          Acts::Vector3(data.sp_topStripDirection_0,
-                        data.sp_topStripDirection_1,
-                        data.sp_topStripDirection_2) *
-          2 * data.sp_topHalfStripLength;
+          Acts::Vector3(row.sp_topStripDirection_0, row.sp_topStripDirection_1,
+                        row.sp_topStripDirection_2) *
+          2 * row.sp_topHalfStripLength;
       const Acts::Vector3 bottomStripVector =
-          Acts::Vector3(data.sp_bottomStripDirection_0,
-                        data.sp_bottomStripDirection_1,
-                        data.sp_bottomStripDirection_2) *
-          2 * data.sp_bottomHalfStripLength;
-      const Acts::Vector3 stripCenterDistance(data.sp_stripCenterDistance_0,
-                                              data.sp_stripCenterDistance_1,
-                                              data.sp_stripCenterDistance_2);
-      const Acts::Vector3 topStripCenter(data.sp_topStripCenterPosition_0,
-                                         data.sp_topStripCenterPosition_1,
-                                         data.sp_topStripCenterPosition_2);
+          Acts::Vector3(row.sp_bottomStripDirection_0,
+                        row.sp_bottomStripDirection_1,
+                        row.sp_bottomStripDirection_2) *
+          2 * row.sp_bottomHalfStripLength;
+      const Acts::Vector3 stripCenterDistance(row.sp_stripCenterDistance_0,
+                                              row.sp_stripCenterDistance_1,
+                                              row.sp_stripCenterDistance_2);
+      const Acts::Vector3 topStripCenter(row.sp_topStripCenterPosition_0,
+                                         row.sp_topStripCenterPosition_1,
+                                         row.sp_topStripCenterPosition_2);
 
       Eigen::Map<Eigen::Vector3f>(sp.topStripVector().data()) =
           topStripVector.cast<float>();
@@ -19,6 +19,7 @@
 #include "ActsExamples/Io/Csv/CsvInputOutput.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <memory>
 #include <string>
 
 #include "CsvOutputData.hpp"
@@ -28,7 +29,9 @@ namespace ActsExamples {
 CsvSpacePointWriter::CsvSpacePointWriter(const Config& config,
                                          Acts::Logging::Level level)
     : WriterT(config.inputSpacePoints, "CsvSpacePointWriter", level),
-      m_cfg(config) {}
+      m_cfg(config) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
+}
 
 CsvSpacePointWriter::~CsvSpacePointWriter() = default;
 
@@ -38,6 +38,8 @@ CsvTrackParameterReader::CsvTrackParameterReader(const Config& config,
   }
 
   m_outputTrackParameters.initialize(m_cfg.outputTrackParameters);
+
+  setStatelessInput();
 }
 
 std::string CsvTrackParameterReader::CsvTrackParameterReader::name() const {
@@ -13,6 +13,7 @@
 #include "ActsExamples/Io/Csv/CsvInputOutput.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <memory>
 #include <optional>
 #include <stdexcept>
 
@@ -24,6 +25,7 @@ CsvTrackParameterWriter::CsvTrackParameterWriter(const Config& config,
                                                  Acts::Logging::Level level)
     : m_cfg(config),
       m_logger(Acts::getDefaultLogger("CsvTrackParameterWriter", level)) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("You have to provide tracks");
   }
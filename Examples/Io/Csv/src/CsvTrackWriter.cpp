@@ -19,6 +19,7 @@
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -31,6 +32,7 @@ namespace ActsExamples {
 CsvTrackWriter::CsvTrackWriter(const Config& config, Acts::Logging::Level level)
     : WriterT<ConstTrackContainer>(config.inputTracks, "CsvTrackWriter", level),
       m_cfg(config) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing input tracks collection");
   }
@@ -12,6 +12,7 @@
 #include "ActsExamples/Io/Csv/CsvInputOutput.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <memory>
 #include <stdexcept>
 
 #include "CsvOutputData.hpp"
@@ -20,6 +21,7 @@ namespace ActsExamples {
 
 CsvVertexWriter::CsvVertexWriter(const Config& cfg, Acts::Logging::Level lvl)
     : WriterT(cfg.inputVertices, "CsvVertexWriter", lvl), m_cfg(cfg) {
+  setWorkerOutput(std::make_unique<PerEventWorkerOutput>());
   // inputVertices is already checked by base constructor
   if (m_cfg.outputStem.empty()) {
     throw std::invalid_argument("Missing output filename stem");
@@ -0,0 +1,46 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+class TFile;
+
+namespace ActsExamples {
+
+/// Worker output of writers that fill trees or histograms of one ROOT file.
+///
+/// In a worker process, the objects attached to the output file are moved to
+/// a separate file at the worker file path, see `workerFilepath`. The
+/// original file is shared with the other processes and is neither written
+/// nor closed by the worker. The main process merges the worker files into
+/// the output file with `TFileMerger` and removes them.
+class RootWorkerOutput final : public IWriter::WorkerOutput {
+ public:
+  /// @param file The output file of the writer, replaced by the worker file
+  ///        in worker processes
+  /// @param path The path of the output file of the writer
+  RootWorkerOutput(TFile*& file, std::string path)
+      : m_file(file), m_path(std::move(path)) {}
+
+  ProcessCode beginWorker(std::size_t worker) override;
+
+  ProcessCode mergeWorkers(std::size_t nWorkers) override;
+
+ private:
+  TFile*& m_file;
+  std::string m_path;
+};
+
+}  // namespace ActsExamples
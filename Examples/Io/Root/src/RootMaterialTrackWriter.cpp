@@ -21,9 +21,11 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 
 #include <cstddef>
 #include <ios>
+#include <memory>
 #include <stdexcept>
 
 #include <TFile.h>
@@ -51,6 +53,8 @@ RootMaterialTrackWriter::RootMaterialTrackWriter(
   }
 
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree =
       new TTree(m_cfg.treeName.c_str(), "TTree from RootMaterialTrackWriter");
   if (m_outputTree == nullptr) {
@@ -12,6 +12,7 @@
 #include "ActsExamples/EventData/Index.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
 #include "ActsPlugins/Root/RootMeasurementIo.hpp"
 
@@ -83,6 +84,8 @@ RootMeasurementWriter::RootMeasurementWriter(
   }
 
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), "Measurements");
   m_outputTree->Branch("particles_vertex_primary", &m_particleVertexPrimary);
   m_outputTree->Branch("particles_vertex_secondary",
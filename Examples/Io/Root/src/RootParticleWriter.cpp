@@ -18,9 +18,11 @@
 #include "Acts/Utilities/VectorHelpers.hpp"
 #include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 
 #include <cstdint>
 #include <ios>
+#include <memory>
 #include <stdexcept>
 
 #include <TFile.h>
@@ -45,6 +47,8 @@ RootParticleWriter::RootParticleWriter(const RootParticleWriter::Config& cfg,
     throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
   }
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
   if (m_outputTree == nullptr) {
     throw std::bad_alloc();
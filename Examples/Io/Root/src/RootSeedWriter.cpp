@@ -10,8 +10,10 @@
 
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 
 #include <ios>
+#include <memory>
 #include <stdexcept>
 
 #include <TFile.h>
@@ -36,6 +38,8 @@ RootSeedWriter::RootSeedWriter(const RootSeedWriter::Config& config,
     throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
   }
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
   if (m_outputTree == nullptr) {
     throw std::bad_alloc();
@@ -11,10 +11,12 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
 #include <ios>
+#include <memory>
 #include <stdexcept>
 
 #include <TFile.h>
@@ -39,6 +41,8 @@ RootSimHitWriter::RootSimHitWriter(const RootSimHitWriter::Config& config,
     throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
   }
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
   if (m_outputTree == nullptr) {
     throw std::bad_alloc();
@@ -14,6 +14,7 @@
 #include "ActsExamples/EventData/AverageSimHits.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
@@ -23,6 +24,7 @@
 #include <cstddef>
 #include <ios>
 #include <iostream>
+#include <memory>
 #include <numbers>
 #include <stdexcept>
 #include <utility>
@@ -81,6 +83,8 @@ RootTrackParameterWriter::RootTrackParameterWriter(
     }
   }
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
   if (m_outputTree == nullptr) {
     throw std::bad_alloc();
@@ -23,12 +23,14 @@
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 
 #include <cmath>
 #include <ios>
 #include <limits>
+#include <memory>
 #include <numbers>
 #include <optional>
 #include <ostream>
@@ -82,6 +84,8 @@ RootTrackStatesWriter::RootTrackStatesWriter(
     throw std::ios_base::failure("Could not open '" + path + "'");
   }
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
   if (m_outputTree == nullptr) {
     throw std::bad_alloc();
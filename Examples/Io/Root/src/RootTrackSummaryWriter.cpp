@@ -19,6 +19,7 @@
 #include "ActsExamples/EventData/TruthMatching.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 #include "ActsExamples/Validation/TrackClassification.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 
@@ -28,6 +29,7 @@
 #include <cstdint>
 #include <ios>
 #include <limits>
+#include <memory>
 #include <numbers>
 #include <optional>
 #include <ostream>
@@ -69,6 +71,8 @@ RootTrackSummaryWriter::RootTrackSummaryWriter(
     throw std::ios_base::failure("Could not open '" + path + "'");
   }
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
   if (m_outputTree == nullptr) {
     throw std::bad_alloc();
@@ -11,10 +11,12 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 
 #include <cstdint>
 #include <ios>
+#include <memory>
 #include <ostream>
 #include <stdexcept>
 
@@ -40,6 +42,8 @@ RootVertexWriter::RootVertexWriter(const RootVertexWriter::Config& cfg,
     throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
   }
   m_outputFile->cd();
+  setWorkerOutput(
+      std::make_unique<RootWorkerOutput>(m_outputFile, m_cfg.filePath));
   m_outputTree = new TTree(m_cfg.treeName.c_str(), m_cfg.treeName.c_str());
   if (m_outputTree == nullptr) {
     throw std::bad_alloc();
@@ -0,0 +1,68 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Root/RootWorkerOutput.hpp"
+
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <filesystem>
+#include <vector>
+
+#include <TFile.h>
+#include <TFileMerger.h>
+#include <TH1.h>
+#include <TTree.h>
+
+namespace ActsExamples {
+
+ProcessCode RootWorkerOutput::beginWorker(std::size_t worker) {
+  const std::string workerPath = workerFilepath(m_path, worker);
+  TFile* workerFile = TFile::Open(workerPath.c_str(), "RECREATE");
+  if (workerFile == nullptr) {
+    return ProcessCode::ABORT;
+  }
+
+  // Moving an object modifies the list of the original file
+  std::vector<TObject*> objects;
+  for (TObject* object : *m_file->GetList()) {
+    objects.push_back(object);
+  }
+  for (TObject* object : objects) {
+    if (auto* tree = dynamic_cast<TTree*>(object); tree != nullptr) {
+      tree->SetDirectory(workerFile);
+    } else if (auto* hist = dynamic_cast<TH1*>(object); hist != nullptr) {
+      hist->SetDirectory(workerFile);
+    }
+  }
+  workerFile->cd();
+
+  m_file = workerFile;
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode RootWorkerOutput::mergeWorkers(std::size_t nWorkers) {
+  TFileMerger merger(false);
+  if (!merger.OutputFile(m_path.c_str(), "RECREATE")) {
+    return ProcessCode::ABORT;
+  }
+  for (std::size_t worker = 0; worker < nWorkers; ++worker) {
+    if (!merger.AddFile(workerFilepath(m_path, worker).c_str(), false)) {
+      return ProcessCode::ABORT;
+    }
+  }
+  if (!merger.Merge()) {
+    return ProcessCode::ABORT;
+  }
+
+  for (std::size_t worker = 0; worker < nWorkers; ++worker) {
+    std::filesystem::remove(workerFilepath(m_path, worker));
+  }
+  return ProcessCode::SUCCESS;
+}
+
+}  // namespace ActsExamples
@@ -8,6 +8,7 @@
 
 #include "Acts/Propagator/AtlasStepper.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
@@ -81,6 +82,11 @@ void addPropagation(py::module_& m) {
     stepper.def(py::init<std::shared_ptr<const MagneticFieldProvider>>());
     addPropagator<SympyStepper, Navigator>(m, "Sympy");
   }
+  {
+    auto stepper = py::class_<HelixStepper>(m, "HelixStepper");
+    stepper.def(py::init<std::shared_ptr<const MagneticFieldProvider>>());
+    addPropagator<HelixStepper, Navigator>(m, "Helix");
+  }
 }
 
 }  // namespace ActsPython
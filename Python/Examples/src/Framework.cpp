@@ -382,8 +382,12 @@ void addFramework(py::module& mex) {
   auto c = py::class_<Config>(sequencer, "Config").def(py::init<>());
 
   ACTS_PYTHON_STRUCT(c, skip, events, logLevel, numThreads, outputDir,
-                     outputTimingFile, trackFpes, fpeMasks, failOnFirstFpe,
-                     failOnUnmaskedFpe, fpeStackTraceLength);
+                     outputTimingFile, recordTrace, outputTraceFile, trackFpes,
+                     fpeMasks, failOnFirstFpe, failOnUnmaskedFpe,
+                     fpeStackTraceLength, intraEventParallelism, asyncWriters,
+                     writerQueueSize, writeEventsInOrder, eventArena,
+                     eventArenaSize, trackMemory, outputMemoryFile, numaAware,
+                     numProcesses);
 
   auto fpem =
       py::class_<Sequencer::FpeMask>(sequencer, "_FpeMask")
@@ -8,6 +8,7 @@
 
 #include "ActsExamples/EventData/Cluster.hpp"
 #include "ActsExamples/Framework/BufferedReader.hpp"
+#include "ActsExamples/Framework/PrefetchingReader.hpp"
 #include "ActsExamples/Io/Csv/CsvGnnGraphReader.hpp"
 #include "ActsExamples/Io/Csv/CsvMeasurementReader.hpp"
 #include "ActsExamples/Io/Csv/CsvMuonSegmentReader.hpp"
@@ -35,6 +36,10 @@ void addInput(py::module& mex) {
   ACTS_PYTHON_DECLARE_READER(BufferedReader, mex, "BufferedReader",
                              upstreamReader, selectionSeed, bufferSize);
 
+  // Prefetching reader
+  ACTS_PYTHON_DECLARE_READER(PrefetchingReader, mex, "PrefetchingReader",
+                             upstreamReader, queueSize);
+
   ACTS_PYTHON_DECLARE_READER(CsvParticleReader, mex, "CsvParticleReader",
                              inputDir, inputStem, outputParticles);
 
@@ -7,13 +7,16 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Propagator/AtlasStepper.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Propagator/SympyStepper.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/MagneticField/NumaReplicatedBField.hpp"
 #include "ActsExamples/Propagation/PropagationAlgorithm.hpp"
 #include "ActsExamples/Propagation/PropagatorInterface.hpp"
 #include "ActsPython/Utilities/Helpers.hpp"
@@ -32,10 +35,6 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
-namespace Acts {
-class MagneticFieldProvider;
-}  // namespace Acts
-
 namespace py = pybind11;
 using namespace Acts;
 using namespace ActsExamples;
@@ -65,6 +64,14 @@ void addPropagation(py::module& mex) {
   py::class_<PropagatorInterface, std::shared_ptr<PropagatorInterface>>(
       mex, "PropagatorInterface");
 
+  mex.def(
+      "replicatePerNumaNode",
+      [](const std::shared_ptr<MagneticFieldProvider>& field) {
+        return std::const_pointer_cast<MagneticFieldProvider>(
+            replicatePerNumaNode(field));
+      },
+      py::arg("field"));
+
   // Eigen stepper based propagator
   {
     addConcretePropagator<EigenStepper<>, Navigator>(mex, "Eigen");
@@ -80,6 +87,11 @@ void addPropagation(py::module& mex) {
     addConcretePropagator<SympyStepper, Navigator>(mex, "Sympy");
   }
 
+  // Helix stepper based propagator
+  {
+    addConcretePropagator<HelixStepper, Navigator>(mex, "Helix");
+  }
+
   // Straight line stepper
   {
     addConcretePropagator<StraightLineStepper, Navigator>(mex, "StraightLine");
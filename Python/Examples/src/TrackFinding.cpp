@@ -142,7 +142,8 @@ void addTrackFinding(py::module& mex) {
         measurementSelectorCfg, trackSelectorCfg, maxSteps, twoWay,
         reverseSearch, seedDeduplication, stayOnSeed, pixelVolumeIds,
         stripVolumeIds, maxPixelHoles, maxStripHoles, trimTracks,
-        useJosephFormulation, constrainToVolumeIds, endOfWorldVolumeIds);
+        useJosephFormulation, reuseTrackContainers, constrainToVolumeIds,
+        endOfWorldVolumeIds);
   }
 }
 
@@ -300,41 +300,45 @@ def detector_config(request):
         raise ValueError(f"Invalid detector {request.param}")
 
 
-@pytest.fixture
-def ptcl_gun(rng):
-    def _factory(s):
-        evGen = acts.examples.EventGenerator(
-            level=acts.logging.INFO,
-            generators=[
-                acts.examples.EventGenerator.Generator(
-                    multiplicity=acts.examples.FixedMultiplicityGenerator(n=2),
-                    vertex=acts.examples.GaussianVertexGenerator(
-                        stddev=acts.Vector4(0, 0, 0, 0), mean=acts.Vector4(0, 0, 0, 0)
-                    ),
-                    particles=acts.examples.ParametricParticleGenerator(
-                        p=(1 * u.GeV, 10 * u.GeV),
-                        eta=(-2, 2),
-                        phi=(0, 360 * u.degree),
-                        randomizeCharge=True,
-                        numParticles=2,
-                    ),
-                )
-            ],
-            outputEvent="particle_gun_event",
-            randomNumbers=rng,
-        )
+def _add_ptcl_gun(s, rng):
+    evGen = acts.examples.EventGenerator(
+        level=acts.logging.INFO,
+        generators=[
+            acts.examples.EventGenerator.Generator(
+                multiplicity=acts.examples.FixedMultiplicityGenerator(n=2),
+                vertex=acts.examples.GaussianVertexGenerator(
+                    stddev=acts.Vector4(0, 0, 0, 0), mean=acts.Vector4(0, 0, 0, 0)
+                ),
+                particles=acts.examples.ParametricParticleGenerator(
+                    p=(1 * u.GeV, 10 * u.GeV),
+                    eta=(-2, 2),
+                    phi=(0, 360 * u.degree),
+                    randomizeCharge=True,
+                    numParticles=2,
+                ),
+            )
+        ],
+        outputEvent="particle_gun_event",
+        randomNumbers=rng,
+    )
 
-        s.addReader(evGen)
+    s.addReader(evGen)
 
-        hepmc3Converter = acts.examples.hepmc3.HepMC3InputConverter(
-            level=acts.logging.INFO,
-            inputEvent=evGen.config.outputEvent,
-            outputParticles="particles_generated",
-            outputVertices="vertices_input",
-        )
-        s.addAlgorithm(hepmc3Converter)
+    hepmc3Converter = acts.examples.hepmc3.HepMC3InputConverter(
+        level=acts.logging.INFO,
+        inputEvent=evGen.config.outputEvent,
+        outputParticles="particles_generated",
+        outputVertices="vertices_input",
+    )
+    s.addAlgorithm(hepmc3Converter)
+
+    return evGen, hepmc3Converter
 
-        return evGen, hepmc3Converter
+
+@pytest.fixture
+def ptcl_gun(rng):
+    def _factory(s):
+        return _add_ptcl_gun(s, rng)
 
     return _factory
 
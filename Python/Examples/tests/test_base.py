@@ -1,3 +1,5 @@
+import json
+
 import pytest
 
 import acts
@@ -36,6 +38,63 @@ def test_sequencer_multi_threaded(ptcl_gun, capfd):
     assert "Processed 2 events" in cap.out
 
 
+def test_sequencer_intra_event_parallelism(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(numThreads=2, events=2, intraEventParallelism=True)
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 2 events" in cap.out
+
+
+def test_sequencer_event_arena(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(
+        numThreads=2, events=2, eventArena=True, eventArenaSize=1024 * 1024
+    )
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 2 events" in cap.out
+
+
+def test_sequencer_numa(ptcl_gun, capfd):
+    s = acts.examples.Sequencer(numThreads=2, events=4, numaAware=True)
+    ptcl_gun(s)
+    s.run()
+    cap = capfd.readouterr()
+    assert cap.err == ""
+    assert "Processed 4 events" in cap.out
+
+
+def test_sequencer_trace(ptcl_gun, tmp_path):
+    s = acts.examples.Sequencer(
+        numThreads=2, events=2, recordTrace=True, outputDir=str(tmp_path)
+    )
+    ptcl_gun(s)
+    s.run()
+
+    trace = json.loads((tmp_path / "trace.json").read_text())
+    spans = [e for e in trace["traceEvents"] if e["ph"] == "X"]
+    assert len([e for e in spans if e["cat"] == "Event"]) == 2
+    assert any(e["cat"] == "Reader" for e in spans)
+
+
+def test_sequencer_memory(ptcl_gun, tmp_path):
+    s = acts.examples.Sequencer(
+        numThreads=2, events=2, trackMemory=True, outputDir=str(tmp_path)
+    )
+    ptcl_gun(s)
+    s.run()
+
+    lines = (tmp_path / "memory.csv").read_text().strip().splitlines()
+    assert (
+        lines[0] == "identifier,event,allocations,peak_bytes,net_bytes,stored_bytes"
+    )
+    events = {int(line.split(",")[1]) for line in lines[1:]}
+    assert events == {0, 1}
+
+
 def test_random_number():
     rnd = acts.examples.RandomNumbers(seed=42)
 
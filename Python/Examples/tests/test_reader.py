@@ -312,3 +312,51 @@ def test_buffered_reader(tmp_path, conf_const, ptcl_gun):
     s2.run()
 
     assert alg.events_seen == eventsToProcess
+
+
+@pytest.mark.root
+def test_prefetching_reader(tmp_path, conf_const, ptcl_gun):
+    # Test the prefetching reader with the ROOT particle reader
+    # need to write out some particles first
+    events = 10
+
+    s = Sequencer(numThreads=1, events=events, logLevel=acts.logging.WARNING)
+    _, h3conv = ptcl_gun(s)
+
+    file = tmp_path / "particles.root"
+    s.addWriter(
+        conf_const(
+            RootParticleWriter,
+            acts.logging.WARNING,
+            inputParticles=h3conv.config.outputParticles,
+            filePath=str(file),
+        )
+    )
+
+    s.run()
+
+    # reset sequencer for reading
+    s2 = Sequencer(skip=2, numThreads=2, logLevel=acts.logging.WARNING)
+
+    reader = RootParticleReader(
+        level=acts.logging.WARNING,
+        outputParticles="particles_input",
+        filePath=str(file),
+    )
+
+    s2.addReader(
+        acts.examples.PrefetchingReader(
+            level=acts.logging.WARNING,
+            upstreamReader=reader,
+            queueSize=3,
+        )
+    )
+
+    alg = AssertCollectionExistsAlg(
+        "particles_input", "check_alg", acts.logging.WARNING
+    )
+    s2.addAlgorithm(alg)
+
+    s2.run()
+
+    assert alg.events_seen == events - 2
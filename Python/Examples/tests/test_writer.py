@@ -1,5 +1,7 @@
 import os
+import importlib
 import inspect
+import multiprocessing
 from pathlib import Path
 import shutil
 import math
@@ -114,6 +116,75 @@ def test_csv_particle_writer(tmp_path, conf_const, ptcl_gun):
     assert_csv_output(out, "particle", s.config.events, size_threshold=200)
 
 
+def test_csv_particle_writer_async(tmp_path, conf_const, ptcl_gun):
+    s = Sequencer(numThreads=2, events=10, asyncWriters=True, writeEventsInOrder=True)
+    _, h3conv = ptcl_gun(s)
+
+    out = tmp_path / "csv"
+
+    out.mkdir()
+
+    s.addWriter(
+        conf_const(
+            CsvParticleWriter,
+            acts.logging.INFO,
+            inputParticles=h3conv.config.outputParticles,
+            outputStem="particle",
+            outputDir=str(out),
+        )
+    )
+
+    s.run()
+
+    assert_csv_output(out, "particle", s.config.events, size_threshold=200)
+
+
+def _run_particle_writer_multiprocess(module, writer, **kwargs):
+    from conftest import _add_ptcl_gun
+
+    s = Sequencer(numThreads=1, events=10, numProcesses=2)
+    _, h3conv = _add_ptcl_gun(s, acts.examples.RandomNumbers(seed=42))
+
+    s.addWriter(
+        getattr(importlib.import_module(module), writer)(
+            level=acts.logging.INFO,
+            inputParticles=h3conv.config.outputParticles,
+            **kwargs,
+        )
+    )
+
+    s.run()
+
+
+def run_particle_writer_multiprocess(module, writer, **kwargs):
+    # The sequencer refuses to fork once threads were started, e.g. by earlier
+    # tests in this session, so run it in a fresh process
+    spawn_context = multiprocessing.get_context("spawn")
+    p = spawn_context.Process(
+        target=_run_particle_writer_multiprocess,
+        args=(module, writer),
+        kwargs=kwargs,
+    )
+    p.start()
+    p.join()
+    assert p.exitcode == 0
+
+
+def test_csv_particle_writer_multiprocess(tmp_path):
+    out = tmp_path / "csv"
+
+    out.mkdir()
+
+    run_particle_writer_multiprocess(
+        "acts.examples",
+        "CsvParticleWriter",
+        outputStem="particle",
+        outputDir=str(out),
+    )
+
+    assert_csv_output(out, "particle", 10, size_threshold=200)
+
+
 @pytest.mark.root
 def test_root_prop_step_writer(
     tmp_path, trk_geo, conf_const, basic_prop_seq, assert_root_hash
@@ -166,6 +237,19 @@ def test_root_particle_writer(tmp_path, conf_const, ptcl_gun, assert_root_hash):
     assert_root_hash(file.name, file)
 
 
+@pytest.mark.root
+def test_root_particle_writer_multiprocess(tmp_path):
+    file = tmp_path / "particles.root"
+
+    run_particle_writer_multiprocess(
+        "acts.examples.root", "RootParticleWriter", filePath=str(file)
+    )
+
+    assert file.exists()
+    assert file.stat().st_size > 1024 * 10
+    assert list(tmp_path.glob("particles.worker*.root")) == []
+
+
 @pytest.mark.root
 def test_root_meas_writer(tmp_path, fatras, trk_geo, assert_root_hash):
     s = Sequencer(numThreads=1, events=10)
@@ -0,0 +1,156 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Utilities/AnnealingUtility.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/IVertexFinder.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <cmath>
+#include <numbers>
+
+#include "ReconstructionBenchmarkCommons.hpp"
+
+using namespace Acts;
+using namespace ActsTests;
+
+using VertexingPropagator = Propagator<EigenStepper<>>;
+
+namespace {
+
+/// Generate perigee parameters of the tracks of vertices distributed along
+/// the beam line, smeared with typical resolutions.
+std::vector<std::vector<BoundTrackParameters>> generateEvents(
+    const BenchmarkReconstruction& benchmark) {
+  std::default_random_engine rng(benchmark.seed);
+  std::normal_distribution<double> vertexZDist(0, 50_mm);
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  std::uniform_real_distribution<double> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<double> ptDist(0.5, 1.5);
+  std::bernoulli_distribution chargeDist;
+  std::normal_distribution<double> gauss(0, 1);
+
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  BoundVector stddev;
+  stddev[eBoundLoc0] = 30_um;
+  stddev[eBoundLoc1] = 50_um;
+  stddev[eBoundTime] = 1_ns;
+  stddev[eBoundPhi] = 1_mrad;
+  stddev[eBoundTheta] = 1_mrad;
+  stddev[eBoundQOverP] = 0.01 / 1_GeV;
+  BoundMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+  std::vector<std::vector<BoundTrackParameters>> events(benchmark.events);
+  for (auto& event : events) {
+    for (unsigned int iv = 0; iv < benchmark.pileup; ++iv) {
+      const double vz = vertexZDist(rng);
+      for (unsigned int it = 0; it < benchmark.tracksPerVertex; ++it) {
+        const double q = chargeDist(rng) ? 1_e : -1_e;
+        const double theta = 2 * std::atan(std::exp(-etaDist(rng)));
+        const double p = ptDist(rng) * benchmark.ptInGeV * 1_GeV /
+                         std::sin(theta);
+
+        BoundVector params;
+        params[eBoundLoc0] = 0;
+        params[eBoundLoc1] = vz;
+        params[eBoundTime] = 0;
+        params[eBoundPhi] = phiDist(rng);
+        params[eBoundTheta] = theta;
+        params[eBoundQOverP] = q / p;
+        for (unsigned int i = 0; i < eBoundSize; ++i) {
+          params[i] += stddev[i] * gauss(rng);
+        }
+
+        event.emplace_back(perigee, params, cov, ParticleHypothesis::pion());
+      }
+    }
+  }
+  return events;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  BenchmarkReconstruction benchmark;
+  if (auto ret = benchmark.parseOptions(argc, argv, 2)) {
+    return *ret;
+  }
+
+  auto events = generateEvents(benchmark);
+
+  GeometryContext geoCtx = GeometryContext::dangerouslyDefaultConstruct();
+  MagneticFieldContext magCtx;
+
+  auto bField = std::make_shared<ConstantBField>(
+      Vector3(0., 0., benchmark.BzInT * UnitConstants::T));
+  auto propagator =
+      std::make_shared<VertexingPropagator>(EigenStepper<>(bField));
+
+  ImpactPointEstimator::Config ipEstimatorCfg(bField, propagator);
+  ImpactPointEstimator ipEstimator(ipEstimatorCfg);
+
+  AnnealingUtility::Config annealingConfig;
+  annealingConfig.setOfTemperatures = {
+      8., 4., 2., std::numbers::sqrt2, std::sqrt(3. / 2.), 1.};
+  AnnealingUtility annealingUtility(annealingConfig);
+
+  HelicalTrackLinearizer::Config linearizerConfig;
+  linearizerConfig.bField = bField;
+  linearizerConfig.propagator = propagator;
+  HelicalTrackLinearizer linearizer(linearizerConfig);
+
+  AdaptiveMultiVertexFitter::Config fitterCfg(ipEstimator);
+  fitterCfg.annealingTool = annealingUtility;
+  fitterCfg.doSmoothing = true;
+  fitterCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  fitterCfg.trackLinearizer.connect<&HelicalTrackLinearizer::linearizeTrack>(
+      &linearizer);
+  AdaptiveMultiVertexFitter fitter(std::move(fitterCfg));
+
+  GaussianTrackDensity::Config densityCfg;
+  densityCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  auto seedFinder = std::make_shared<TrackDensityVertexFinder>(
+      TrackDensityVertexFinder::Config{GaussianTrackDensity(densityCfg)});
+
+  AdaptiveMultiVertexFinder::Config finderConfig(std::move(fitter), seedFinder,
+                                                 ipEstimator, bField);
+  finderConfig.extractParameters.connect<&InputTrack::extractParameters>();
+  AdaptiveMultiVertexFinder finder(std::move(finderConfig));
+
+  SquareMatrix3 beamSpotCov = SquareMatrix3::Zero();
+  beamSpotCov.diagonal() << 10_um * 10_um, 10_um * 10_um, 50_mm * 50_mm;
+  Vertex beamSpot(Vector3::Zero(), beamSpotCov, {});
+  VertexingOptions vertexingOptions(geoCtx, magCtx, beamSpot);
+
+  benchmark.run(
+      "AdaptiveMultiVertexFinder", events,
+      [&](const std::vector<BoundTrackParameters>& tracks) {
+        std::vector<InputTrack> inputTracks;
+        inputTracks.reserve(tracks.size());
+        for (const auto& track : tracks) {
+          inputTracks.emplace_back(&track);
+        }
+        IVertexFinder::State state = finder.makeState(magCtx);
+        auto res = finder.find(inputTracks, vertexingOptions, state);
+        return res.ok() ? res->size() : 0;
+      },
+      "vertices");
+
+  return 0;
+}
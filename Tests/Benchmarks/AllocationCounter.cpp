@@ -0,0 +1,71 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Replaces the global allocation functions to count the heap allocations of
+// the benchmark executables it is linked into. The array and nothrow variants
+// forward to the replaced functions by default.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "ReconstructionBenchmarkCommons.hpp"
+
+namespace {
+
+std::atomic<std::size_t> s_allocations = 0;
+std::atomic<std::size_t> s_bytes = 0;
+
+void count(std::size_t size) {
+  s_allocations.fetch_add(1, std::memory_order_relaxed);
+  s_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+ActsTests::AllocationStatistics ActsTests::allocationStatistics() {
+  return {s_allocations.load(std::memory_order_relaxed),
+          s_bytes.load(std::memory_order_relaxed)};
+}
+
+void* operator new(std::size_t size) {
+  count(size);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  count(size);
+  const auto align = static_cast<std::size_t>(alignment);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const std::size_t padded = (size + align - 1) / align * align;
+  if (void* ptr = std::aligned_alloc(align, padded == 0 ? align : padded)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  std::free(ptr);
+}
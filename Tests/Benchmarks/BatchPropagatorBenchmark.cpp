@@ -0,0 +1,117 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/BatchPropagator.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace ActsTests {
+
+unsigned int nTracks = 64;
+unsigned int nrepts = 100;
+const double pathLimit = 2_m;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+std::vector<BoundTrackParameters> makeTracks() {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phi(-std::numbers::pi,
+                                             std::numbers::pi);
+  std::uniform_real_distribution<double> theta(0.3, 2.8);
+  std::uniform_real_distribution<double> p(0.5_GeV, 10_GeV);
+  std::vector<BoundTrackParameters> tracks;
+  for (unsigned int i = 0; i < nTracks; ++i) {
+    const double q = i % 2 == 0 ? 1_e : -1_e;
+    tracks.push_back(BoundTrackParameters::createCurvilinear(
+        Vector4::Zero(), phi(rng), theta(rng), q / p(rng), std::nullopt,
+        ParticleHypothesis::pion()));
+  }
+  return tracks;
+}
+
+void benchmarkPropagation(
+    const std::shared_ptr<const MagneticFieldProvider>& bField,
+    const std::string& name) {
+  const std::vector<BoundTrackParameters> tracks = makeTracks();
+
+  PropagatorPlainOptions options(tgContext, mfContext);
+  options.pathLimit = pathLimit;
+
+  using ScalarPropagator = Propagator<EigenStepper<>>;
+  ScalarPropagator scalarPropagator{EigenStepper<>(bField)};
+  ScalarPropagator::Options<> scalarOptions(options);
+  BatchPropagator<4> batchPropagator4({bField});
+  BatchPropagator<8> batchPropagator8({bField});
+
+  std::cout << std::endl
+            << "Benchmarking " << nTracks << " tracks over " << pathLimit
+            << " mm in " << name << "..." << std::endl;
+  std::cout << "- EigenStepper: "
+            << microBenchmark(
+                   [&] {
+                     double sum = 0;
+                     for (const auto& track : tracks) {
+                       sum += scalarPropagator.propagate(track, scalarOptions)
+                                  .value()
+                                  .pathLength;
+                     }
+                     return sum;
+                   },
+                   1, nrepts)
+            << std::endl;
+  std::cout << "- Batch (4 lanes): "
+            << microBenchmark(
+                   [&] { return batchPropagator4.propagate(tracks, options); },
+                   1, nrepts)
+            << std::endl;
+  std::cout << "- Batch (8 lanes): "
+            << microBenchmark(
+                   [&] { return batchPropagator8.propagate(tracks, options); },
+                   1, nrepts)
+            << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_batch_propagation) {
+  benchmarkPropagation(std::make_shared<ConstantBField>(Vector3(0, 0, 2_T)),
+                       "a constant field");
+  // the analytic solenoid field is too slow for propagation, so it is
+  // sampled into an interpolated field map
+  SolenoidBField solenoid(SolenoidBField::Config{
+      .radius = 1.2_m, .length = 6_m, .nCoils = 1000, .bMagCenter = 2_T});
+  benchmarkPropagation(
+      std::make_shared<InterpolatedBFieldMap<
+          Grid<Vector2, Axis<AxisType::Equidistant>,
+               Axis<AxisType::Equidistant>>>>(solenoidFieldMap(
+          {0, 3_m}, {-4_m, 4_m}, {150, 400}, solenoid)),
+      "an interpolated solenoid field map");
+}
+
+}  // namespace ActsTests
@@ -0,0 +1,146 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/TrackStateCreator.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/Holders.hpp"
+
+#include "ReconstructionBenchmarkCommons.hpp"
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+using namespace ActsTests;
+
+using Stepper = EigenStepper<>;
+using BenchmarkTrackContainer =
+    TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                   detail::ValueHolder>;
+using TrackStateContainerBackend =
+    BenchmarkTrackContainer::TrackStateContainerBackend;
+using CombinatorialKalmanFilterType =
+    CombinatorialKalmanFilter<Propagator<Stepper, Navigator>,
+                              BenchmarkTrackContainer>;
+using SurfaceSourceLinks =
+    std::unordered_multimap<GeometryIdentifier, TestSourceLink>;
+
+/// Source link accessor over the measurements of an event grouped by surface
+struct SurfaceSourceLinkAccessor {
+  struct Iterator {
+    using BaseIterator = SurfaceSourceLinks::const_iterator;
+
+    using iterator_category = BaseIterator::iterator_category;
+    using value_type = BaseIterator::value_type;
+    using difference_type = BaseIterator::difference_type;
+    using pointer = BaseIterator::pointer;
+    using reference = BaseIterator::reference;
+
+    Iterator& operator++() {
+      ++m_iterator;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return m_iterator == other.m_iterator;
+    }
+
+    SourceLink operator*() const { return SourceLink{m_iterator->second}; }
+
+    BaseIterator m_iterator;
+  };
+
+  const SurfaceSourceLinks* container = nullptr;
+
+  std::pair<Iterator, Iterator> range(const Surface& surface) const {
+    auto [begin, end] = container->equal_range(surface.geometryId());
+    return {Iterator{begin}, Iterator{end}};
+  }
+};
+
+namespace Acts {
+
+// not instantiated implicitly for the benchmark track state container
+template Result<std::pair<
+    std::vector<TrackStateContainerBackend::TrackStateProxy>::iterator,
+    std::vector<TrackStateContainerBackend::TrackStateProxy>::iterator>>
+MeasurementSelector::select<TrackStateContainerBackend>(
+    std::vector<TrackStateContainerBackend::TrackStateProxy>&, bool&,
+    const Logger&) const;
+
+}  // namespace Acts
+
+int main(int argc, char* argv[]) {
+  BenchmarkReconstruction benchmark;
+  if (auto ret = benchmark.parseOptions(argc, argv, 0)) {
+    return *ret;
+  }
+
+  BenchmarkTelescope telescope;
+  auto propagator =
+      telescope.makePropagator<Stepper>(benchmark.BzInT * UnitConstants::T);
+  auto events = telescope.generateEvents(benchmark, propagator,
+                                         ParticleHypothesis::pion());
+
+  CombinatorialKalmanFilterType ckf(propagator);
+
+  GainMatrixUpdater kfUpdater;
+
+  // up to three branches per surface with a loose chi2 cut, so the
+  // combinatorics grows with the measurement density and thus the pile-up
+  MeasurementSelector::Config measurementSelectorCfg = {
+      {GeometryIdentifier(), {{}, {15.}, {3u}}},
+  };
+  MeasurementSelector measurementSelector(measurementSelectorCfg);
+
+  SurfaceSourceLinkAccessor slAccessor;
+
+  using TrackStateCreatorType =
+      TrackStateCreator<SurfaceSourceLinkAccessor::Iterator,
+                        BenchmarkTrackContainer>;
+  TrackStateCreatorType trackStateCreator;
+  trackStateCreator.sourceLinkAccessor
+      .connect<&SurfaceSourceLinkAccessor::range>(&slAccessor);
+  trackStateCreator.calibrator
+      .connect<&testSourceLinkCalibrator<TrackStateContainerBackend>>();
+  trackStateCreator.measurementSelector
+      .connect<&MeasurementSelector::select<TrackStateContainerBackend>>(
+          &measurementSelector);
+
+  CombinatorialKalmanFilterExtensions<BenchmarkTrackContainer> extensions;
+  extensions.updater
+      .connect<&GainMatrixUpdater::operator()<TrackStateContainerBackend>>(
+          &kfUpdater);
+  extensions.createTrackStates
+      .connect<&TrackStateCreatorType::createTrackStates>(&trackStateCreator);
+
+  CombinatorialKalmanFilterOptions<BenchmarkTrackContainer> options(
+      telescope.geoCtx, telescope.magCtx, telescope.calCtx, extensions,
+      PropagatorPlainOptions(telescope.geoCtx, telescope.magCtx));
+
+  benchmark.run(
+      "CombinatorialKalmanFilter", events,
+      [&](const BenchmarkTelescope::Event& event) {
+        slAccessor.container = &event.surfaceSourceLinks;
+        BenchmarkTrackContainer tracks{VectorTrackContainer{},
+                                       VectorMultiTrajectory{}};
+        for (const auto& start : event.startParameters) {
+          auto res = ckf.findTracks(start, options, tracks);
+          assumeRead(res);
+        }
+        return tracks.size();
+      },
+      "tracks");
+
+  return 0;
+}
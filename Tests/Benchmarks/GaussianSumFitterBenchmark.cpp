@@ -0,0 +1,78 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/GaussianSumFitter.hpp"
+#include "Acts/TrackFitting/GsfMixtureReduction.hpp"
+#include "Acts/TrackFitting/GsfOptions.hpp"
+
+#include "ReconstructionBenchmarkCommons.hpp"
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+using namespace ActsTests;
+
+using Stepper = MultiEigenStepperLoop<>;
+using GaussianSumFitterType =
+    GaussianSumFitter<Propagator<Stepper, Navigator>, VectorMultiTrajectory>;
+
+int main(int argc, char* argv[]) {
+  BenchmarkReconstruction benchmark;
+  if (auto ret = benchmark.parseOptions(argc, argv, 0)) {
+    return *ret;
+  }
+
+  BenchmarkTelescope telescope;
+  const double bz = benchmark.BzInT * UnitConstants::T;
+  auto events = telescope.generateEvents(
+      benchmark, telescope.makePropagator<EigenStepper<>>(bz),
+      ParticleHypothesis::electron());
+
+  GaussianSumFitterType fitter(
+      telescope.makePropagator<Stepper>(bz),
+      std::make_shared<AtlasBetheHeitlerApprox>(
+          makeDefaultBetheHeitlerApprox()));
+
+  GainMatrixUpdater kfUpdater;
+
+  GsfOptions<VectorMultiTrajectory> options{telescope.geoCtx, telescope.magCtx,
+                                            telescope.calCtx};
+  options.extensions.calibrator
+      .connect<&testSourceLinkCalibrator<VectorMultiTrajectory>>();
+  options.extensions.updater
+      .connect<&GainMatrixUpdater::operator()<VectorMultiTrajectory>>(
+          &kfUpdater);
+  options.extensions.surfaceAccessor
+      .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+          &telescope.surfaceAccessor);
+  options.extensions.mixtureReducer.connect<&reduceMixtureWithKLDistance>();
+  options.propagatorPlainOptions =
+      PropagatorPlainOptions(telescope.geoCtx, telescope.magCtx);
+
+  benchmark.run(
+      "GaussianSumFitter", events,
+      [&](const BenchmarkTelescope::Event& event) {
+        TrackContainer tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+        for (std::size_t i = 0; i < event.startParameters.size(); ++i) {
+          const auto& sourceLinks = event.trackSourceLinks[i];
+          auto res = fitter.fit(sourceLinks.begin(), sourceLinks.end(),
+                                event.startParameters[i], options, tracks);
+          assumeRead(res);
+        }
+        return tracks.size();
+      },
+      "tracks");
+
+  return 0;
+}
@@ -0,0 +1,27 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/HelixStepper.hpp"
+
+#include "StepperBenchmarkCommons.hpp"
+
+using namespace Acts;
+using namespace ActsTests;
+
+using Stepper = HelixStepper;
+
+int main(int argc, char* argv[]) {
+  BenchmarkStepper benchmark;
+  if (auto ret = benchmark.parseOptions(argc, argv)) {
+    return *ret;
+  }
+  auto bField = benchmark.makeField();
+  Stepper stepper(std::move(bField));
+  benchmark.run(stepper, "HelixStepper");
+  return 0;
+}
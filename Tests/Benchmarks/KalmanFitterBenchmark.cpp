@@ -0,0 +1,76 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/KalmanFitter.hpp"
+
+#include "ReconstructionBenchmarkCommons.hpp"
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+using namespace ActsTests;
+
+using Stepper = EigenStepper<>;
+using KalmanFitterType =
+    KalmanFitter<Propagator<Stepper, Navigator>, VectorMultiTrajectory>;
+
+int main(int argc, char* argv[]) {
+  BenchmarkReconstruction benchmark;
+  if (auto ret = benchmark.parseOptions(argc, argv, 0)) {
+    return *ret;
+  }
+
+  BenchmarkTelescope telescope;
+  auto propagator =
+      telescope.makePropagator<Stepper>(benchmark.BzInT * UnitConstants::T);
+  auto events = telescope.generateEvents(benchmark, propagator,
+                                         ParticleHypothesis::pion());
+
+  KalmanFitterType fitter(propagator);
+
+  GainMatrixUpdater kfUpdater;
+  GainMatrixSmoother kfSmoother;
+
+  KalmanFitterExtensions<VectorMultiTrajectory> extensions;
+  extensions.calibrator
+      .connect<&testSourceLinkCalibrator<VectorMultiTrajectory>>();
+  extensions.updater
+      .connect<&GainMatrixUpdater::operator()<VectorMultiTrajectory>>(
+          &kfUpdater);
+  extensions.smoother
+      .connect<&GainMatrixSmoother::operator()<VectorMultiTrajectory>>(
+          &kfSmoother);
+  extensions.surfaceAccessor
+      .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+          &telescope.surfaceAccessor);
+
+  KalmanFitterOptions options(
+      telescope.geoCtx, telescope.magCtx, telescope.calCtx, extensions,
+      PropagatorPlainOptions(telescope.geoCtx, telescope.magCtx));
+
+  benchmark.run(
+      "KalmanFitter", events,
+      [&](const BenchmarkTelescope::Event& event) {
+        TrackContainer tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+        for (std::size_t i = 0; i < event.startParameters.size(); ++i) {
+          const auto& sourceLinks = event.trackSourceLinks[i];
+          auto res = fitter.fit(sourceLinks.begin(), sourceLinks.end(),
+                                event.startParameters[i], options, tracks);
+          assumeRead(res);
+        }
+        return tracks.size();
+      },
+      "tracks");
+
+  return 0;
+}
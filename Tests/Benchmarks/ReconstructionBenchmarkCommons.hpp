@@ -0,0 +1,259 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+#include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "ActsTests/CommonHelpers/MeasurementsCreator.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace ActsTests {
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+
+/// Heap allocations of the process, counted by the global allocation
+/// functions replaced in AllocationCounter.cpp
+struct AllocationStatistics {
+  std::size_t allocations = 0;
+  std::size_t bytes = 0;
+
+  friend AllocationStatistics operator-(const AllocationStatistics& lhs,
+                                        const AllocationStatistics& rhs) {
+    return {lhs.allocations - rhs.allocations, lhs.bytes - rhs.bytes};
+  }
+};
+
+/// Allocations since the start of the process
+AllocationStatistics allocationStatistics();
+
+/// Common options and reporting of the reconstruction benchmarks.
+///
+/// Every benchmark processes a set of synthetic events with `pileup` vertices
+/// of `tracksPerVertex` tracks each. It reports the event and track
+/// throughput, and the heap allocations per event and per track.
+struct BenchmarkReconstruction {
+  unsigned int events{};
+  unsigned int pileup{};
+  unsigned int tracksPerVertex{};
+  unsigned int runs{};
+  double ptInGeV{};
+  double BzInT{};
+  unsigned int seed{};
+  unsigned int lvl{};
+
+  std::optional<int> parseOptions(int argc, char* argv[],
+                                  double defaultBzInT) {
+    try {
+      po::options_description desc("Allowed options");
+      // clang-format off
+      desc.add_options()
+        ("help", "produce help message")
+        ("events",po::value<unsigned int>(&events)->default_value(10),"number of events to generate")
+        ("pileup",po::value<unsigned int>(&pileup)->default_value(50),"number of vertices per event")
+        ("tracks",po::value<unsigned int>(&tracksPerVertex)->default_value(10),"number of tracks per vertex")
+        ("runs",po::value<unsigned int>(&runs)->default_value(10),"number of benchmark runs over all events")
+        ("pT",po::value<double>(&ptInGeV)->default_value(1),"transverse momentum in GeV")
+        ("B",po::value<double>(&BzInT)->default_value(defaultBzInT),"z-component of B-field in T")
+        ("seed",po::value<unsigned int>(&seed)->default_value(42),"random number seed")
+        ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+      // clang-format on
+      po::variables_map vm;
+      po::store(po::parse_command_line(argc, argv, desc), vm);
+      po::notify(vm);
+
+      if (vm.contains("help")) {
+        std::cout << desc << std::endl;
+        return 0;
+      }
+    } catch (std::exception& e) {
+      std::cerr << "error: " << e.what() << std::endl;
+      return 1;
+    }
+
+    return std::nullopt;
+  }
+
+  std::size_t tracksPerEvent() const { return pileup * tracksPerVertex; }
+
+  /// Run the reconstruction step on all events and report the results.
+  ///
+  /// @param name The name of the benchmark
+  /// @param inputs The generated events
+  /// @param process Processes one event, returns the number of output objects
+  /// @param outputName The name of the output objects
+  template <typename event_t, typename process_t>
+  void run(const std::string& name, const std::vector<event_t>& inputs,
+           process_t&& process, const std::string& outputName) const {
+    ACTS_LOCAL_LOGGER(Acts::getDefaultLogger(name, Acts::Logging::Level(lvl)));
+
+    ACTS_INFO("processing " << inputs.size() << " events with pile-up "
+                            << pileup << " and " << tracksPerEvent()
+                            << " tracks per event");
+
+    // a single pass over all events outside of the timing to count the
+    // allocations, it also warms up the caches of the reconstruction
+    std::size_t nOutputs = 0;
+    const AllocationStatistics start = allocationStatistics();
+    for (const auto& input : inputs) {
+      nOutputs += process(input);
+    }
+    const AllocationStatistics allocations = allocationStatistics() - start;
+
+    const auto result = microBenchmark(
+        [&](const event_t& input) { return process(input); }, inputs, runs);
+
+    const double nEvents = inputs.size();
+    const double nTracks = nEvents * tracksPerEvent();
+    const double eventsPerSecond = 1e9 / result.iterTimeAverage().count();
+
+    ACTS_INFO("Execution stats: " << result);
+    ACTS_INFO("throughput = " << eventsPerSecond << " events/s, "
+                              << eventsPerSecond * tracksPerEvent()
+                              << " tracks/s");
+    ACTS_INFO("allocations = " << allocations.allocations / nEvents
+                               << " per event, "
+                               << allocations.allocations / nTracks
+                               << " per track");
+    ACTS_INFO("allocated memory = " << allocations.bytes / nEvents / 1024
+                                    << " kB per event, "
+                                    << allocations.bytes / nTracks / 1024
+                                    << " kB per track");
+    ACTS_INFO("average number of " << outputName << " = "
+                                   << nOutputs / nEvents << " per event");
+  }
+};
+
+/// Telescope of pixel and strip planes with the tracks of all vertices
+/// crossing it, used by the track finding and fitting benchmarks.
+struct BenchmarkTelescope {
+  using TestSourceLink = Acts::detail::Test::TestSourceLink;
+
+  struct Event {
+    /// Truth parameters before the first plane, one per track
+    std::vector<Acts::BoundTrackParameters> startParameters;
+    /// Measurements of every track
+    std::vector<std::vector<Acts::SourceLink>> trackSourceLinks;
+    /// Measurements of all tracks grouped by surface
+    std::unordered_multimap<Acts::GeometryIdentifier, TestSourceLink>
+        surfaceSourceLinks;
+  };
+
+  Acts::GeometryContext geoCtx =
+      Acts::GeometryContext::dangerouslyDefaultConstruct();
+  Acts::MagneticFieldContext magCtx;
+  Acts::CalibrationContext calCtx;
+
+  CubicTrackingGeometry geometryStore{geoCtx};
+  std::shared_ptr<const Acts::TrackingGeometry> geometry = geometryStore();
+
+  TestSourceLink::SurfaceAccessor surfaceAccessor{*geometry};
+
+  MeasurementResolution resPixel = {MeasurementType::eLoc01, {25_um, 50_um}};
+  MeasurementResolution resStrip0 = {MeasurementType::eLoc0, {100_um}};
+  MeasurementResolution resStrip1 = {MeasurementType::eLoc1, {150_um}};
+  MeasurementResolutionMap resolutions = {
+      {Acts::GeometryIdentifier().withVolume(2), resPixel},
+      {Acts::GeometryIdentifier().withVolume(3).withLayer(2), resStrip0},
+      {Acts::GeometryIdentifier().withVolume(3).withLayer(4), resStrip1},
+      {Acts::GeometryIdentifier().withVolume(3).withLayer(6), resStrip0},
+      {Acts::GeometryIdentifier().withVolume(3).withLayer(8), resStrip1},
+  };
+
+  /// Construct a propagator through the telescope in a constant field along z
+  template <typename stepper_t>
+  Acts::Propagator<stepper_t, Acts::Navigator> makePropagator(double bz) const {
+    Acts::Navigator::Config cfg{geometry};
+    cfg.resolvePassive = false;
+    cfg.resolveMaterial = true;
+    cfg.resolveSensitive = true;
+    Acts::Navigator navigator(cfg);
+    auto field =
+        std::make_shared<Acts::ConstantBField>(Acts::Vector3(0.0, 0.0, bz));
+    return Acts::Propagator<stepper_t, Acts::Navigator>(
+        stepper_t(std::move(field)), std::move(navigator));
+  }
+
+  /// Generate the events and simulate the measurements of their tracks.
+  ///
+  /// The vertices are placed in front of the telescope and their tracks fan
+  /// out within a few degrees around its axis.
+  template <typename propagator_t>
+  std::vector<Event> generateEvents(
+      const BenchmarkReconstruction& benchmark, const propagator_t& propagator,
+      const Acts::ParticleHypothesis& particle) const {
+    std::default_random_engine rng(benchmark.seed);
+    std::uniform_real_distribution<double> vertexDist(-50_mm, 50_mm);
+    std::uniform_real_distribution<double> angleDist(-3_degree, 3_degree);
+    std::uniform_real_distribution<double> momentumDist(0.5, 1.5);
+    std::bernoulli_distribution chargeDist;
+
+    Acts::BoundVector stddev;
+    stddev[Acts::eBoundLoc0] = 100_um;
+    stddev[Acts::eBoundLoc1] = 100_um;
+    stddev[Acts::eBoundTime] = 25_ns;
+    stddev[Acts::eBoundPhi] = 2_degree;
+    stddev[Acts::eBoundTheta] = 2_degree;
+    stddev[Acts::eBoundQOverP] = 1 / 100_GeV;
+    Acts::BoundMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+    std::vector<Event> events(benchmark.events);
+    for (Event& event : events) {
+      for (unsigned int iv = 0; iv < benchmark.pileup; ++iv) {
+        Acts::Vector4 pos4(-3_m, vertexDist(rng), vertexDist(rng), 0_ns);
+        for (unsigned int it = 0; it < benchmark.tracksPerVertex; ++it) {
+          double q = chargeDist(rng) ? 1_e : -1_e;
+          double p = momentumDist(rng) * benchmark.ptInGeV * 1_GeV;
+          auto& start = event.startParameters.emplace_back(
+              Acts::BoundTrackParameters::createCurvilinear(
+                  pos4, angleDist(rng), 90_degree + angleDist(rng), q / p,
+                  cov, particle));
+
+          std::size_t sourceId = event.trackSourceLinks.size();
+          auto measurements = createMeasurements(
+              propagator, geoCtx, magCtx, start, resolutions, rng, sourceId);
+          auto& sourceLinks = event.trackSourceLinks.emplace_back();
+          for (const TestSourceLink& sl : measurements.sourceLinks) {
+            sourceLinks.emplace_back(sl);
+            event.surfaceSourceLinks.emplace(sl.m_geometryId, sl);
+          }
+        }
+      }
+    }
+    return events;
+  }
+};
+
+}  // namespace ActsTests
@@ -0,0 +1,105 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/ReferenceSurfaceStorage.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+#include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace ActsTests;
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Logging::INFO;
+  unsigned int nStates = 1000;
+  unsigned int nRuns = 1000;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "produce help message")
+        ("states", po::value<unsigned int>(&nStates)->default_value(1000), "number of track states per iteration")
+        ("runs", po::value<unsigned int>(&nRuns)->default_value(1000), "number of benchmark runs")
+        ("verbose", po::value<unsigned int>(&lvl)->default_value(Logging::INFO), "logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("ReferenceSurfaceStorage", Logging::Level(lvl)));
+
+  auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+  CubicTrackingGeometry cubic(gctx);
+  std::shared_ptr<const TrackingGeometry> geometry = cubic();
+
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  geometry->visitSurfaces(
+      [&](const Surface* surface) {
+        surfaces.push_back(surface->getSharedPtr());
+      },
+      true);
+
+  ACTS_INFO("Setting and copying " << nStates << " reference surfaces out of "
+                                   << surfaces.size() << " geometry surfaces");
+
+  // Sets the reference surfaces like the track finding does for every new
+  // track state, and copies the track states like when the tracks are stored.
+  // The track states are created upfront to only measure the surface handling.
+  auto run = [&](ReferenceSurfaceStorage storage) {
+    VectorMultiTrajectory input;
+    VectorMultiTrajectory output;
+    input.setReferenceSurfaceStorage(storage, geometry);
+    output.setReferenceSurfaceStorage(storage, geometry);
+    for (unsigned int i = 0; i < nStates; ++i) {
+      input.addTrackState(TrackStatePropMask::None);
+      output.addTrackState(TrackStatePropMask::None);
+    }
+
+    return microBenchmark(
+        [&] {
+          for (unsigned int i = 0; i < nStates; ++i) {
+            input.getTrackState(i).setReferenceSurface(
+                surfaces[i % surfaces.size()]);
+          }
+          for (unsigned int i = 0; i < nStates; ++i) {
+            output.getTrackState(i).copyFrom(input.getTrackState(i),
+                                             TrackStatePropMask::None);
+          }
+        },
+        1, nRuns);
+  };
+
+  ACTS_INFO("Shared:            " << run(ReferenceSurfaceStorage::Shared));
+  ACTS_INFO("NonOwningGeometry: "
+            << run(ReferenceSurfaceStorage::NonOwningGeometry));
+
+  return 0;
+}
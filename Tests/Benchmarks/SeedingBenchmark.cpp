@@ -0,0 +1,249 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/EventData/SeedContainer2.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/Seeding2/BroadTripletSeedFilter.hpp"
+#include "Acts/Seeding2/CylindricalSpacePointGrid2.hpp"
+#include "Acts/Seeding2/DoubletSeedFinder.hpp"
+#include "Acts/Seeding2/TripletSeedFinder.hpp"
+#include "Acts/Seeding2/TripletSeeder.hpp"
+#include "Acts/Utilities/RangeXD.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+#include "ReconstructionBenchmarkCommons.hpp"
+
+using namespace Acts;
+using namespace ActsTests;
+
+namespace {
+
+struct BenchmarkSpacePoint {
+  float x = 0;
+  float y = 0;
+  float z = 0;
+  float r = 0;
+  float phi = 0;
+  float varianceZ = 0;
+  float varianceR = 0;
+};
+
+using SpacePointEvent = std::vector<BenchmarkSpacePoint>;
+
+/// Barrel layers as radius and half length, similar to the pixel and short
+/// strip barrels of the generic detector
+constexpr std::array<std::pair<float, float>, 7> kBarrelLayers = {{
+    {32, 400},
+    {72, 400},
+    {116, 400},
+    {172, 400},
+    {260, 1100},
+    {360, 1100},
+    {500, 1100},
+}};
+
+/// Generate the space points of helical tracks from vertices distributed
+/// along the beam line, intersected with the barrel layers.
+std::vector<SpacePointEvent> generateEvents(
+    const BenchmarkReconstruction& benchmark) {
+  std::default_random_engine rng(benchmark.seed);
+  std::normal_distribution<double> vertexZDist(0, 50_mm);
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  std::uniform_real_distribution<double> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<double> ptDist(0.5, 1.5);
+  std::bernoulli_distribution chargeDist;
+  std::normal_distribution<double> rphiResolution(0, 10_um);
+  std::normal_distribution<double> zResolution(0, 50_um);
+
+  const double bz = benchmark.BzInT * UnitConstants::T;
+
+  std::vector<SpacePointEvent> events(benchmark.events);
+  for (SpacePointEvent& event : events) {
+    for (unsigned int iv = 0; iv < benchmark.pileup; ++iv) {
+      const double vz = vertexZDist(rng);
+      for (unsigned int it = 0; it < benchmark.tracksPerVertex; ++it) {
+        const double q = chargeDist(rng) ? 1 : -1;
+        const double pt = ptDist(rng) * benchmark.ptInGeV * 1_GeV;
+        const double phi0 = phiDist(rng);
+        const double cotTheta = std::sinh(etaDist(rng));
+        // transverse helix radius, the sign encodes the bending direction
+        const double radius = pt / (q * bz);
+
+        for (const auto& [r, halfLength] : kBarrelLayers) {
+          // arc length to the layer in the transverse plane
+          const double halfChord = r / (2 * radius);
+          if (std::abs(halfChord) >= 1) {
+            break;
+          }
+          const double s = 2 * radius * std::asin(halfChord);
+          const double z = vz + std::abs(s) * cotTheta + zResolution(rng);
+          if (std::abs(z) > halfLength) {
+            continue;
+          }
+          const double phi =
+              phi0 - std::asin(halfChord) + rphiResolution(rng) / r;
+
+          BenchmarkSpacePoint& sp = event.emplace_back();
+          sp.x = r * std::cos(phi);
+          sp.y = r * std::sin(phi);
+          sp.z = z;
+          sp.r = r;
+          sp.phi = std::atan2(sp.y, sp.x);
+          sp.varianceZ = 50_um * 50_um;
+          sp.varianceR = 10_um * 10_um;
+        }
+      }
+    }
+  }
+  return events;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  BenchmarkReconstruction benchmark;
+  if (auto ret = benchmark.parseOptions(argc, argv, 2)) {
+    return *ret;
+  }
+
+  auto events = generateEvents(benchmark);
+
+  const float bFieldInZ = benchmark.BzInT * UnitConstants::T;
+  const float minPt = 400_MeV;
+  const float cotThetaMax = 10.01788;
+  const float impactMax = 20_mm;
+  const float deltaRMin = 5_mm;
+  const float deltaRMax = 270_mm;
+
+  CylindricalSpacePointGrid2::Config gridConfig;
+  gridConfig.minPt = minPt;
+  gridConfig.rMax = 600_mm;
+  gridConfig.zMin = -1100_mm;
+  gridConfig.zMax = 1100_mm;
+  gridConfig.deltaRMax = deltaRMax;
+  gridConfig.cotThetaMax = cotThetaMax;
+  gridConfig.impactMax = impactMax;
+  gridConfig.bFieldInZ = bFieldInZ;
+  gridConfig.bottomBinFinder.emplace(1, 1, 0);
+  gridConfig.topBinFinder.emplace(1, 1, 0);
+
+  DoubletSeedFinder::Config bottomDoubletFinderConfig;
+  bottomDoubletFinderConfig.spacePointsSortedByRadius = true;
+  bottomDoubletFinderConfig.candidateDirection = Direction::Backward();
+  bottomDoubletFinderConfig.deltaRMin = deltaRMin;
+  bottomDoubletFinderConfig.deltaRMax = deltaRMax;
+  bottomDoubletFinderConfig.impactMax = impactMax;
+  bottomDoubletFinderConfig.cotThetaMax = cotThetaMax;
+  bottomDoubletFinderConfig.minPt = minPt;
+  auto bottomDoubletFinder = DoubletSeedFinder::create(
+      DoubletSeedFinder::DerivedConfig(bottomDoubletFinderConfig, bFieldInZ));
+
+  DoubletSeedFinder::Config topDoubletFinderConfig = bottomDoubletFinderConfig;
+  topDoubletFinderConfig.candidateDirection = Direction::Forward();
+  auto topDoubletFinder = DoubletSeedFinder::create(
+      DoubletSeedFinder::DerivedConfig(topDoubletFinderConfig, bFieldInZ));
+
+  TripletSeedFinder::Config tripletFinderConfig;
+  tripletFinderConfig.useStripInfo = false;
+  tripletFinderConfig.sortedByCotTheta = true;
+  tripletFinderConfig.minPt = minPt;
+  tripletFinderConfig.impactMax = impactMax;
+  auto tripletFinder = TripletSeedFinder::create(
+      TripletSeedFinder::DerivedConfig(tripletFinderConfig, bFieldInZ));
+
+  BroadTripletSeedFilter::Config filterConfig;
+  filterConfig.deltaRMin = deltaRMin;
+
+  const std::pair<float, float> radiusRangeForMiddle = {60_mm, 120_mm};
+
+  auto logger = getDefaultLogger("Seeding", Logging::Level(benchmark.lvl));
+  TripletSeeder seeder(logger->clone());
+  TripletSeeder::Cache cache;
+
+  benchmark.run(
+      "Seeding", events,
+      [&](const SpacePointEvent& spacePoints) {
+        CylindricalSpacePointGrid2 grid(gridConfig, logger->clone());
+        for (std::size_t i = 0; i < spacePoints.size(); ++i) {
+          const BenchmarkSpacePoint& sp = spacePoints[i];
+          grid.insert(i, sp.phi, sp.z, sp.r);
+        }
+        for (std::size_t i = 0; i < grid.numberOfBins(); ++i) {
+          std::ranges::sort(grid.at(i), [&](SpacePointIndex2 a,
+                                            SpacePointIndex2 b) {
+            return spacePoints[a].r < spacePoints[b].r;
+          });
+        }
+
+        SpacePointContainer2 coreSpacePoints(
+            SpacePointColumns::PackedXY | SpacePointColumns::PackedZR |
+            SpacePointColumns::VarianceZ | SpacePointColumns::VarianceR |
+            SpacePointColumns::CopyFromIndex);
+        coreSpacePoints.reserve(grid.numberOfSpacePoints());
+        std::vector<SpacePointIndexRange2> gridSpacePointRanges;
+        gridSpacePointRanges.reserve(grid.numberOfBins());
+        for (std::size_t i = 0; i < grid.numberOfBins(); ++i) {
+          std::uint32_t begin = coreSpacePoints.size();
+          for (SpacePointIndex2 spIndex : grid.at(i)) {
+            const BenchmarkSpacePoint& sp = spacePoints[spIndex];
+            auto newSp = coreSpacePoints.createSpacePoint();
+            newSp.xy() = std::array<float, 2>{sp.x, sp.y};
+            newSp.zr() = std::array<float, 2>{sp.z, sp.r};
+            newSp.varianceZ() = sp.varianceZ;
+            newSp.varianceR() = sp.varianceR;
+            newSp.copyFromIndex() = spIndex;
+          }
+          std::uint32_t end = coreSpacePoints.size();
+          gridSpacePointRanges.emplace_back(begin, end);
+        }
+
+        BroadTripletSeedFilter::State filterState;
+        BroadTripletSeedFilter::Cache filterCache;
+        BroadTripletSeedFilter seedFilter(filterConfig, filterState,
+                                          filterCache, *logger);
+
+        std::vector<SpacePointContainer2::ConstRange> bottomSpRanges;
+        std::vector<SpacePointContainer2::ConstRange> topSpRanges;
+
+        SeedContainer2 seeds;
+
+        for (const auto [bottom, middle, top] : grid.binnedGroup()) {
+          auto middleSpRange =
+              coreSpacePoints.range(gridSpacePointRanges.at(middle)).asConst();
+          if (middleSpRange.empty()) {
+            continue;
+          }
+          bottomSpRanges.clear();
+          for (const auto b : bottom) {
+            bottomSpRanges.push_back(
+                coreSpacePoints.range(gridSpacePointRanges.at(b)).asConst());
+          }
+          topSpRanges.clear();
+          for (const auto t : top) {
+            topSpRanges.push_back(
+                coreSpacePoints.range(gridSpacePointRanges.at(t)).asConst());
+          }
+
+          seeder.createSeedsFromGroups(
+              cache, *bottomDoubletFinder, *topDoubletFinder, *tripletFinder,
+              seedFilter, coreSpacePoints, bottomSpRanges, middleSpRange,
+              topSpRanges, radiusRangeForMiddle, seeds);
+        }
+
+        return seeds.size();
+      },
+      "seeds");
+
+  return 0;
+}
@@ -14,12 +14,14 @@
 #include "Acts/Utilities/VectorHelpers.hpp"
 #include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iostream>
 #include <numbers>
 #include <random>
 #include <string>
+#include <vector>
 
 using namespace Acts;
 using namespace UnitLiterals;
@@ -146,6 +148,26 @@ int main(int argc, char* argv[]) {
     csv("interp_cache_random", map_rand_result_cache);
   }
 
+  // - This variation of the second benchmark looks up the field for a batch of
+  //   random positions with a single call, as done when several tracks are
+  //   propagated together. The positions are generated beforehand.
+  {
+    std::cout << "Benchmarking batched random interpolated field lookup: "
+              << std::flush;
+    auto cache = bFieldMap.makeCache(mctx);
+    std::vector<Vector3> positions(iters_map);
+    std::ranges::generate(positions, genPos);
+    std::vector<Vector3> fields(positions.size());
+    const auto map_batch_result = microBenchmark(
+        [&] {
+          bFieldMap.getFields(positions, fields, cache).value();
+          return fields.front();
+        },
+        1);
+    std::cout << map_batch_result << std::endl;
+    csv("interp_batch_random", map_batch_result);
+  }
+
   // - The fourth benchmark tests a more 'realistic' access pattern than fixed
   //   or random positions: it advances along a straight line (which is close to
   //   a slightly curved line which happens in particle propagation). This
@@ -12,6 +12,7 @@
 
 #include <iostream>
 #include <type_traits>
+#include <vector>
 
 using namespace Acts;
 using namespace ActsTests;
@@ -93,6 +94,26 @@ int main(int /*argc*/, char** /*argv[]*/) {
       inputs);
   std::cout << copyMoveConstructSourceLink << std::endl;
 
+  std::cout << "Copy assign source link" << std::endl;
+  SourceLink target{bsl};
+  auto copyAssignSourceLink = microBenchmark(
+      [&](const SourceLink& input) {
+        target = input;
+        return target;
+      },
+      inputs);
+  std::cout << copyAssignSourceLink << std::endl;
+
+  std::cout << "Copy source link vector" << std::endl;
+  std::vector<SourceLink> candidates(inputs.begin(), inputs.begin() + 100);
+  auto copySourceLinkVector = microBenchmark(
+      [&]() {
+        std::vector<SourceLink> copy = candidates;
+        return copy;
+      },
+      n / 100);
+  std::cout << copySourceLinkVector << std::endl;
+
   std::cout << "Optional assignment" << std::endl;
   auto opt_assignment = microBenchmark(
       [&]() {
@@ -126,5 +147,27 @@ int main(int /*argc*/, char** /*argv[]*/) {
       n / 10);
   std::cout << assignSourceLink << std::endl;
 
+  // CKF-like pattern: the branches created for the candidate measurements on
+  // a surface copy the source link from their parent track state
+  std::cout << "Copy source links into track state branches" << std::endl;
+  VectorMultiTrajectory branches;
+  auto parent = branches.makeTrackState(TrackStatePropMask::None);
+  parent.setUncalibratedSourceLink(SourceLink{bsl});
+  std::vector<TrackIndexType> branchIndices;
+  branchIndices.reserve(n / 10);
+  for (std::size_t i = 0; i < n / 10; ++i) {
+    branchIndices.push_back(
+        branches.makeTrackState(TrackStatePropMask::None, parent.index())
+            .index());
+  }
+  auto branchSourceLinks = microBenchmark(
+      [&](TrackIndexType index) {
+        auto ts = branches.getTrackState(index);
+        ts.setUncalibratedSourceLink(parent.getUncalibratedSourceLink());
+        return ts.getUncalibratedSourceLink().get<BenchmarkSourceLink>();
+      },
+      branchIndices);
+  std::cout << branchSourceLinks << std::endl;
+
   return 0;
 }
@@ -9,6 +9,7 @@
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Propagator/AtlasStepper.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Propagator/SympyStepper.hpp"
 
@@ -35,5 +36,7 @@ int main(int argc, char* argv[]) {
   benchmark.run(straightLineStepper, "StraightLineStepper");
   SympyStepper sympyStepper(bField);
   benchmark.run(sympyStepper, "SympyStepper");
+  HelixStepper helixStepper(bField);
+  benchmark.run(helixStepper, "HelixStepper");
   return 0;
 }
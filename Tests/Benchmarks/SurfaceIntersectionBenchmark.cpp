@@ -10,7 +10,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/Definitions/Tolerance.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Navigation/NavigationStream.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
@@ -18,11 +20,14 @@
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceIntersectionBatch.hpp"
 #include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <numbers>
 #include <random>
+#include <vector>
 
 using namespace Acts;
 using namespace Acts::UnitLiterals;
@@ -39,6 +44,7 @@ const bool testPlane = true;
 const bool testDisc = true;
 const bool testCylinder = true;
 const bool testStraw = true;
+unsigned int nBatchSurfaces = 200;
 
 // Create a test context
 GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
@@ -125,4 +131,175 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+// Intersects all surfaces one by one, which is what the navigation stream
+// does for every candidate without the batch prefilter
+std::size_t intersectAll(const std::vector<std::shared_ptr<Surface>>& surfaces,
+                         const Vector3& direction) {
+  std::size_t nValid = 0;
+  for (const auto& surface : surfaces) {
+    auto multiIntersection = surface->intersect(tgContext, origin, direction,
+                                                BoundaryTolerance::None());
+    nValid += multiIntersection.at(0).isValid() &&
+              multiIntersection.at(0).pathLength() > 0;
+  }
+  return nValid;
+}
+
+std::size_t intersectBatch(const std::vector<std::shared_ptr<Surface>>& surfaces,
+                           SurfaceIntersectionBatch& batch,
+                           const Vector3& direction) {
+  std::size_t nValid = 0;
+  const auto pathLengths = batch.maxPathLengths(origin, direction);
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    if (pathLengths[i] < 0) {
+      continue;
+    }
+    auto multiIntersection = surfaces[i]->intersect(
+        tgContext, origin, direction, BoundaryTolerance::None());
+    nValid += multiIntersection.at(0).isValid() &&
+              multiIntersection.at(0).pathLength() > 0;
+  }
+  return nValid;
+}
+
+// Planes and discs around the origin, half of them are behind it
+std::vector<std::shared_ptr<Surface>> makeBatchSurfaces(unsigned int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (unsigned int i = 0; i < nBatchSurfaces; ++i) {
+    Transform3 transform =
+        Transform3::Identity() *
+        Translation3(uniform(rng) * 1_m, uniform(rng) * 1_m,
+                     (i % 2 == 0 ? 1 : -1) * (1_m + uniform(rng) * 0.5_m)) *
+        AngleAxis3(uniform(rng) * 0.3, Vector3::UnitX());
+    if (i % 4 < 2) {
+      surfaces.push_back(Surface::makeShared<PlaneSurface>(
+          transform, std::make_shared<RectangleBounds>(0.2_m, 0.2_m)));
+    } else {
+      surfaces.push_back(Surface::makeShared<DiscSurface>(
+          transform, std::make_shared<RadialBounds>(0.1_m, 0.3_m)));
+    }
+  }
+  return surfaces;
+}
+
+BOOST_DATA_TEST_CASE(
+    benchmark_batch_intersections,
+    bdata::random((bdata::engine = std::mt19937(), bdata::seed = 23,
+                   bdata::distribution = std::uniform_real_distribution<double>(
+                       -std::numbers::pi, std::numbers::pi))) ^
+        bdata::random((bdata::engine = std::mt19937(), bdata::seed = 24,
+                       bdata::distribution =
+                           std::uniform_real_distribution<double>(-0.3, 0.3))) ^
+        bdata::xrange(ntests),
+    phi, theta, index) {
+  auto surfaces = makeBatchSurfaces(index);
+  SurfaceIntersectionBatch batch;
+  for (const auto& surface : surfaces) {
+    batch.add(tgContext, *surface);
+  }
+
+  Vector3 direction(std::cos(phi) * std::sin(theta),
+                    std::sin(phi) * std::sin(theta), std::cos(theta));
+
+  BOOST_CHECK_EQUAL(intersectAll(surfaces, direction),
+                    intersectBatch(surfaces, batch, direction));
+
+  std::cout << std::endl
+            << "Benchmarking " << nBatchSurfaces
+            << " surfaces at theta=" << theta << ", phi=" << phi << "..."
+            << std::endl;
+  std::cout << "- Single: "
+            << microBenchmark([&] { return intersectAll(surfaces, direction); },
+                              1, nrepts)
+            << std::endl;
+  std::cout << "- Batch: "
+            << microBenchmark(
+                   [&] { return intersectBatch(surfaces, batch, direction); },
+                   1, nrepts)
+            << std::endl;
+}
+
+// Initializes the candidates the way the navigation stream did before the
+// batch prefilter: every surface is intersected and the forward solutions
+// are sorted by path length
+std::vector<double> initializeSingle(
+    const std::vector<std::shared_ptr<Surface>>& surfaces,
+    const Vector3& direction) {
+  std::vector<double> pathLengths;
+  for (const auto& surface : surfaces) {
+    auto multiIntersection =
+        surface->intersect(tgContext, origin, direction,
+                           BoundaryTolerance::None(), s_onSurfaceTolerance);
+    for (const auto& intersection : multiIntersection) {
+      if (intersection.isValid() &&
+          intersection.pathLength() >= -s_onSurfaceTolerance) {
+        pathLengths.push_back(intersection.pathLength());
+        break;
+      }
+    }
+  }
+  std::ranges::sort(pathLengths);
+  return pathLengths;
+}
+
+// Initializes a navigation stream, including packing the batch
+std::vector<double> initializeStream(NavigationStream& stream,
+                                     std::vector<const Surface*>& surfaces,
+                                     const Vector3& direction) {
+  stream.reset();
+  stream.addSurfaceCandidates(surfaces, BoundaryTolerance::None());
+  stream.initialize(tgContext, {origin, direction}, BoundaryTolerance::None(),
+                    s_onSurfaceTolerance);
+  std::vector<double> pathLengths;
+  for (const auto& candidate : stream.candidates()) {
+    pathLengths.push_back(candidate.intersection().pathLength());
+  }
+  return pathLengths;
+}
+
+BOOST_DATA_TEST_CASE(
+    benchmark_navigation_stream,
+    bdata::random((bdata::engine = std::mt19937(), bdata::seed = 25,
+                   bdata::distribution = std::uniform_real_distribution<double>(
+                       -std::numbers::pi, std::numbers::pi))) ^
+        bdata::random((bdata::engine = std::mt19937(), bdata::seed = 26,
+                       bdata::distribution =
+                           std::uniform_real_distribution<double>(-0.3, 0.3))) ^
+        bdata::xrange(ntests),
+    phi, theta, index) {
+  auto surfaces = makeBatchSurfaces(index);
+  std::vector<const Surface*> candidates;
+  for (const auto& surface : surfaces) {
+    candidates.push_back(surface.get());
+  }
+  NavigationStream stream;
+
+  Vector3 direction(std::cos(phi) * std::sin(theta),
+                    std::sin(phi) * std::sin(theta), std::cos(theta));
+
+  auto expected = initializeSingle(surfaces, direction);
+  auto pathLengths = initializeStream(stream, candidates, direction);
+  BOOST_CHECK_EQUAL_COLLECTIONS(pathLengths.begin(), pathLengths.end(),
+                                expected.begin(), expected.end());
+
+  std::cout << std::endl
+            << "Benchmarking stream initialization with " << nBatchSurfaces
+            << " surfaces at theta=" << theta << ", phi=" << phi << "..."
+            << std::endl;
+  std::cout << "- Single: "
+            << microBenchmark(
+                   [&] { return initializeSingle(surfaces, direction); }, 1,
+                   nrepts)
+            << std::endl;
+  std::cout << "- Stream: "
+            << microBenchmark(
+                   [&] {
+                     return initializeStream(stream, candidates, direction);
+                   },
+                   1, nrepts)
+            << std::endl;
+}
+
 }  // namespace ActsTests
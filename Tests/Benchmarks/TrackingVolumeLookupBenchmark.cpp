@@ -0,0 +1,153 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using namespace ActsTests;
+
+namespace {
+
+constexpr double rMax = 1200_mm;
+constexpr double barrelHalfZ = 1000_mm;
+constexpr double endcapLength = 2000_mm;
+
+/// Cylindrical detector with a barrel of layers stacked in r and endcaps of
+/// disks stacked in z, each disk being subdivided into rings stacked in r.
+std::shared_ptr<TrackingVolume> makeDetector(unsigned int nLayers,
+                                             unsigned int nDisks,
+                                             unsigned int nRings) {
+  auto world = std::make_shared<TrackingVolume>(
+      Transform3::Identity(),
+      std::make_shared<CylinderVolumeBounds>(0_mm, rMax,
+                                             barrelHalfZ + endcapLength),
+      "World");
+
+  auto& barrel = world->addVolume(std::make_unique<TrackingVolume>(
+      Transform3::Identity(),
+      std::make_shared<CylinderVolumeBounds>(0_mm, rMax, barrelHalfZ),
+      "Barrel"));
+  const double layerThickness = rMax / nLayers;
+  for (unsigned int i = 0; i < nLayers; ++i) {
+    barrel.addVolume(std::make_unique<TrackingVolume>(
+        Transform3::Identity(),
+        std::make_shared<CylinderVolumeBounds>(
+            i * layerThickness, (i + 1) * layerThickness, barrelHalfZ),
+        "Layer"));
+  }
+
+  const double diskHalfZ = 0.5 * endcapLength / nDisks;
+  const double ringThickness = rMax / nRings;
+  for (double side : {-1., 1.}) {
+    for (unsigned int i = 0; i < nDisks; ++i) {
+      const double z = side * (barrelHalfZ + (2 * i + 1) * diskHalfZ);
+      auto& disk = world->addVolume(std::make_unique<TrackingVolume>(
+          Transform3(Translation3(0, 0, z)),
+          std::make_shared<CylinderVolumeBounds>(0_mm, rMax, diskHalfZ),
+          "Disk"));
+      for (unsigned int j = 0; j < nRings; ++j) {
+        disk.addVolume(std::make_unique<TrackingVolume>(
+            Transform3(Translation3(0, 0, z)),
+            std::make_shared<CylinderVolumeBounds>(
+                j * ringThickness, (j + 1) * ringThickness, diskHalfZ),
+            "Ring"));
+      }
+    }
+  }
+
+  return world;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Logging::INFO;
+  unsigned int nLayers = 20;
+  unsigned int nDisks = 10;
+  unsigned int nRings = 10;
+  unsigned int nPoints = 1000;
+  unsigned int nRuns = 1000;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "produce help message")
+        ("layers", po::value<unsigned int>(&nLayers)->default_value(20), "number of barrel layers")
+        ("disks", po::value<unsigned int>(&nDisks)->default_value(10), "number of disks per endcap")
+        ("rings", po::value<unsigned int>(&nRings)->default_value(10), "number of rings per disk")
+        ("points", po::value<unsigned int>(&nPoints)->default_value(1000), "number of lookup positions")
+        ("runs", po::value<unsigned int>(&nRuns)->default_value(1000), "number of benchmark runs")
+        ("verbose", po::value<unsigned int>(&lvl)->default_value(Logging::INFO), "logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("TrackingVolumeLookup", Logging::Level(lvl)));
+
+  auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+  auto world = makeDetector(nLayers, nDisks, nRings);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> xy(-rMax, rMax);
+  std::uniform_real_distribution<double> z(-barrelHalfZ - endcapLength,
+                                           barrelHalfZ + endcapLength);
+  std::vector<Vector3> positions;
+  positions.reserve(nPoints);
+  for (unsigned int i = 0; i < nPoints; ++i) {
+    positions.emplace_back(xy(rng), xy(rng), z(rng));
+  }
+
+  std::size_t iPosition = 0;
+  auto lookup = [&] {
+    const Vector3& position = positions[iPosition];
+    iPosition = (iPosition + 1) % positions.size();
+    return world->lowestTrackingVolume(gctx, position, s_onSurfaceTolerance);
+  };
+
+  ACTS_INFO("Looking up " << nPoints << " positions in "
+                          << 2 * nDisks * (nRings + 1) + nLayers + 2
+                          << " volumes");
+
+  // the child volumes are searched linearly until the tracking geometry is
+  // created
+  const auto linear = microBenchmark(lookup, nPoints, nRuns);
+  ACTS_INFO("Linear search: " << linear);
+
+  TrackingGeometry geometry(world);
+  const auto grid = microBenchmark(lookup, nPoints, nRuns);
+  ACTS_INFO("Search grid:   " << grid);
+
+  return 0;
+}
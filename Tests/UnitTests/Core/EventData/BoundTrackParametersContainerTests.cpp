@@ -0,0 +1,141 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/BoundTrackParametersContainer.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+BoundMatrix makeCovariance(double scale) {
+  BoundMatrix covariance = BoundMatrix::Zero();
+  for (std::size_t i = 0; i < eBoundSize; ++i) {
+    for (std::size_t j = 0; j < eBoundSize; ++j) {
+      covariance(i, j) = scale * (1 + i + j) + (i == j ? 10 : 0);
+    }
+  }
+  return covariance;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(EventDataSuite)
+
+BOOST_AUTO_TEST_CASE(BoundTrackParametersContainerCreate) {
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  BoundTrackParametersContainer container;
+  BOOST_CHECK(container.empty());
+
+  BoundVector parameters;
+  parameters << 1, 2, 0.3, 0.4, -0.5, 6;
+  auto params = container.createParameters(perigee, parameters, std::nullopt,
+                                           ParticleHypothesis::pion());
+  container.createParameters(perigee, 2 * parameters, makeCovariance(0.5),
+                             ParticleHypothesis::electron());
+
+  BOOST_CHECK_EQUAL(container.size(), 2u);
+  BOOST_CHECK_EQUAL(container.surfaces().size(), 1u);
+  BOOST_CHECK_EQUAL(params.parameters(), parameters);
+  BOOST_CHECK_EQUAL(params.parameter(eBoundQOverP), -0.5);
+  BOOST_CHECK(!params.hasCovariance());
+  BOOST_CHECK_EQUAL(&params.referenceSurface(), perigee.get());
+  BOOST_CHECK_EQUAL(params.particleHypothesis(), ParticleHypothesis::pion());
+
+  const auto other = container.at(1);
+  BOOST_REQUIRE(other.hasCovariance());
+  BOOST_CHECK_EQUAL(*other.covariance(), makeCovariance(0.5));
+  BOOST_CHECK_EQUAL(other.particleHypothesis(),
+                    ParticleHypothesis::electron());
+
+  // the components are stored in contiguous columns
+  auto qOverP = container.parameterColumn(eBoundQOverP);
+  BOOST_CHECK_EQUAL(qOverP.size(), 2u);
+  BOOST_CHECK_EQUAL(qOverP[1], -1.);
+  for (double &value : qOverP) {
+    value *= -1;
+  }
+  BOOST_CHECK_EQUAL(params.parameter(eBoundQOverP), 0.5);
+
+  params.setCovariance(makeCovariance(2));
+  BOOST_CHECK_EQUAL(*params.covariance(), makeCovariance(2));
+  params.setCovariance(std::nullopt);
+  BOOST_CHECK(!params.hasCovariance());
+
+  auto shifted = Surface::makeShared<PerigeeSurface>(Vector3::UnitZ());
+  params.setReferenceSurface(shifted);
+  BOOST_CHECK_EQUAL(container.surfaces().size(), 2u);
+  BOOST_CHECK_EQUAL(params.surfaceIndex(), 1u);
+  BOOST_CHECK_EQUAL(&params.referenceSurface(), shifted.get());
+
+  BOOST_CHECK_THROW(container.at(2), std::out_of_range);
+  BOOST_CHECK_THROW(container.createParameters(nullptr, parameters,
+                                               std::nullopt,
+                                               ParticleHypothesis::pion()),
+                    std::invalid_argument);
+
+  container.clear();
+  BOOST_CHECK(container.empty());
+  BOOST_CHECK(container.surfaces().empty());
+}
+
+BOOST_AUTO_TEST_CASE(BoundTrackParametersContainerConversion) {
+  auto perigee1 = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  auto perigee2 = Surface::makeShared<PerigeeSurface>(Vector3::UnitX());
+
+  std::vector<BoundTrackParameters> input;
+  for (std::size_t i = 0; i < 10; ++i) {
+    BoundVector parameters;
+    parameters << 0.1 * i, -0.2 * i, 0.1, 1.2, 1. / (1 + i), i;
+    std::optional<BoundMatrix> covariance;
+    if (i % 2 == 0) {
+      covariance = makeCovariance(0.1 * i);
+    }
+    input.emplace_back(i < 5 ? perigee1 : perigee2, parameters, covariance,
+                       ParticleHypothesis::muon());
+  }
+
+  const BoundTrackParametersContainer container(input);
+  BOOST_CHECK_EQUAL(container.size(), input.size());
+  BOOST_CHECK_EQUAL(container.surfaces().size(), 2u);
+
+  const std::vector<BoundTrackParameters> output =
+      container.toBoundTrackParameters();
+  BOOST_REQUIRE_EQUAL(output.size(), input.size());
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    BOOST_CHECK(output[i] == input[i]);
+    BOOST_CHECK_EQUAL(&output[i].referenceSurface(),
+                      &input[i].referenceSurface());
+  }
+
+  // iterate with const proxies
+  double sum = 0;
+  for (const auto params : container) {
+    sum += params.parameter(eBoundTime);
+  }
+  BOOST_CHECK_EQUAL(sum, 45.);
+  const auto time = container.parameterColumn(eBoundTime);
+  BOOST_CHECK_EQUAL(std::accumulate(time.begin(), time.end(), 0.), 45.);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -0,0 +1,189 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/CompactTrackContainer.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestTrackState.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+
+#include <random>
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+
+namespace {
+
+using TestTrackContainer =
+    TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                   std::shared_ptr>;
+
+// fixed seed for reproducible tests
+std::default_random_engine rng(31415);
+
+constexpr float kTolerance = 1e-6;
+
+TestTrackContainer makeTracks() {
+  TestTrackContainer tracks{std::make_shared<VectorTrackContainer>(),
+                            std::make_shared<VectorMultiTrajectory>()};
+  for (std::size_t itrack = 0; itrack < 3; ++itrack) {
+    auto track = tracks.makeTrack();
+    TestTrackState pc(rng, 2u);
+    track.setReferenceSurface(pc.surface);
+    track.parameters() = pc.predicted.parameters();
+    track.covariance() = *pc.predicted.covariance();
+    track.nMeasurements() = 4;
+    track.nHoles() = 1;
+    track.chi2() = 3.5;
+    track.nDoF() = 5;
+
+    for (std::size_t istate = 0; istate < 5; ++istate) {
+      TestTrackState tsPc(rng, 1 + istate % 2);
+      auto ts = track.appendTrackState(TrackStatePropMask::All &
+                                       ~TrackStatePropMask::Smoothed);
+      fillTrackState<VectorMultiTrajectory>(
+          tsPc, TrackStatePropMask::All & ~TrackStatePropMask::Smoothed, ts);
+      ts.shareFrom(TrackStatePropMask::Filtered, TrackStatePropMask::Smoothed);
+      ts.typeFlags().setHasMeasurement();
+    }
+    track.linkForward();
+
+    // a discarded branch which is not reachable from the tip
+    auto branch = tracks.trackStateContainer().makeTrackState(
+        TrackStatePropMask::All, track.tipIndex());
+    fillTrackState<VectorMultiTrajectory>(TestTrackState(rng, 1u),
+                                          TrackStatePropMask::All, branch);
+  }
+  return tracks;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(EventDataSuite)
+
+BOOST_AUTO_TEST_CASE(CompactTrackContainerPacking) {
+  auto [par, cov] = generateBoundParametersCovariance(rng, {});
+
+  std::array<float, CompactTrackContainer::kPackedCovarianceSize> packed{};
+  detail::packSymmetric(cov, packed.data());
+  BOOST_CHECK_EQUAL(packed[0], static_cast<float>(cov(0, 0)));
+  BOOST_CHECK_EQUAL(packed[1], static_cast<float>(cov(0, 1)));
+  BOOST_CHECK_EQUAL(packed[6], static_cast<float>(cov(1, 1)));
+  BOOST_CHECK_EQUAL(packed.back(), static_cast<float>(cov(5, 5)));
+
+  BoundMatrix unpacked = detail::unpackSymmetric<eBoundSize>(packed.data());
+  BOOST_CHECK_EQUAL(unpacked, unpacked.transpose());
+  CHECK_CLOSE_OR_SMALL(unpacked, cov, kTolerance, kTolerance);
+}
+
+BOOST_AUTO_TEST_CASE(CompactTrackContainerAddTracks) {
+  auto tracks = makeTracks();
+
+  CompactTrackContainer compact;
+  compact.addTracks(tracks);
+
+  BOOST_CHECK_EQUAL(compact.size(), 3u);
+  // the discarded branches are not stored
+  BOOST_CHECK_EQUAL(compact.nTrackStates(), 15u);
+
+  for (const auto& track : tracks) {
+    const auto itrack = track.index();
+    BOOST_CHECK_EQUAL(compact.referenceSurface(itrack),
+                      &track.referenceSurface());
+    CHECK_CLOSE_OR_SMALL(compact.parameters(itrack), track.parameters(),
+                         kTolerance, kTolerance);
+    CHECK_CLOSE_OR_SMALL(compact.covariance(itrack), track.covariance(),
+                         kTolerance, kTolerance);
+    BOOST_CHECK_EQUAL(compact.nMeasurements(itrack), 4u);
+    BOOST_CHECK_EQUAL(compact.nHoles(itrack), 1u);
+    BOOST_CHECK_EQUAL(compact.chi2(itrack), 3.5f);
+    BOOST_CHECK_EQUAL(compact.nDoF(itrack), 5u);
+
+    auto [begin, end] = compact.trackStateRange(itrack);
+    BOOST_CHECK_EQUAL(end - begin, 5u);
+    auto istate = begin;
+    for (const auto& ts : track.trackStates()) {
+      BOOST_CHECK(compact.trackStateMask(istate) ==
+                  (ts.getMask() & ~TrackStatePropMask::Jacobian));
+      CHECK_CLOSE_OR_SMALL(
+          compact.trackStateParameters(istate, TrackStatePropMask::Predicted),
+          ts.predicted(), kTolerance, kTolerance);
+      CHECK_CLOSE_OR_SMALL(
+          compact.trackStateCovariance(istate, TrackStatePropMask::Filtered),
+          ts.filteredCovariance(), kTolerance, kTolerance);
+      BOOST_CHECK_EQUAL(compact.calibratedSize(istate), ts.calibratedSize());
+      BOOST_CHECK_EQUAL(compact.calibrated(istate)[0],
+                        static_cast<float>(ts.effectiveCalibrated()[0]));
+      BOOST_CHECK(compact.projectorSubspaceIndices(istate) ==
+                  ts.projectorSubspaceIndices());
+      BOOST_CHECK(compact.uncalibratedSourceLink(istate).has_value());
+      BOOST_CHECK_EQUAL(compact.trackStateReferenceSurface(istate),
+                        &ts.referenceSurface());
+      BOOST_CHECK(compact.typeFlags(istate).hasMeasurement());
+      ++istate;
+    }
+  }
+
+  double vmtjBytes = 0;
+  for (double bytes : tracks.trackStateContainer().statistics().hist) {
+    vmtjBytes += bytes;
+  }
+  BOOST_CHECK_LT(compact.memoryUsage(), vmtjBytes / 2);
+}
+
+BOOST_AUTO_TEST_CASE(CompactTrackContainerCopyTo) {
+  auto tracks = makeTracks();
+
+  CompactTrackContainer compact(TrackStatePropMask::All);
+  compact.addTracks(tracks);
+
+  TestTrackContainer expanded{std::make_shared<VectorTrackContainer>(),
+                              std::make_shared<VectorMultiTrajectory>()};
+  compact.copyTo(expanded);
+
+  BOOST_CHECK_EQUAL(expanded.size(), tracks.size());
+  BOOST_CHECK_EQUAL(expanded.trackStateContainer().size(), 15u);
+
+  for (const auto& track : tracks) {
+    auto copy = expanded.getTrack(track.index());
+    BOOST_CHECK_EQUAL(copy.nTrackStates(), track.nTrackStates());
+    BOOST_CHECK_EQUAL(copy.stemIndex(), copy.innermostTrackState()->index());
+    CHECK_CLOSE_OR_SMALL(copy.parameters(), track.parameters(), kTolerance,
+                         kTolerance);
+
+    auto source = track.trackStates().begin();
+    for (const auto& ts : copy.trackStates()) {
+      const auto& orig = *source;
+      BOOST_CHECK(ts.getMask() == orig.getMask());
+      // the shared smoothed parameters remain shared
+      BOOST_CHECK_EQUAL(ts.smoothed().data(), ts.filtered().data());
+      CHECK_CLOSE_OR_SMALL(ts.predictedCovariance(), orig.predictedCovariance(),
+                           kTolerance, kTolerance);
+      CHECK_CLOSE_OR_SMALL(ts.jacobian(), orig.jacobian(), kTolerance,
+                           kTolerance);
+      CHECK_CLOSE_OR_SMALL(ts.effectiveCalibratedCovariance(),
+                           orig.effectiveCalibratedCovariance(), kTolerance,
+                           kTolerance);
+      BOOST_CHECK(ts.projectorSubspaceIndices() ==
+                  orig.projectorSubspaceIndices());
+      BOOST_CHECK_EQUAL(ts.chi2(), orig.chi2());
+      BOOST_CHECK_EQUAL(ts.pathLength(), static_cast<float>(orig.pathLength()));
+      BOOST_CHECK_EQUAL(&ts.referenceSurface(), &orig.referenceSurface());
+      ++source;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -0,0 +1,301 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/FlatTrackContainer.hpp"
+#include "Acts/EventData/ProxyAccessor.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestTrackState.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/CurvilinearSurface.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+using namespace Acts::HashedStringLiteral;
+
+namespace {
+
+using TestTrackContainer =
+    TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                   std::shared_ptr>;
+
+// fixed seed for reproducible tests
+std::default_random_engine rng(31415);
+
+const GeometryContext gctx = GeometryContext::dangerouslyDefaultConstruct();
+
+struct TemporaryFile {
+  std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "FlatTrackContainerTests.bin";
+  ~TemporaryFile() { std::filesystem::remove(path); }
+};
+
+TestTrackContainer makeTracks(const std::vector<const Surface*>& surfaces) {
+  TestTrackContainer tracks{std::make_shared<VectorTrackContainer>(),
+                            std::make_shared<VectorMultiTrajectory>()};
+  tracks.addColumn<std::uint32_t>("counter");
+  tracks.trackStateContainer().addColumn<float>("weight");
+  tracks.trackStateContainer().addColumn<bool>("selected");
+
+  for (std::size_t itrack = 0; itrack < 3; ++itrack) {
+    auto track = tracks.makeTrack();
+    TestTrackState pc(rng, 2u);
+    track.setReferenceSurface(Surface::makeShared<PerigeeSurface>(
+        Vector3{0., 0., static_cast<double>(itrack)}));
+    track.parameters() = pc.predicted.parameters();
+    track.covariance() = *pc.predicted.covariance();
+    track.particleHypothesis() = ParticleHypothesis::electron();
+    track.nMeasurements() = 4;
+    track.nHoles() = 1;
+    track.chi2() = 3.5;
+    track.nDoF() = 5;
+    track.template component<std::uint32_t>("counter") = 10 + itrack;
+
+    for (std::size_t istate = 0; istate < surfaces.size(); ++istate) {
+      TestTrackState tsPc(rng, 1 + istate % 2);
+      auto ts = track.appendTrackState(TrackStatePropMask::All &
+                                       ~TrackStatePropMask::Smoothed);
+      fillTrackState<VectorMultiTrajectory>(
+          tsPc, TrackStatePropMask::All & ~TrackStatePropMask::Smoothed, ts);
+      ts.shareFrom(TrackStatePropMask::Filtered, TrackStatePropMask::Smoothed);
+      ts.setReferenceSurface(surfaces[istate]->getSharedPtr());
+      ts.template component<float>("weight") = 0.5f * istate;
+      ts.template component<bool>("selected") = istate % 2 == 0;
+    }
+    track.linkForward();
+  }
+  return tracks;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(EventDataSuite)
+
+BOOST_AUTO_TEST_CASE(FlatTrackContainerRoundTrip) {
+  CubicTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+  std::vector<const Surface*> surfaces;
+  geometry->visitSurfaces(
+      [&](const Surface* surface) { surfaces.push_back(surface); });
+  BOOST_REQUIRE_GE(surfaces.size(), 4u);
+  surfaces.resize(4);
+
+  auto tracks = makeTracks(surfaces);
+
+  TemporaryFile file;
+  {
+    std::ofstream os(file.path, std::ios::binary);
+    // source links cannot be stored and are only dropped on request
+    BOOST_CHECK_THROW(writeFlatTrackContainer(os, gctx, tracks),
+                      std::invalid_argument);
+    writeFlatTrackContainer(os, gctx, tracks, true);
+  }
+
+  auto mapped = mapFlatTrackContainer(file.path, geometry.get());
+  BOOST_CHECK_EQUAL(mapped.size(), tracks.size());
+  BOOST_CHECK_EQUAL(mapped.trackStateContainer().size(),
+                    tracks.trackStateContainer().size());
+  BOOST_CHECK(mapped.hasColumn("counter"_hash));
+  BOOST_CHECK(mapped.trackStateContainer().hasColumn("weight"_hash));
+
+  ConstProxyAccessor<std::uint32_t> counter("counter");
+  ConstProxyAccessor<float> weight("weight");
+  ConstProxyAccessor<bool> selected("selected");
+
+  for (const auto& track : tracks) {
+    auto copy = mapped.getTrack(track.index());
+    BOOST_CHECK_EQUAL(copy.tipIndex(), track.tipIndex());
+    BOOST_CHECK_EQUAL(copy.stemIndex(), track.stemIndex());
+    BOOST_CHECK_EQUAL(copy.parameters(), track.parameters());
+    BOOST_CHECK_EQUAL(copy.covariance(), track.covariance());
+    BOOST_CHECK_EQUAL(copy.particleHypothesis(), track.particleHypothesis());
+    BOOST_CHECK_EQUAL(copy.nMeasurements(), 4u);
+    BOOST_CHECK_EQUAL(copy.nHoles(), 1u);
+    BOOST_CHECK_EQUAL(copy.chi2(), 3.5f);
+    BOOST_CHECK_EQUAL(copy.nDoF(), 5u);
+    BOOST_CHECK_EQUAL(counter(copy), counter(track));
+
+    // free perigee surfaces are recreated from their position
+    BOOST_REQUIRE(copy.hasReferenceSurface());
+    BOOST_CHECK_EQUAL(copy.referenceSurface().type(), Surface::Perigee);
+    BOOST_CHECK_EQUAL(copy.referenceSurface().center(gctx),
+                      track.referenceSurface().center(gctx));
+
+    BOOST_CHECK_EQUAL(copy.nTrackStates(), track.nTrackStates());
+    auto source = track.trackStates().begin();
+    for (const auto& ts : copy.trackStates()) {
+      const auto& orig = *source;
+      BOOST_CHECK(ts.getMask() == orig.getMask());
+      BOOST_CHECK_EQUAL(ts.predicted(), orig.predicted());
+      BOOST_CHECK_EQUAL(ts.filteredCovariance(), orig.filteredCovariance());
+      // the shared smoothed parameters remain shared
+      BOOST_CHECK_EQUAL(ts.smoothed().data(), ts.filtered().data());
+      BOOST_CHECK_EQUAL(ts.jacobian(), orig.jacobian());
+      BOOST_CHECK_EQUAL(ts.calibratedSize(), orig.calibratedSize());
+      BOOST_CHECK_EQUAL(ts.effectiveCalibrated(), orig.effectiveCalibrated());
+      BOOST_CHECK_EQUAL(ts.effectiveCalibratedCovariance(),
+                        orig.effectiveCalibratedCovariance());
+      BOOST_CHECK(ts.projectorSubspaceIndices() ==
+                  orig.projectorSubspaceIndices());
+      BOOST_CHECK_EQUAL(ts.chi2(), orig.chi2());
+      BOOST_CHECK_EQUAL(ts.pathLength(), orig.pathLength());
+      BOOST_CHECK_EQUAL(ts.typeFlags().raw(), orig.typeFlags().raw());
+      BOOST_CHECK(!ts.hasUncalibratedSourceLink());
+      // geometry surfaces are resolved from the tracking geometry
+      BOOST_CHECK_EQUAL(&ts.referenceSurface(), &orig.referenceSurface());
+      BOOST_CHECK_EQUAL(weight(ts), weight(orig));
+      BOOST_CHECK_EQUAL(selected(ts), selected(orig));
+      ++source;
+    }
+  }
+
+  // the mapped tracks can be copied into a mutable container
+  TestTrackContainer copies{std::make_shared<VectorTrackContainer>(),
+                            std::make_shared<VectorMultiTrajectory>()};
+  copies.addColumn<std::uint32_t>("counter");
+  copies.trackStateContainer().addColumn<float>("weight");
+  copies.trackStateContainer().addColumn<bool>("selected");
+  for (const auto& track : mapped) {
+    auto copy = copies.makeTrack();
+    copy.copyFrom(track);
+    BOOST_CHECK_EQUAL(counter(copy), counter(track));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FlatTrackContainerInvalid) {
+  TestTrackContainer tracks{std::make_shared<VectorTrackContainer>(),
+                            std::make_shared<VectorMultiTrajectory>()};
+  auto track = tracks.makeTrack();
+  track.setReferenceSurface(
+      CurvilinearSurface(Vector3::Zero(), Vector3::UnitX()).planeSurface());
+
+  TemporaryFile file;
+  {
+    std::ofstream os(file.path, std::ios::binary);
+    // free surfaces other than perigee surfaces cannot be stored
+    BOOST_CHECK_THROW(writeFlatTrackContainer(os, gctx, tracks),
+                      std::invalid_argument);
+    os << "not a track container";
+  }
+  BOOST_CHECK_THROW(mapFlatTrackContainer(file.path), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(FlatTrackContainerCorrupted) {
+  using detail::FlatColumnHeader;
+  using detail::FlatFileHeader;
+
+  CubicTrackingGeometry cGeometry(gctx);
+  auto geometry = cGeometry();
+  std::vector<const Surface*> surfaces;
+  geometry->visitSurfaces(
+      [&](const Surface* surface) { surfaces.push_back(surface); });
+  surfaces.resize(2);
+  auto tracks = makeTracks(surfaces);
+
+  TemporaryFile file;
+  std::string content;
+  {
+    std::ostringstream os;
+    writeFlatTrackContainer(os, gctx, tracks, true);
+    content = os.str();
+  }
+
+  FlatFileHeader header;
+  std::memcpy(&header, content.data(), sizeof(header));
+  auto findColumn = [&](FlatColumnHeader::Scope scope, std::string_view name) {
+    for (std::size_t i = 0; i < header.nColumns; ++i) {
+      std::size_t position = sizeof(header) + i * sizeof(FlatColumnHeader);
+      FlatColumnHeader column;
+      std::memcpy(&column, content.data() + position, sizeof(column));
+      if (column.scope == scope && column.key == hashStringDynamic(name)) {
+        return std::pair{position, column};
+      }
+    }
+    throw std::runtime_error("Column not found");
+  };
+  auto check = [&](const std::string& corrupted) {
+    {
+      std::ofstream os(file.path, std::ios::binary);
+      os << corrupted;
+    }
+    BOOST_CHECK_THROW(mapFlatTrackContainer(file.path, geometry.get()),
+                      std::runtime_error);
+  };
+
+  // a track state column shorter than the number of track states
+  {
+    auto [position, column] =
+        findColumn(FlatColumnHeader::Scope::TrackStates, "previous");
+    column.count -= 1;
+    std::string corrupted = content;
+    std::memcpy(corrupted.data() + position, &column, sizeof(column));
+    check(corrupted);
+  }
+
+  // a track pointing beyond the track states
+  {
+    auto [position, column] =
+        findColumn(FlatColumnHeader::Scope::Tracks, "tipIndex");
+    auto tipIndex = static_cast<TrackIndexType>(header.nTrackStates);
+    std::string corrupted = content;
+    std::memcpy(corrupted.data() + column.offset, &tipIndex,
+                sizeof(tipIndex));
+    check(corrupted);
+  }
+
+  // parameters beyond the parameter pool
+  {
+    auto [position, column] =
+        findColumn(FlatColumnHeader::Scope::TrackStates, "params");
+    column.count = 0;
+    std::string corrupted = content;
+    std::memcpy(corrupted.data() + position, &column, sizeof(column));
+    check(corrupted);
+  }
+
+  // a dynamic column whose type does not match its element size
+  {
+    auto [position, column] =
+        findColumn(FlatColumnHeader::Scope::DynamicTrackStates, "weight");
+    column.type = FlatColumnType::Double;
+    std::string corrupted = content;
+    std::memcpy(corrupted.data() + position, &column, sizeof(column));
+    check(corrupted);
+  }
+
+  // a dynamic column whose element size does not match its type
+  {
+    auto [position, column] =
+        findColumn(FlatColumnHeader::Scope::DynamicTracks, "counter");
+    column.elementSize = 1;
+    std::string corrupted = content;
+    std::memcpy(corrupted.data() + position, &column, sizeof(column));
+    check(corrupted);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -18,8 +18,18 @@
 #include "Acts/EventData/detail/MultiTrajectoryTestsCommon.hpp"
 #include "Acts/EventData/detail/TestTrackState.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
-
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/CurvilinearSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
 #include <random>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -245,6 +255,120 @@ BOOST_AUTO_TEST_CASE(MemoryStats) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(MemoryResource) {
+  std::array<std::byte, 64 * 1024> buffer{};
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource());
+
+  VectorMultiTrajectory mt(&arena);
+  BOOST_CHECK_EQUAL(mt.memoryResource(), &arena);
+  mt.addColumn<double>("extra");
+
+  // any allocation bypassing the arena would fail now
+  auto* defaultResource =
+      std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  {
+    TestTrackState pc(rng, 2u);
+    for (std::size_t i = 0; i < 10; ++i) {
+      auto ts = mt.makeTrackState();
+      fillTrackState<VectorMultiTrajectory>(pc, TrackStatePropMask::All, ts);
+      ts.component<double>("extra"_hash) = static_cast<double>(i);
+    }
+  }
+  std::pmr::set_default_resource(defaultResource);
+
+  BOOST_CHECK_EQUAL(mt.size(), 10u);
+  BOOST_CHECK_EQUAL(mt.getTrackState(4).component<double>("extra"_hash),
+                    4.);
+
+  // copies use the default resource unless specified otherwise
+  VectorMultiTrajectory copy(mt);
+  BOOST_CHECK_EQUAL(copy.memoryResource(), std::pmr::get_default_resource());
+  BOOST_CHECK_EQUAL(copy.size(), mt.size());
+  BOOST_CHECK_EQUAL(copy.getTrackState(3).calibrated<2>(),
+                    mt.getTrackState(3).calibrated<2>());
+  BOOST_CHECK_EQUAL(
+      copy.getTrackState(3).component<double>("extra"_hash), 3.);
+
+  ConstVectorMultiTrajectory cmt(std::move(mt));
+  BOOST_CHECK_EQUAL(cmt.memoryResource(), &arena);
+  BOOST_CHECK_EQUAL(cmt.size(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(NonOwningReferenceSurfaces) {
+  CubicTrackingGeometry cubic(gctx);
+  auto geometry = cubic();
+  auto geometrySurface =
+      geometry->geoIdSurfaceMap().begin()->second->getSharedPtr();
+  const auto geometryUseCount = geometrySurface.use_count();
+  // a surface with the identifier of a geometry surface is not owned by it
+  auto impostorSurface =
+      CurvilinearSurface(Vector3::Zero(), Vector3::UnitX()).planeSurface();
+  impostorSurface->assignGeometryId(geometrySurface->geometryId());
+  auto freeSurface =
+      CurvilinearSurface(Vector3::Zero(), Vector3::UnitY()).planeSurface();
+
+  VectorMultiTrajectory mt;
+  BOOST_CHECK(mt.referenceSurfaceStorage() == ReferenceSurfaceStorage::Shared);
+  BOOST_CHECK_THROW(
+      mt.setReferenceSurfaceStorage(ReferenceSurfaceStorage::NonOwningGeometry),
+      std::invalid_argument);
+  mt.setReferenceSurfaceStorage(ReferenceSurfaceStorage::NonOwningGeometry,
+                                geometry);
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    auto ts = mt.makeTrackState(TrackStatePropMask::Predicted);
+    ts.setReferenceSurface(i % 2 == 0 ? geometrySurface : freeSurface);
+  }
+  mt.makeTrackState(TrackStatePropMask::Predicted)
+      .setReferenceSurface(impostorSurface);
+
+  // only the surfaces outside of the geometry are owned by the container
+  BOOST_CHECK_EQUAL(geometrySurface.use_count(), geometryUseCount);
+  BOOST_CHECK_EQUAL(freeSurface.use_count(), 6);
+  BOOST_CHECK_EQUAL(impostorSurface.use_count(), 2);
+  BOOST_CHECK_EQUAL(&mt.getTrackState(0).referenceSurface(),
+                    geometrySurface.get());
+  BOOST_CHECK_EQUAL(&mt.getTrackState(1).referenceSurface(),
+                    freeSurface.get());
+  BOOST_CHECK_THROW(
+      mt.setReferenceSurfaceStorage(ReferenceSurfaceStorage::Shared),
+      std::logic_error);
+
+  VectorMultiTrajectory copy(mt);
+  BOOST_CHECK(copy.referenceSurfaceStorage() ==
+              ReferenceSurfaceStorage::NonOwningGeometry);
+  BOOST_CHECK_EQUAL(geometrySurface.use_count(), geometryUseCount);
+  BOOST_CHECK_EQUAL(&copy.getTrackState(4).referenceSurface(),
+                    geometrySurface.get());
+
+  // copied track states are stored the way the destination stores them
+  VectorMultiTrajectory sameGeometry;
+  sameGeometry.setReferenceSurfaceStorage(
+      ReferenceSurfaceStorage::NonOwningGeometry, geometry);
+  VectorMultiTrajectory shared;
+  for (auto* dst : {&sameGeometry, &shared}) {
+    dst->makeTrackState(TrackStatePropMask::Predicted)
+        .copyFrom(mt.getTrackState(0), TrackStatePropMask::Predicted);
+  }
+  BOOST_CHECK_EQUAL(geometrySurface.use_count(), geometryUseCount + 1);
+  BOOST_CHECK_EQUAL(&sameGeometry.getTrackState(0).referenceSurface(),
+                    geometrySurface.get());
+  BOOST_CHECK_EQUAL(&shared.getTrackState(0).referenceSurface(),
+                    geometrySurface.get());
+  shared.clear();
+
+  // the containers keep the geometry alive
+  std::weak_ptr<const TrackingGeometry> weakGeometry = geometry;
+  geometry.reset();
+  BOOST_CHECK(!weakGeometry.expired());
+
+  mt.clear();
+  copy.clear();
+  BOOST_CHECK_EQUAL(freeSurface.use_count(), 1);
+  BOOST_CHECK_EQUAL(impostorSurface.use_count(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(Accessors) {
   VectorMultiTrajectory mtj;
   mtj.addColumn<unsigned int>("ndof");
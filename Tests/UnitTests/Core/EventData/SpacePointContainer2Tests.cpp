@@ -13,7 +13,12 @@
 #include "Acts/EventData/SpacePointContainer2.hpp"
 #include "Acts/EventData/Types.hpp"
 
+#include <cmath>
+#include <cstddef>
+#include <memory_resource>
+#include <numbers>
 #include <stdexcept>
+#include <vector>
 
 #include <boost/core/no_exceptions_support.hpp>
 
@@ -21,6 +26,30 @@ using namespace Acts;
 
 namespace ActsTests {
 
+namespace {
+
+/// Memory resource that counts the allocations it serves
+class CountingMemoryResource final : public std::pmr::memory_resource {
+ public:
+  std::size_t nAllocations = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++nAllocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept
+      override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(EventDataSuite)
 
 BOOST_AUTO_TEST_CASE(Empty) {
@@ -61,6 +90,42 @@ BOOST_AUTO_TEST_CASE(Create) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(MemoryResource) {
+  CountingMemoryResource resource;
+
+  SpacePointContainer2 container(
+      SpacePointColumns::SourceLinks | SpacePointColumns::X, &resource);
+  BOOST_CHECK_EQUAL(container.memoryResource(), &resource);
+  container.createColumn<int>("extra");
+
+  for (int i = 0; i < 10; ++i) {
+    MutableSpacePointProxy2 sp = container.createSpacePoint();
+    sp.assignSourceLinks(std::array<SourceLink, 1>{SourceLink(i)});
+    sp.x() = static_cast<float>(i);
+  }
+  BOOST_CHECK_GT(resource.nAllocations, 0u);
+
+  // copies use the default resource unless specified otherwise
+  std::size_t nAllocations = resource.nAllocations;
+  SpacePointContainer2 copy(container);
+  BOOST_CHECK_EQUAL(copy.memoryResource(), std::pmr::get_default_resource());
+  BOOST_CHECK_EQUAL(resource.nAllocations, nAllocations);
+
+  SpacePointContainer2 arenaCopy(copy, &resource);
+  BOOST_CHECK_GT(resource.nAllocations, nAllocations);
+  BOOST_CHECK_EQUAL(arenaCopy.size(), 10u);
+  BOOST_CHECK_EQUAL(arenaCopy.at(3).x(), 3);
+  BOOST_CHECK_EQUAL(arenaCopy.column<int>("extra").size(), 10u);
+
+  // moving across memory resources copies the content
+  SpacePointContainer2 moved;
+  moved = std::move(container);
+  BOOST_CHECK_EQUAL(moved.memoryResource(), std::pmr::get_default_resource());
+  BOOST_CHECK_EQUAL(moved.size(), 10u);
+  BOOST_CHECK_EQUAL(moved.at(7).x(), 7);
+  BOOST_CHECK_EQUAL(moved.at(7).sourceLinks()[0].get<int>(), 7);
+}
+
 BOOST_AUTO_TEST_CASE(Iterate) {
   SpacePointContainer2 container(SpacePointColumns::SourceLinks |
                                  SpacePointColumns::X | SpacePointColumns::Y |
@@ -280,6 +345,129 @@ BOOST_AUTO_TEST_CASE(CopyFrom) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(BulkCreateAndExport) {
+  SpacePointContainer2 container(
+      SpacePointColumns::SourceLinks | SpacePointColumns::X |
+      SpacePointColumns::Y | SpacePointColumns::Z | SpacePointColumns::R |
+      SpacePointColumns::Phi | SpacePointColumns::VarianceZ |
+      SpacePointColumns::PackedXYZR | SpacePointColumns::PackedVarianceZR);
+
+  // a single space point created beforehand is kept intact
+  container.createSpacePoint().assignSourceLinks(
+      std::array<SourceLink, 1>{SourceLink(0)});
+
+  const std::vector<float> x = {1, 0, -3};
+  const std::vector<float> y = {0, 2, -4};
+  const std::vector<float> z = {5, 6, 7};
+  const std::vector<float> varianceZ = {0.1f, 0.2f, 0.3f};
+  const std::vector<float> varianceR = {0.4f, 0.5f, 0.6f};
+  const std::vector<SourceLink> sourceLinks = {SourceLink(1), SourceLink(2),
+                                               SourceLink(3), SourceLink(4)};
+  const std::vector<std::uint8_t> sourceLinkCounts = {1, 2, 1};
+
+  const auto range = container.createSpacePoints(
+      3, {.x = x,
+          .y = y,
+          .z = z,
+          .varianceZ = varianceZ,
+          .varianceR = varianceR,
+          .sourceLinks = sourceLinks,
+          .sourceLinkCounts = sourceLinkCounts});
+
+  BOOST_CHECK_EQUAL(range.first, 1u);
+  BOOST_CHECK_EQUAL(range.second, 4u);
+  BOOST_CHECK_EQUAL(container.size(), 4u);
+  BOOST_CHECK_EQUAL(container[0].sourceLinks()[0].get<int>(), 0);
+
+  const auto sp = container[2];
+  BOOST_CHECK_EQUAL(sp.x(), 0);
+  BOOST_CHECK_EQUAL(sp.y(), 2);
+  BOOST_CHECK_EQUAL(sp.z(), 6);
+  BOOST_CHECK_CLOSE(sp.r(), 2, 1e-4);
+  BOOST_CHECK_CLOSE(sp.phi(), std::numbers::pi_v<float> / 2, 1e-4);
+  BOOST_CHECK_EQUAL(sp.varianceZ(), 0.2f);
+  BOOST_CHECK_CLOSE(container[3].r(), 5, 1e-4);
+  BOOST_CHECK_CLOSE(container[3].xyzr()[3], 5, 1e-4);
+  BOOST_CHECK_EQUAL(container[3].xyzr()[2], 7);
+  BOOST_CHECK_EQUAL(container[1].varianceZR()[1], 0.4f);
+  BOOST_REQUIRE_EQUAL(sp.sourceLinks().size(), 2u);
+  BOOST_CHECK_EQUAL(sp.sourceLinks()[0].get<int>(), 2);
+  BOOST_CHECK_EQUAL(sp.sourceLinks()[1].get<int>(), 3);
+
+  std::vector<float> r(3);
+  std::vector<float> zOut(3);
+  std::vector<SourceLink> sourceLinksOut(5, SourceLink(-1));
+  std::vector<std::uint8_t> sourceLinkCountsOut(3);
+  const std::size_t nSourceLinks = container.exportSpacePoints(
+      range, {.z = zOut,
+              .r = r,
+              .sourceLinks = sourceLinksOut,
+              .sourceLinkCounts = sourceLinkCountsOut});
+
+  BOOST_CHECK_EQUAL(nSourceLinks, 4u);
+  BOOST_CHECK(zOut == z);
+  BOOST_CHECK_CLOSE(r[2], 5, 1e-4);
+  BOOST_CHECK(sourceLinkCountsOut == sourceLinkCounts);
+  for (std::size_t i = 0; i < nSourceLinks; ++i) {
+    BOOST_CHECK_EQUAL(sourceLinksOut[i].get<int>(), i + 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BulkCreatePhi) {
+  SpacePointContainer2 container(SpacePointColumns::X | SpacePointColumns::Y |
+                                 SpacePointColumns::Phi);
+
+  // all octants, plus the diagonals and axes including signed zeros
+  std::vector<float> x;
+  std::vector<float> y;
+  for (int i = 0; i < 64; ++i) {
+    const float angle = -std::numbers::pi_v<float> + i * 0.1f;
+    x.push_back(3 * std::cos(angle));
+    y.push_back(3 * std::sin(angle));
+  }
+  for (float value : {-2.f, 0.f, 2.f}) {
+    for (float other : {-1.f, 0.f, 1.f}) {
+      x.push_back(value * other);
+      y.push_back(value);
+    }
+  }
+  x.push_back(-1e-30f);
+  y.push_back(1e30f);
+
+  container.createSpacePoints(static_cast<std::uint32_t>(x.size()),
+                              {.x = x, .y = y});
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    BOOST_CHECK_SMALL(container[i].phi() - std::atan2(y[i], x[i]), 1e-6f);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BulkCreateInvalid) {
+  SpacePointContainer2 container(SpacePointColumns::X | SpacePointColumns::Y);
+
+  const std::vector<float> values = {1, 2};
+  const std::vector<SourceLink> sourceLinks = {SourceLink(1), SourceLink(2)};
+
+  BOOST_CHECK_THROW(container.createSpacePoints(3, {.x = values}),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(container.createSpacePoints(2, {.time = values}),
+                    std::logic_error);
+  BOOST_CHECK_THROW(
+      container.createSpacePoints(2, {.sourceLinks = sourceLinks}),
+      std::logic_error);
+  BOOST_CHECK_EQUAL(container.size(), 0u);
+
+  container.createSpacePoints(2, {.x = values});
+  BOOST_CHECK_EQUAL(container.size(), 2u);
+  BOOST_CHECK_EQUAL(container[1].y(), 0);
+
+  std::vector<float> output(2);
+  BOOST_CHECK_THROW(container.exportSpacePoints({0, 3}, {.x = output}),
+                    std::out_of_range);
+  BOOST_CHECK_THROW(container.exportSpacePoints({0, 2}, {.z = output}),
+                    std::logic_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -12,13 +12,18 @@
 #include "Acts/EventData/ProxyAccessor.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Utilities/Diagnostics.hpp"
 #include "Acts/Utilities/Zip.hpp"
+#include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
 
 #include <algorithm>
 #include <numeric>
+#include <stdexcept>
 
 using namespace Acts;
 using namespace Acts::HashedStringLiteral;
@@ -570,6 +575,57 @@ BOOST_AUTO_TEST_CASE(ProxyAccessorConstexprConstruction) {
                 "ProxyAccessor should be constructible at compile time");
 }
 
+BOOST_AUTO_TEST_CASE(ResolvedProxyAccessorAccess) {
+  VectorTrackContainer vtc{};
+  VectorMultiTrajectory mtj{};
+  TrackContainer tc{vtc, mtj};
+
+  tc.addColumn<std::uint32_t>("counter");
+  mtj.addColumn<float>("weight");
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    auto track = tc.makeTrack();
+    for (std::size_t j = 0; j < 4; ++j) {
+      track.appendTrackState(TrackStatePropMask::None);
+    }
+  }
+
+  // resolved after the containers are filled
+  ResolvedProxyAccessor<std::uint32_t> counter(vtc, "counter");
+  ResolvedProxyAccessor<float> weight(mtj, "weight"_hash);
+  BOOST_CHECK_EQUAL(counter.values.size(), 3u);
+  BOOST_CHECK_EQUAL(weight.values.size(), 12u);
+
+  for (auto track : tc) {
+    counter(track) = track.index() + 10;
+    for (auto ts : track.trackStatesReversed()) {
+      weight(ts) = 0.5f * ts.index();
+    }
+  }
+
+  ConstProxyAccessor<std::uint32_t> caccCounter("counter");
+  ConstProxyAccessor<float> caccWeight("weight");
+  const auto& cvtc = vtc;
+  ConstResolvedProxyAccessor<std::uint32_t> ccounter(cvtc, "counter");
+  ConstResolvedProxyAccessor<float> cweight(mtj, "weight");
+  for (const auto& track : tc) {
+    BOOST_CHECK_EQUAL(caccCounter(track), track.index() + 10);
+    BOOST_CHECK_EQUAL(ccounter(track), caccCounter(track));
+    for (const auto& ts : track.trackStatesReversed()) {
+      BOOST_CHECK_EQUAL(caccWeight(ts), 0.5f * ts.index());
+      BOOST_CHECK_EQUAL(&cweight(ts), &caccWeight(ts));
+    }
+  }
+
+  // does not compile
+  // ccounter(tc.getTrack(0)) = 5;
+
+  BOOST_CHECK_THROW(ResolvedProxyAccessor<float>(vtc, "missing"),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(ResolvedProxyAccessor<double>(mtj, "weight"),
+                    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(CopyFromWithoutStatesInvalidatesIndices) {
   VectorTrackContainer vtc{};
   VectorMultiTrajectory mtj{};
@@ -721,6 +777,59 @@ BOOST_AUTO_TEST_CASE(CopyFromDeepCopyFunctionality) {
   BOOST_CHECK_EQUAL(destTrack.nMeasurements(), 99);
 }
 
+BOOST_AUTO_TEST_CASE(NonOwningReferenceSurfaces) {
+  CubicTrackingGeometry cubic(GeometryContext::dangerouslyDefaultConstruct());
+  auto geometry = cubic();
+  auto geometrySurface =
+      geometry->geoIdSurfaceMap().begin()->second->getSharedPtr();
+  const auto geometryUseCount = geometrySurface.use_count();
+  auto impostorSurface =
+      CurvilinearSurface(Vector3::Zero(), Vector3::UnitX()).planeSurface();
+  impostorSurface->assignGeometryId(geometrySurface->geometryId());
+  auto freeSurface =
+      CurvilinearSurface(Vector3::Zero(), Vector3::UnitY()).planeSurface();
+
+  VectorTrackContainer vtc;
+  VectorMultiTrajectory mtj;
+  vtc.setReferenceSurfaceStorage(ReferenceSurfaceStorage::NonOwningGeometry,
+                                 geometry);
+  TrackContainer tc{vtc, mtj};
+
+  auto t1 = tc.makeTrack();
+  t1.setReferenceSurface(geometrySurface);
+  auto t2 = tc.makeTrack();
+  t2.setReferenceSurface(freeSurface);
+  auto t3 = tc.makeTrack();
+  t3.setReferenceSurface(impostorSurface);
+
+  BOOST_CHECK_EQUAL(geometrySurface.use_count(), geometryUseCount);
+  BOOST_CHECK_EQUAL(freeSurface.use_count(), 2);
+  BOOST_CHECK_EQUAL(impostorSurface.use_count(), 2);
+  BOOST_CHECK_EQUAL(&t1.referenceSurface(), geometrySurface.get());
+  BOOST_CHECK_EQUAL(&t2.referenceSurface(), freeSurface.get());
+  BOOST_CHECK_THROW(
+      vtc.setReferenceSurfaceStorage(ReferenceSurfaceStorage::Shared),
+      std::logic_error);
+
+  VectorTrackContainer copy(vtc);
+  BOOST_CHECK(copy.referenceSurfaceStorage() ==
+              ReferenceSurfaceStorage::NonOwningGeometry);
+  BOOST_CHECK_EQUAL(geometrySurface.use_count(), geometryUseCount);
+  BOOST_CHECK_EQUAL(freeSurface.use_count(), 3);
+
+  // the default keeps sharing the ownership of every surface
+  VectorTrackContainer shared;
+  BOOST_CHECK(shared.referenceSurfaceStorage() ==
+              ReferenceSurfaceStorage::Shared);
+  TrackContainer sharedTc{shared, mtj};
+  sharedTc.makeTrack().setReferenceSurface(geometrySurface);
+  BOOST_CHECK_EQUAL(geometrySurface.use_count(), geometryUseCount + 1);
+
+  // copying a track into a shared container takes ownership
+  sharedTc.makeTrack().copyFrom(t1);
+  BOOST_CHECK_EQUAL(geometrySurface.use_count(), geometryUseCount + 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
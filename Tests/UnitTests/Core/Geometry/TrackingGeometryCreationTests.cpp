@@ -10,10 +10,12 @@
 
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
 #include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
 
+#include <memory>
 #include <optional>
 
 using namespace Acts;
@@ -71,6 +73,27 @@ BOOST_AUTO_TEST_CASE(SurfaceLookupTracksNonSensitiveSurfaces) {
           << *nonSensitiveSurfaceId << " even when it is not sensitive");
 }
 
+BOOST_AUTO_TEST_CASE(SurfacesKnowTheirTrackingGeometry) {
+  CubicTrackingGeometry builder(tgContext);
+  auto geometry = builder();
+  BOOST_REQUIRE_NE(geometry, nullptr);
+
+  std::shared_ptr<const Surface> surface;
+  for (const auto& [id, s] : geometry->geoIdSurfaceMap()) {
+    BOOST_CHECK_EQUAL(s->trackingGeometry(), geometry.get());
+    surface = s->getSharedPtr();
+  }
+
+  // copies are not part of the geometry
+  auto copy = Surface::makeShared<PlaneSurface>(
+      dynamic_cast<const PlaneSurface&>(*surface));
+  BOOST_CHECK_EQUAL(copy->trackingGeometry(), nullptr);
+
+  // surfaces outliving the geometry are released from it
+  geometry.reset();
+  BOOST_CHECK_EQUAL(surface->trackingGeometry(), nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -9,9 +9,12 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
 #include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/Portal.hpp"
 #include "Acts/Geometry/PortalLinkBase.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingGeometryVisitor.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
@@ -19,6 +22,9 @@
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
+#include <random>
+#include <vector>
+
 #include "LayerStub.hpp"
 
 using namespace Acts;
@@ -66,6 +72,66 @@ BOOST_AUTO_TEST_CASE(TrackigVolumeChildren) {
   BOOST_CHECK_EQUAL(countVolumes(tv), 3);
 }
 
+BOOST_AUTO_TEST_CASE(LowestTrackingVolumeSearchGrid) {
+  auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+
+  auto world = std::make_shared<TrackingVolume>(
+      Transform3::Identity(),
+      std::make_shared<CylinderVolumeBounds>(0_mm, 1000_mm, 1000_mm), "world");
+
+  // barrel layers stacked in r
+  auto& barrel = world->addVolume(std::make_unique<TrackingVolume>(
+      Transform3::Identity(),
+      std::make_shared<CylinderVolumeBounds>(0_mm, 1000_mm, 500_mm), "barrel"));
+  for (int i = 0; i < 10; ++i) {
+    barrel.addVolume(std::make_unique<TrackingVolume>(
+        Transform3::Identity(),
+        std::make_shared<CylinderVolumeBounds>(i * 100_mm, (i + 1) * 100_mm,
+                                               500_mm)));
+  }
+
+  // endcap disks stacked in z, touching the barrel
+  for (int i = 0; i < 10; ++i) {
+    for (double sign : {-1., 1.}) {
+      world->addVolume(std::make_unique<TrackingVolume>(
+          Transform3(Translation3(0, 0, sign * (525_mm + i * 50_mm))),
+          std::make_shared<CylinderVolumeBounds>(0_mm, 1000_mm, 25_mm)));
+    }
+  }
+
+  // a box which overlaps with the barrel is found after the barrel
+  world->addVolume(std::make_unique<TrackingVolume>(
+      Transform3(Translation3(200_mm, 0, 0)),
+      std::make_shared<CuboidVolumeBounds>(50_mm, 50_mm, 50_mm), "box"));
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> xy(-1100_mm, 1100_mm);
+  std::uniform_real_distribution<double> z(-1100_mm, 1100_mm);
+  std::vector<Vector3> positions;
+  for (int i = 0; i < 10000; ++i) {
+    positions.emplace_back(xy(rng), xy(rng), z(rng));
+  }
+  // points on the volume boundaries
+  positions.emplace_back(100_mm, 0, 0);
+  positions.emplace_back(0, 300_mm, 500_mm);
+  positions.emplace_back(0, 0, -575_mm);
+  positions.emplace_back(1000_mm, 0, 1000_mm);
+
+  // before the tracking geometry is created, the volumes are searched linearly
+  std::vector<const TrackingVolume*> expected;
+  for (const Vector3& position : positions) {
+    expected.push_back(world->lowestTrackingVolume(gctx, position, 1e-4));
+  }
+
+  TrackingGeometry geometry(world);
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    BOOST_CHECK_EQUAL(world->lowestTrackingVolume(gctx, positions[i], 1e-4),
+                      expected[i]);
+  }
+  BOOST_CHECK_EQUAL(geometry.lowestTrackingVolume(gctx, Vector3(150_mm, 0, 0)),
+                    &*std::next(barrel.volumes().begin()));
+}
+
 namespace {
 void testVisitor(auto visitor) {
   BOOST_CHECK(!visitor.m_surfaceCalled);
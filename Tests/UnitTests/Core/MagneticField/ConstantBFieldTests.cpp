@@ -15,6 +15,8 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <array>
+
 namespace bdata = boost::unit_test::data;
 
 using namespace Acts;
@@ -119,6 +121,13 @@ BOOST_DATA_TEST_CASE(
   BOOST_CHECK_EQUAL(Btrue, BField.getField(pos, bCache).value());
   BOOST_CHECK_EQUAL(Btrue, BField.getField(Vector3(0, 0, 0), bCache).value());
   BOOST_CHECK_EQUAL(Btrue, BField.getField(-2 * pos, bCache).value());
+
+  const std::array<Vector3, 3> positions = {pos, Vector3(0, 0, 0), -2 * pos};
+  std::array<Vector3, 3> fields{};
+  BOOST_CHECK(BField.getFields(positions, fields, bCache).ok());
+  for (const Vector3& field : fields) {
+    BOOST_CHECK_EQUAL(Btrue, field);
+  }
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldError.hpp"
 #include "Acts/Utilities/Axis.hpp"
 #include "Acts/Utilities/AxisDefinitions.hpp"
 #include "Acts/Utilities/Grid.hpp"
@@ -19,9 +20,11 @@
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <optional>
 #include <utility>
+#include <vector>
 
 using Acts::VectorHelpers::perp;
 
@@ -162,6 +165,71 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(!c.isInside(transformPos((pos << 5, 2, 14.).finished())));
 }
 
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_equidistant_lookup) {
+  // a field which is not multilinear, so the interpolation is not exact
+  auto value = [](const std::array<double, 3>& xyz) {
+    return Vector3(std::sin(xyz[0]) * xyz[1], std::cos(xyz[2]),
+                   xyz[0] * xyz[1] * xyz[2] + std::exp(-xyz[1]));
+  };
+
+  Grid g(Type<Vector3>, Axis(-1.0, 2.0, 7u), Axis(0.0, 1.5, 5u),
+         Axis(-3.0, 3.0, 11u));
+  for (std::size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      for (std::size_t k = 1; k <= g.numLocalBins().at(2) + 1; ++k) {
+        decltype(g)::index_t indices = {{i, j, k}};
+        g.atLocalBins(indices) = value(g.lowerLeftBinEdge(indices));
+      }
+    }
+  }
+  const auto reference = g;
+
+  using BField_t = InterpolatedBFieldMap<decltype(g)>;
+  static_assert(BField_t::s_equidistant);
+  BField_t b{{[](const Vector3& pos) { return pos; },
+              [](const Vector3& field, const Vector3&) { return field; },
+              std::move(g)}};
+  auto bCache = b.makeCache(mfContext);
+
+  // positions spread over the map as well as positions on the bin edges, the
+  // lookup domain ends at the lower edge of the last bin
+  std::vector<Vector3> positions;
+  for (std::size_t i = 0; i < 50; ++i) {
+    positions.push_back(Vector3(-1.0 + 0.05 * i, 0.024 * i, 2.4 - 0.1 * i));
+  }
+  for (std::size_t i = 0; i < 6; ++i) {
+    positions.push_back(
+        Vector3(-1.0 + i * 3.0 / 7, 0.3 * (i % 4), -3.0 + i * 6.0 / 11));
+  }
+
+  std::vector<Vector3> fields(positions.size());
+  BOOST_CHECK(b.getFields(positions, fields, bCache).ok());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    BOOST_TEST_CONTEXT("position " << positions[i].transpose()) {
+      BOOST_REQUIRE(b.isInside(positions[i]));
+      const Vector3 expected = reference.interpolate(positions[i]);
+      CHECK_CLOSE_ABS(b.getField(positions[i]).value(), expected, 1e-12);
+      CHECK_CLOSE_ABS(b.getFieldUnchecked(positions[i]), expected, 1e-12);
+      CHECK_CLOSE_ABS(fields[i], expected, 1e-12);
+
+      // the cached cell contains the lookup position
+      auto cell = b.getFieldCell(positions[i]);
+      BOOST_REQUIRE(cell.ok());
+      BOOST_CHECK(cell->isInside(positions[i]));
+      CHECK_CLOSE_ABS(cell->getField(positions[i]), expected, 1e-12);
+      CHECK_CLOSE_ABS(b.getField(positions[i], bCache).value(), expected,
+                      1e-12);
+    }
+  }
+
+  // a single position outside of the map fails the whole batch
+  positions.push_back(Vector3(0, 2, 0));
+  fields.resize(positions.size());
+  auto res = b.getFields(positions, fields, bCache);
+  BOOST_CHECK(!res.ok());
+  BOOST_CHECK(res.error() == MagneticFieldError::OutOfBounds);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
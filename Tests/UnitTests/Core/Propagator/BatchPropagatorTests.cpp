@@ -0,0 +1,238 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldError.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/BatchPropagator.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Surfaces/CurvilinearSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace ActsTests {
+
+namespace {
+
+GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+/// Constant field which fails outside of |z| < 1 m
+class BoundedBField final : public MagneticFieldProvider {
+ public:
+  struct Cache {};
+
+  Result<Vector3> getField(const Vector3& position,
+                           MagneticFieldProvider::Cache& /*cache*/)
+      const override {
+    if (std::abs(position.z()) > 1_m) {
+      return Result<Vector3>::failure(MagneticFieldError::OutOfBounds);
+    }
+    return Result<Vector3>::success(Vector3(0, 0, 2_T));
+  }
+
+  MagneticFieldProvider::Cache makeCache(
+      const MagneticFieldContext& /*mctx*/) const override {
+    return MagneticFieldProvider::Cache(std::in_place_type<Cache>);
+  }
+};
+
+/// A set of tracks with different charges, momenta and directions, the
+/// number of tracks is not a multiple of the number of lanes
+std::vector<BoundTrackParameters> makeTracks(std::size_t n) {
+  std::vector<BoundTrackParameters> tracks;
+  for (std::size_t i = 0; i < n; ++i) {
+    const double phi = -0.4 + 0.1 * i;
+    const double theta = 1.2 + 0.05 * i;
+    const double q = i % 2 == 0 ? 1_e : -1_e;
+    const double p = 0.5_GeV + 0.25_GeV * i;
+    tracks.push_back(BoundTrackParameters::createCurvilinear(
+        Vector4(0, 1_mm * i, -1_mm * i, 0), phi, theta, q / p, std::nullopt,
+        ParticleHypothesis::pion()));
+  }
+  return tracks;
+}
+
+void checkParameters(const BoundTrackParameters& batch,
+                     const BoundTrackParameters& reference) {
+  // the lanes only differ from the scalar steppers by the order of the
+  // floating point operations, except for the time where the EigenStepper
+  // squares the mass in single precision
+  CHECK_CLOSE_ABS(batch.position(tgContext), reference.position(tgContext),
+                  1e-8);
+  CHECK_CLOSE_ABS(batch.direction(), reference.direction(), 1e-11);
+  CHECK_CLOSE_REL(batch.time(), reference.time(), 1e-8);
+  BOOST_CHECK_EQUAL(batch.qOverP(), reference.qOverP());
+  BOOST_CHECK(!batch.covariance().has_value());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PropagatorSuite)
+
+BOOST_AUTO_TEST_CASE(batch_propagator_path_limit_test) {
+  auto bField = std::make_shared<SolenoidBField>(SolenoidBField::Config{
+      .radius = 1.2_m, .length = 6_m, .nCoils = 1000, .bMagCenter = 2_T});
+  BatchPropagator<4> batchPropagator({bField});
+  Propagator<EigenStepper<>> propagator(EigenStepper<>{bField});
+
+  PropagatorPlainOptions options(tgContext, mfContext);
+  options.pathLimit = 2_m;
+  options.stepping.maxStepSize = 30_cm;
+  Propagator<EigenStepper<>>::Options<> referenceOptions(options);
+
+  const auto tracks = makeTracks(11);
+  const auto results = batchPropagator.propagate(tracks, options);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    BOOST_TEST_CONTEXT("track " << i) {
+      BOOST_REQUIRE(results[i].ok());
+      const auto reference =
+          propagator.propagate(tracks[i], referenceOptions).value();
+      checkParameters(results[i]->endParameters, *reference.endParameters);
+      CHECK_CLOSE_ABS(results[i]->pathLength, reference.pathLength, 1e-9);
+      BOOST_CHECK_EQUAL(results[i]->steps,
+                        reference.statistics.stepping.nSuccessfulSteps);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batch_propagator_target_test) {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0.1_T, 0, 2_T));
+  BatchPropagator<8> batchPropagator({bField});
+  Propagator<EigenStepper<>> propagator(EigenStepper<>{bField});
+
+  PropagatorPlainOptions options(tgContext, mfContext);
+  options.pathLimit = 5_m;
+  Propagator<EigenStepper<>>::Options<> referenceOptions(options);
+
+  const auto tracks = makeTracks(13);
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  std::vector<const Surface*> targets;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    // every third track has no target and stops at the path limit
+    if (i % 3 == 2) {
+      targets.push_back(nullptr);
+      continue;
+    }
+    surfaces.push_back(
+        CurvilinearSurface(Vector3(200_mm + 50_mm * i, 0, 0), Vector3::UnitX())
+            .planeSurface());
+    targets.push_back(surfaces.back().get());
+  }
+
+  const auto results = batchPropagator.propagate(tracks, targets, options);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    BOOST_TEST_CONTEXT("track " << i) {
+      auto referenceResult =
+          targets[i] != nullptr
+              ? propagator.propagate(tracks[i], *targets[i], referenceOptions)
+              : propagator.propagate(tracks[i], referenceOptions);
+      // a step may overshoot the target by more than the near limit of the
+      // aborter in which case both propagations fail
+      BOOST_REQUIRE_EQUAL(results[i].ok(), referenceResult.ok());
+      if (!results[i].ok()) {
+        BOOST_CHECK_EQUAL(results[i].error(), referenceResult.error());
+        continue;
+      }
+      const auto& reference = *referenceResult;
+      if (targets[i] != nullptr) {
+        BOOST_CHECK_EQUAL(&results[i]->endParameters.referenceSurface(),
+                          targets[i]);
+      }
+      checkParameters(results[i]->endParameters, *reference.endParameters);
+      CHECK_CLOSE_ABS(results[i]->pathLength, reference.pathLength, 1e-9);
+      BOOST_CHECK_EQUAL(results[i]->steps,
+                        reference.statistics.stepping.nSuccessfulSteps);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batch_propagator_straight_line_test) {
+  BatchPropagator<4> batchPropagator({});
+  Propagator<StraightLineStepper> propagator(StraightLineStepper{});
+
+  PropagatorPlainOptions options(tgContext, mfContext);
+  options.pathLimit = 1_m;
+  options.stepping.maxStepSize = 15_cm;
+  Propagator<StraightLineStepper>::Options<> referenceOptions(options);
+
+  const auto tracks = makeTracks(6);
+  const auto results = batchPropagator.propagate(tracks, options);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    BOOST_TEST_CONTEXT("track " << i) {
+      BOOST_REQUIRE(results[i].ok());
+      const auto reference =
+          propagator.propagate(tracks[i], referenceOptions).value();
+      checkParameters(results[i]->endParameters, *reference.endParameters);
+      CHECK_CLOSE_ABS(results[i]->pathLength, 1_m, 1e-9);
+      BOOST_CHECK_EQUAL(results[i]->steps,
+                        reference.statistics.stepping.nSuccessfulSteps);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batch_propagator_failure_test) {
+  auto bField = std::make_shared<BoundedBField>();
+  BatchPropagator<4> batchPropagator({bField});
+
+  PropagatorPlainOptions options(tgContext, mfContext);
+  options.pathLimit = 3_m;
+  options.stepping.maxStepSize = 10_cm;
+
+  // the first track leaves the field along z, the others stay inside
+  std::vector<BoundTrackParameters> tracks = makeTracks(5);
+  tracks.front() = BoundTrackParameters::createCurvilinear(
+      Vector4::Zero(), 0, 0.1, 1_e / 10_GeV, std::nullopt,
+      ParticleHypothesis::pion());
+
+  auto results = batchPropagator.propagate(tracks, options);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+  BOOST_CHECK(!results.front().ok());
+  BOOST_CHECK(results.front().error() == MagneticFieldError::OutOfBounds);
+  for (std::size_t i = 1; i < tracks.size(); ++i) {
+    BOOST_CHECK(results[i].ok());
+  }
+
+  // the step count limit stops all tracks
+  options.maxSteps = 3;
+  results = batchPropagator.propagate(tracks, options);
+  for (std::size_t i = 1; i < tracks.size(); ++i) {
+    BOOST_REQUIRE(!results[i].ok());
+    BOOST_CHECK(results[i].error() == PropagatorError::StepCountLimitReached);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
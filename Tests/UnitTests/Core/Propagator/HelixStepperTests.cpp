@@ -0,0 +1,218 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/DirectNavigator.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepperConcept.hpp"
+#include "Acts/Surfaces/BoundaryTolerance.hpp"
+#include "Acts/Surfaces/CurvilinearSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using Acts::VectorHelpers::makeVector4;
+
+namespace ActsTests {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+static_assert(StepperConcept<HelixStepper>);
+
+BOOST_AUTO_TEST_SUITE(PropagatorSuite)
+
+BOOST_AUTO_TEST_CASE(helix_stepper_circle_test) {
+  const double bz = 2_T;
+  const double p = 1_GeV;
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, bz));
+  HelixStepper stepper(bField);
+
+  HelixStepper::Options options(tgContext, mfContext);
+  auto state = stepper.makeState(options);
+  BoundTrackParameters start = BoundTrackParameters::createCurvilinear(
+      Vector4::Zero(), Vector3::UnitX(), 1_e / p, std::nullopt,
+      ParticleHypothesis::pion());
+  stepper.initialize(state, start);
+
+  // the transverse circle has the radius p / (|q| B) and bends towards -y for
+  // a positive charge in a field along +z
+  const double radius = p / (1_e * bz);
+  const double pathLength = 2_m;
+  state.stepSize = ConstrainedStep(pathLength);
+  BOOST_CHECK_EQUAL(stepper.step(state, Direction::Forward(), nullptr).value(),
+                    pathLength);
+
+  const double angle = pathLength / radius;
+  CHECK_CLOSE_OR_SMALL(stepper.position(state),
+                       Vector3(radius * std::sin(angle),
+                               -radius * (1 - std::cos(angle)), 0),
+                       1e-12, 1e-9);
+  CHECK_CLOSE_OR_SMALL(stepper.direction(state),
+                       Vector3(std::cos(angle), -std::sin(angle), 0), 1e-12,
+                       1e-12);
+  BOOST_CHECK_EQUAL(state.nSteps, 1u);
+  BOOST_CHECK_EQUAL(state.pathAccumulated, pathLength);
+}
+
+BOOST_AUTO_TEST_CASE(helix_stepper_jacobian_test) {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0.3_T, -0.5_T, 2_T));
+  HelixStepper stepper(bField);
+  HelixStepper::Options options(tgContext, mfContext);
+
+  BoundTrackParameters start = BoundTrackParameters::createCurvilinear(
+      makeVector4(Vector3(1_mm, -2_mm, 3_mm), 1_ns),
+      Vector3(1, 1, 0.5).normalized(), -1_e / 2_GeV, BoundMatrix::Identity(),
+      ParticleHypothesis::muon());
+
+  // the free parameters after a single step of fixed length
+  auto transport = [&](const FreeVector& pars, double h, FreeMatrix* jac) {
+    auto state = stepper.makeState(options);
+    stepper.initialize(state, start);
+    state.pars = pars;
+    state.jacTransport = FreeMatrix::Identity();
+    state.stepSize = ConstrainedStep(h);
+    BOOST_CHECK(stepper.step(state, Direction::Forward(), nullptr).ok());
+    if (jac != nullptr) {
+      *jac = state.jacTransport;
+    }
+    return FreeVector(state.pars);
+  };
+
+  auto state = stepper.makeState(options);
+  stepper.initialize(state, start);
+  const FreeVector pars = state.pars;
+
+  // small and large turning angles use different evaluations
+  for (double h : {1_mm, 10_cm, 3_m}) {
+    FreeMatrix jacobian;
+    transport(pars, h, &jacobian);
+
+    // the helix is linear in the direction, so central differences work for
+    // all parameters
+    FreeMatrix numerical;
+    for (Eigen::Index i = 0; i < eFreeSize; ++i) {
+      const double delta =
+          i == eFreeQOverP ? 1e-6 * std::abs(pars[eFreeQOverP]) : 1e-6;
+      FreeVector up = pars;
+      FreeVector down = pars;
+      up[i] += delta;
+      down[i] -= delta;
+      numerical.col(i) =
+          (transport(up, h, nullptr) - transport(down, h, nullptr)) /
+          (2 * delta);
+    }
+    CHECK_CLOSE_OR_SMALL(jacobian, numerical, 1e-5, 1e-9);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(helix_stepper_surface_status_test) {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+  HelixStepper stepper(bField);
+  HelixStepper::Options options(tgContext, mfContext);
+
+  auto state = stepper.makeState(options);
+  BoundTrackParameters start = BoundTrackParameters::createCurvilinear(
+      Vector4::Zero(), Vector3(1, 0.2, 0.3).normalized(), 1_e / 1_GeV,
+      std::nullopt, ParticleHypothesis::pion());
+  stepper.initialize(state, start);
+
+  auto target = CurvilinearSurface(Vector3(500_mm, 0, 0),
+                                   Vector3(1, -0.1, 0).normalized())
+                    .planeSurface();
+
+  // the refined path length reaches the surface with a single step
+  BOOST_CHECK_EQUAL(
+      stepper.updateSurfaceStatus(state, *target, 0, Direction::Forward(),
+                                  BoundaryTolerance::Infinite(),
+                                  s_onSurfaceTolerance,
+                                  ConstrainedStep::Type::Navigator),
+      IntersectionStatus::reachable);
+  BOOST_CHECK(stepper.step(state, Direction::Forward(), nullptr).ok());
+  BOOST_CHECK_EQUAL(
+      stepper.updateSurfaceStatus(state, *target, 0, Direction::Forward(),
+                                  BoundaryTolerance::Infinite(),
+                                  s_onSurfaceTolerance,
+                                  ConstrainedStep::Type::Navigator),
+      IntersectionStatus::onSurface);
+  BOOST_CHECK_EQUAL(state.nSteps, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(helix_stepper_propagation_test) {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+  using HelixPropagator = Propagator<HelixStepper, DirectNavigator>;
+  using EigenPropagator = Propagator<EigenStepper<>, DirectNavigator>;
+  HelixPropagator helixPropagator{HelixStepper(bField), DirectNavigator()};
+  EigenPropagator eigenPropagator{EigenStepper<>(bField), DirectNavigator()};
+
+  BoundMatrix cov = BoundMatrix::Identity();
+  cov(eBoundLoc0, eBoundLoc0) = 10_um * 10_um;
+  cov(eBoundLoc1, eBoundLoc1) = 20_um * 20_um;
+  cov(eBoundPhi, eBoundPhi) = 1e-6;
+  cov(eBoundTheta, eBoundTheta) = 1e-6;
+  cov(eBoundQOverP, eBoundQOverP) = 1e-4 / (1_GeV * 1_GeV);
+  BoundTrackParameters start = BoundTrackParameters::createCurvilinear(
+      Vector4::Zero(), Vector3(1, 0.2, 0.3).normalized(), -1_e / 1_GeV, cov,
+      ParticleHypothesis::pion());
+
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  std::vector<const Surface*> surfacePtrs;
+  for (double x : {100_mm, 200_mm, 350_mm, 500_mm}) {
+    surfaces.push_back(
+        CurvilinearSurface(Vector3(x, 0, 0), Vector3(1, -0.1, 0).normalized())
+            .planeSurface());
+    surfacePtrs.push_back(surfaces.back().get());
+  }
+  const Surface& target = *surfaces.back();
+
+  HelixPropagator::Options<> helixOptions(tgContext, mfContext);
+  helixOptions.navigation.externalSurfaces = surfacePtrs;
+  auto helixResult =
+      helixPropagator.propagate(start, target, helixOptions).value();
+  EigenPropagator::Options<> eigenOptions(tgContext, mfContext);
+  eigenOptions.navigation.externalSurfaces = surfacePtrs;
+  eigenOptions.stepping.stepTolerance = 1e-8;
+  auto eigenResult =
+      eigenPropagator.propagate(start, target, eigenOptions).value();
+
+  // the navigation surfaces are reached with a single step each, only the
+  // straight line estimate of the target aborter can add a few short steps
+  BOOST_CHECK_LE(helixResult.steps, surfaces.size() + 2);
+  BOOST_CHECK_LT(helixResult.steps, eigenResult.steps);
+
+  const auto& helixEnd = *helixResult.endParameters;
+  const auto& eigenEnd = *eigenResult.endParameters;
+  CHECK_CLOSE_ABS(helixEnd.parameters(), eigenEnd.parameters(), 1e-6);
+  CHECK_CLOSE_ABS(helixResult.pathLength, eigenResult.pathLength, 1e-6);
+  CHECK_CLOSE_OR_SMALL(*helixEnd.covariance(), *eigenEnd.covariance(), 1e-5,
+                       1e-12);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -14,16 +14,21 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/ConeSurface.hpp"
 #include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceIntersectionBatch.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
 #include <cmath>
 #include <memory>
 #include <numbers>
+#include <random>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -415,6 +420,71 @@ BOOST_AUTO_TEST_CASE(LineIntersectionTest) {
   testLineAppraoch(aTransform);
 }
 
+BOOST_AUTO_TEST_CASE(BatchIntersectionTest) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  auto randomTransform = [&]() {
+    return Transform3(Translation3(uniform(rng) * 1_m, uniform(rng) * 1_m,
+                                   uniform(rng) * 1_m) *
+                      AngleAxis3(uniform(rng) * std::numbers::pi,
+                                 Vector3(uniform(rng), uniform(rng),
+                                         uniform(rng))
+                                     .normalized()));
+  };
+
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (int i = 0; i < 50; ++i) {
+    surfaces.push_back(Surface::makeShared<PlaneSurface>(
+        randomTransform(), std::make_shared<RectangleBounds>(1_cm, 1_cm)));
+    surfaces.push_back(Surface::makeShared<DiscSurface>(
+        randomTransform(), std::make_shared<RadialBounds>(0., 1_cm)));
+    surfaces.push_back(Surface::makeShared<CylinderSurface>(
+        randomTransform(), 0.5_m, 1_cm));
+  }
+  // cones are not supported by the batch
+  surfaces.push_back(
+      Surface::makeShared<ConeSurface>(randomTransform(), 0.25, 0., 1_m));
+
+  SurfaceIntersectionBatch batch;
+  for (const auto& surface : surfaces) {
+    batch.add(tgContext, *surface);
+  }
+  BOOST_CHECK_EQUAL(batch.size(), surfaces.size());
+
+  const Vector3 position(0.1_m, -0.2_m, 0.3_m);
+  const Vector3 direction = Vector3(1., 2., 3.).normalized();
+  const auto pathLengths = batch.maxPathLengths(position, direction);
+  BOOST_CHECK_EQUAL(pathLengths.size(), surfaces.size());
+
+  std::size_t nEstimated = 0;
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    const Surface* surface = surfaces[i].get();
+    const double pathLength = pathLengths[i];
+    auto multiIntersection =
+        surface->intersect(tgContext, position, direction,
+                           BoundaryTolerance::Infinite(), s_onSurfaceTolerance);
+    if (surface->type() == Surface::Cone) {
+      BOOST_CHECK(std::isnan(pathLength));
+      continue;
+    }
+    if (!multiIntersection.at(0).isValid()) {
+      BOOST_CHECK(std::isnan(pathLength));
+      continue;
+    }
+    double expected = multiIntersection.at(0).pathLength();
+    if (multiIntersection.size() > 1 && multiIntersection.at(1).isValid()) {
+      expected = std::max(expected, multiIntersection.at(1).pathLength());
+    }
+    CHECK_CLOSE_OR_SMALL(pathLength, expected, 1e-9, 1e-9);
+    ++nEstimated;
+  }
+  BOOST_CHECK_GT(nEstimated, 100u);
+
+  batch.clear();
+  BOOST_CHECK_EQUAL(batch.size(), 0u);
+  BOOST_CHECK(batch.maxPathLengths(position, direction).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
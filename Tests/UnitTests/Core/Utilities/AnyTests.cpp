@@ -354,6 +354,46 @@ BOOST_AUTO_TEST_CASE(AnyCopyTypeChange) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(AnyTrivialTransitions) {
+  using Trivial = std::array<int, 2>;
+  using Any16 = AnyBase<16>;
+  static_assert(std::is_trivially_copyable_v<Trivial>);
+
+  Any16 a{Trivial{1, 2}};
+  Any16 b{a};
+  BOOST_CHECK(b.as<Trivial>() == (Trivial{1, 2}));
+
+  Any16 c{std::move(b)};
+  BOOST_CHECK(c.as<Trivial>() == (Trivial{1, 2}));
+
+  Any16 empty;
+  c = empty;
+  BOOST_CHECK(!c);
+  c = a;
+  BOOST_CHECK(c.as<Trivial>() == (Trivial{1, 2}));
+
+  // trivial to non-trivial and back
+  bool destroyed = false;
+  {
+    Any16 d{D{&destroyed}};
+    destroyed = false;
+    c = d;
+    BOOST_CHECK_EQUAL(c.as<D>().destroyed, &destroyed);
+    c = a;
+    BOOST_CHECK(destroyed);
+    BOOST_CHECK(c.as<Trivial>() == (Trivial{1, 2}));
+    destroyed = false;
+
+    a = std::move(d);
+    BOOST_CHECK_EQUAL(a.as<D>().destroyed, &destroyed);
+    a = std::move(c);
+    BOOST_CHECK(destroyed);
+    BOOST_CHECK(a.as<Trivial>() == (Trivial{1, 2}));
+  }
+
+  CHECK_ANY_ALLOCATIONS();
+}
+
 BOOST_AUTO_TEST_CASE(AnyDestroy) {
   {  // small type
     bool destroyed = false;
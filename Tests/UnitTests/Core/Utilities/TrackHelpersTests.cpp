@@ -9,6 +9,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/ProxyAccessor.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
@@ -182,6 +183,81 @@ BOOST_AUTO_TEST_CASE(CalculateUnbiasedParametersCovariance) {
   CHECK_CLOSE_ABS(cov, refCov, 1e-6);
 }
 
+BOOST_AUTO_TEST_CASE(CompactTrackStates) {
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  tc.trackStateContainer().addColumn<int>("layer");
+  ProxyAccessor<int> layer("layer");
+  ConstProxyAccessor<int> constLayer("layer");
+
+  auto appendState = [&](auto& track, int l) {
+    auto ts = track.appendTrackState(TrackStatePropMask::Predicted |
+                                     TrackStatePropMask::Filtered |
+                                     TrackStatePropMask::Calibrated);
+    ts.predicted() = BoundVector::Constant(l);
+    ts.filtered() = BoundVector::Constant(-l);
+    ts.shareFrom(TrackStatePropMask::Filtered, TrackStatePropMask::Smoothed);
+    ts.allocateCalibrated(Vector2::Constant(l),
+                          (SquareMatrix2::Identity() * l).eval());
+    ts.setProjectorSubspaceIndices(std::array{eBoundLoc0, eBoundLoc1});
+    ts.pathLength() = l;
+    layer(ts) = l;
+    return ts;
+  };
+
+  auto trackA = tc.makeTrack();
+  for (int l = 1; l <= 3; ++l) {
+    appendState(trackA, l);
+  }
+  auto sharedTip = trackA.outermostTrackState().previous();
+
+  // a discarded branch
+  auto removed = tc.makeTrack();
+  removed.tipIndex() = sharedTip;
+  appendState(removed, 20);
+  tc.removeTrack(removed.index());
+
+  // a branch sharing the first two track states
+  auto trackB = tc.makeTrack();
+  trackB.tipIndex() = sharedTip;
+  appendState(trackB, 30);
+
+  // unrelated track states
+  for (int l = 0; l < 5; ++l) {
+    tc.trackStateContainer().makeTrackState();
+  }
+
+  BOOST_CHECK_EQUAL(tc.trackStateContainer().size(), 10u);
+
+  auto remap = compactTrackStates(tc);
+
+  BOOST_CHECK_EQUAL(remap.size(), 10u);
+  BOOST_CHECK_EQUAL(remap[3], kTrackIndexInvalid);
+  BOOST_CHECK_EQUAL(tc.trackStateContainer().size(), 4u);
+
+  auto checkTrack = [&](const auto& track, const std::vector<int>& layers) {
+    BOOST_CHECK_EQUAL(track.nTrackStates(), layers.size());
+    auto it = layers.rbegin();
+    for (const auto& ts : track.trackStatesReversed()) {
+      BOOST_CHECK_EQUAL(constLayer(ts), *it);
+      BOOST_CHECK_EQUAL(ts.pathLength(), *it);
+      BOOST_CHECK_EQUAL(ts.predicted(), BoundVector::Constant(*it));
+      BOOST_CHECK_EQUAL(ts.smoothed().data(), ts.filtered().data());
+      BOOST_CHECK_EQUAL(ts.smoothed(), BoundVector::Constant(-*it));
+      BOOST_CHECK_EQUAL(ts.template calibrated<2>(), Vector2::Constant(*it));
+      BOOST_CHECK_EQUAL(ts.template calibratedCovariance<2>(),
+                        (SquareMatrix2::Identity() * *it).eval());
+      ++it;
+    }
+  };
+
+  checkTrack(tc.getTrack(0), {1, 2, 3});
+  checkTrack(tc.getTrack(1), {1, 2, 30});
+
+  // track states are stored in track order
+  BOOST_CHECK_EQUAL(tc.getTrack(0).tipIndex(), 2u);
+  BOOST_CHECK_EQUAL(tc.getTrack(1).tipIndex(), 3u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
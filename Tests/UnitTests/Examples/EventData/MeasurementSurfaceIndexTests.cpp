@@ -0,0 +1,116 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/MeasurementSurfaceIndex.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+GeometryIdentifier makeGeometryId(std::uint32_t sensitive) {
+  return GeometryIdentifier().withVolume(1).withLayer(2).withSensitive(
+      sensitive);
+}
+
+void addMeasurement(MeasurementContainer& container,
+                    GeometryIdentifier geometryId) {
+  container.emplaceMeasurement<1>(geometryId, std::array{eBoundLoc0},
+                                  Vector<1>::Zero(),
+                                  SquareMatrix<1>::Identity());
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(EventDataSuite)
+
+BOOST_AUTO_TEST_CASE(DenseSurfaceIndexNumbering) {
+  DenseSurfaceIndex surfaces({makeGeometryId(3), makeGeometryId(1),
+                              makeGeometryId(2), makeGeometryId(1)});
+
+  BOOST_CHECK_EQUAL(surfaces.size(), 3u);
+  for (std::uint32_t i = 0; i < 3; ++i) {
+    BOOST_CHECK_EQUAL(surfaces.index(makeGeometryId(i + 1)), i);
+    BOOST_CHECK_EQUAL(surfaces.geometryId(i), makeGeometryId(i + 1));
+  }
+  BOOST_CHECK_EQUAL(surfaces.index(makeGeometryId(4)),
+                    DenseSurfaceIndex::kInvalidIndex);
+}
+
+BOOST_AUTO_TEST_CASE(MeasurementSurfaceIndexRanges) {
+  auto surfaces = std::make_shared<const DenseSurfaceIndex>(
+      std::vector{makeGeometryId(1), makeGeometryId(2), makeGeometryId(3),
+                  makeGeometryId(4)});
+
+  // measurements are interleaved and one is on an unknown surface
+  MeasurementContainer measurements;
+  addMeasurement(measurements, makeGeometryId(3));
+  addMeasurement(measurements, makeGeometryId(1));
+  addMeasurement(measurements, makeGeometryId(3));
+  addMeasurement(measurements, makeGeometryId(5));
+  addMeasurement(measurements, makeGeometryId(1));
+  addMeasurement(measurements, makeGeometryId(3));
+
+  MeasurementSurfaceIndex index(surfaces, measurements);
+  BOOST_CHECK_EQUAL(index.nUnassigned(), 1u);
+  BOOST_CHECK_EQUAL(index.sourceLinks().size(), 5u);
+
+  auto indicesOf = [&](GeometryIdentifier geometryId) {
+    std::vector<Index> indices;
+    for (const IndexSourceLink& sourceLink : index.sourceLinks(geometryId)) {
+      BOOST_CHECK_EQUAL(sourceLink.geometryId(), geometryId);
+      indices.push_back(sourceLink.index());
+    }
+    return indices;
+  };
+
+  // the ranges keep the measurement order within a surface
+  BOOST_CHECK(indicesOf(makeGeometryId(1)) == (std::vector<Index>{1, 4}));
+  BOOST_CHECK(indicesOf(makeGeometryId(2)).empty());
+  BOOST_CHECK(indicesOf(makeGeometryId(3)) == (std::vector<Index>{0, 2, 5}));
+  BOOST_CHECK(indicesOf(makeGeometryId(4)).empty());
+  BOOST_CHECK(indicesOf(makeGeometryId(5)).empty());
+
+  // the source links are stored in the same order as the ordered indices
+  std::vector<IndexSourceLink> ordered;
+  for (const IndexSourceLink& sourceLink : measurements.orderedIndices()) {
+    if (sourceLink.geometryId() != makeGeometryId(5)) {
+      ordered.push_back(sourceLink);
+    }
+  }
+  BOOST_CHECK(index.sourceLinks() == ordered);
+}
+
+BOOST_AUTO_TEST_CASE(MeasurementSurfaceIndexEmpty) {
+  auto surfaces = std::make_shared<const DenseSurfaceIndex>(
+      std::vector<GeometryIdentifier>{});
+
+  MeasurementContainer measurements;
+  MeasurementSurfaceIndex index(surfaces, measurements);
+  BOOST_CHECK(index.sourceLinks().empty());
+  BOOST_CHECK(index.sourceLinks(makeGeometryId(1)).empty());
+
+  BOOST_CHECK_THROW(MeasurementSurfaceIndex(nullptr, measurements),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
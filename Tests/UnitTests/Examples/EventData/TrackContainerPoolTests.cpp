@@ -0,0 +1,91 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/ProxyAccessor.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "ActsExamples/EventData/TrackContainerPool.hpp"
+
+using namespace ActsExamples;
+using namespace Acts::HashedStringLiteral;
+
+namespace {
+
+void fillTracks(TrackContainer& tracks, std::size_t nTracks) {
+  tracks.addColumn<unsigned int>("trackGroup");
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    auto track = tracks.makeTrack();
+    track.template component<unsigned int>("trackGroup") = i;
+    for (std::size_t j = 0; j < 10; ++j) {
+      track.appendTrackState(Acts::TrackStatePropMask::All);
+    }
+  }
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(EventDataSuite)
+
+BOOST_AUTO_TEST_CASE(TrackContainerPoolRecycle) {
+  auto pool = std::make_shared<TrackContainerPool>();
+  BOOST_CHECK_EQUAL(pool->size(), 0u);
+
+  auto tracks = pool->acquire();
+  fillTracks(tracks, 100);
+  pool->recycle(std::move(tracks));
+  BOOST_CHECK_EQUAL(pool->size(), 1u);
+
+  auto reused = pool->acquire();
+  BOOST_CHECK_EQUAL(pool->size(), 0u);
+  BOOST_CHECK_EQUAL(reused.size(), 0u);
+  BOOST_CHECK_EQUAL(reused.trackStateContainer().size(), 0u);
+  // the dynamic columns are kept
+  BOOST_CHECK(reused.hasColumn("trackGroup"_hash));
+}
+
+BOOST_AUTO_TEST_CASE(TrackContainerPoolRelease) {
+  auto pool = std::make_shared<TrackContainerPool>();
+
+  {
+    auto tracks = pool->acquire();
+    fillTracks(tracks, 100);
+    const double* params =
+        tracks.trackStateContainer().getTrackState(0).predicted().data();
+
+    ConstTrackContainer constTracks = pool->release(std::move(tracks));
+    BOOST_CHECK_EQUAL(pool->size(), 0u);
+    BOOST_CHECK_EQUAL(constTracks.size(), 100u);
+    BOOST_CHECK_EQUAL(constTracks.trackStateContainer().size(), 1000u);
+    // the storage is moved, not copied
+    BOOST_CHECK_EQUAL(
+        constTracks.trackStateContainer().getTrackState(0).predicted().data(),
+        params);
+
+    Acts::ConstProxyAccessor<unsigned int> trackGroup("trackGroup");
+    BOOST_CHECK_EQUAL(trackGroup(constTracks.getTrack(42)), 42u);
+  }
+
+  // the storage returns to the pool with the last reference
+  BOOST_CHECK_EQUAL(pool->size(), 1u);
+  auto reused = pool->acquire();
+  BOOST_CHECK_EQUAL(reused.size(), 0u);
+  BOOST_CHECK(reused.hasColumn("trackGroup"_hash));
+  fillTracks(reused, 1);
+  BOOST_CHECK_EQUAL(reused.trackStateContainer().size(), 10u);
+
+  // containers released after the pool is gone are deleted
+  ConstTrackContainer orphan = pool->release(std::move(reused));
+  pool.reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -15,6 +15,8 @@
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsTests/CommonHelpers/WhiteBoardUtilities.hpp"
 
+#include <algorithm>
+
 using namespace Acts;
 using namespace ActsExamples;
 using Logging::ScopedFailureThreshold;
@@ -517,6 +519,133 @@ BOOST_AUTO_TEST_CASE(ConsumeDataHandleDestructor) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(SlotResolvedAccess) {
+  DummySequenceElement dummyElement;
+
+  auto layout = std::make_shared<WhiteBoard::SlotLayout>();
+  layout->addKey("slot_key");
+  layout->addAlias("slot_key", "slot_alias");
+  BOOST_CHECK_EQUAL(layout->size(), 2u);
+  BOOST_CHECK_EQUAL(layout->addKey("slot_key"), 0u);
+
+  WhiteBoard::AliasMapType aliases{{"slot_key", "slot_alias"}};
+  WhiteBoard wb(getDefaultLogger("WhiteBoard", Logging::INFO), aliases,
+                layout);
+
+  WriteDataHandle<int> writeHandle(&dummyElement, "write");
+  writeHandle.initialize("slot_key");
+  writeHandle.resolveSlot(*layout);
+
+  ReadDataHandle<int> readHandle(&dummyElement, "read");
+  readHandle.initialize("slot_alias");
+  readHandle.resolveSlot(*layout);
+
+  BOOST_TEST_CHECKPOINT("Test slot based access");
+  {
+    writeHandle(wb, 42);
+    BOOST_CHECK(wb.exists("slot_key"));
+    BOOST_CHECK(wb.exists("slot_alias"));
+    BOOST_CHECK_EQUAL(readHandle(wb), 42);
+    BOOST_CHECK_THROW(writeHandle(wb, 43), std::invalid_argument);
+
+    ReadDataHandle<double> wrongType(&dummyElement, "wrong");
+    wrongType.initialize("slot_key");
+    wrongType.resolveSlot(*layout);
+    BOOST_CHECK_THROW(wrongType(wb), std::out_of_range);
+  }
+
+  BOOST_TEST_CHECKPOINT("Test key based access to slots");
+  {
+    ReadDataHandle<int> unresolved(&dummyElement, "unresolved");
+    unresolved.initialize("slot_key");
+    BOOST_CHECK_EQUAL(unresolved(wb), 42);
+
+    WriteDataHandle<int> other(&dummyElement, "other");
+    other.initialize("other_key");
+    other.resolveSlot(*layout);
+    other(wb, 1);
+
+    auto keys = wb.getKeys();
+    std::ranges::sort(keys);
+    BOOST_CHECK((keys == std::vector<std::string>{"other_key", "slot_alias",
+                                                  "slot_key"}));
+  }
+
+  BOOST_TEST_CHECKPOINT("Test white boards with a different layout");
+  {
+    WhiteBoard plain;
+    writeHandle(plain, 7);
+    BOOST_CHECK(plain.exists("slot_key"));
+    ReadDataHandle<int> plainRead(&dummyElement, "plain");
+    plainRead.initialize("slot_key");
+    plainRead.resolveSlot(*layout);
+    BOOST_CHECK_EQUAL(plainRead(plain), 7);
+
+    WhiteBoard copy;
+    copy.copyFrom(wb);
+    BOOST_CHECK(copy.exists("slot_key"));
+    BOOST_CHECK(copy.exists("other_key"));
+  }
+
+  BOOST_TEST_CHECKPOINT("Test consuming from a slot");
+  {
+    ConsumeDataHandle<int> consumeHandle(&dummyElement, "consume");
+    consumeHandle.initialize("slot_key");
+    consumeHandle.resolveSlot(*layout);
+    BOOST_CHECK_EQUAL(consumeHandle(wb), 42);
+    BOOST_CHECK(!wb.exists("slot_key"));
+    BOOST_CHECK_THROW(consumeHandle(wb), std::out_of_range);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DeclaredKeysScope) {
+  DummySequenceElement dummyElement;
+
+  auto layout = std::make_shared<WhiteBoard::SlotLayout>();
+  layout->addKey("slot_key");
+  WhiteBoard wb(getDefaultLogger("WhiteBoard", Logging::INFO), {}, layout);
+
+  WriteDataHandle<int> slotHandle(&dummyElement, "slot");
+  slotHandle.initialize("slot_key");
+  slotHandle.resolveSlot(*layout);
+  WriteDataHandle<int> mapHandle(&dummyElement, "map");
+  mapHandle.initialize("map_key");
+
+  ReadDataHandle<int> slotRead(&dummyElement, "slotRead");
+  slotRead.initialize("slot_key");
+  slotRead.resolveSlot(*layout);
+  ReadDataHandle<int> mapRead(&dummyElement, "mapRead");
+  mapRead.initialize("map_key");
+
+  const WhiteBoard::KeySet writerKeys = {"slot_key", "map_key"};
+  const WhiteBoard::KeySet readerKeys = {"map_key"};
+
+  {
+    WhiteBoard::DeclaredKeysScope scope("writer", writerKeys);
+    slotHandle(wb, 1);
+    mapHandle(wb, 2);
+    BOOST_CHECK(wb.exists("map_key"));
+    BOOST_CHECK_THROW(wb.exists("undeclared"), std::logic_error);
+  }
+
+  {
+    WhiteBoard::DeclaredKeysScope scope("reader", readerKeys);
+    BOOST_CHECK_EQUAL(mapRead(wb), 2);
+    BOOST_CHECK_THROW(slotRead(wb), std::logic_error);
+
+    // The innermost scope is in effect and the outer one is restored
+    {
+      WhiteBoard::DeclaredKeysScope inner("inner", writerKeys);
+      BOOST_CHECK_EQUAL(slotRead(wb), 1);
+    }
+    BOOST_CHECK_THROW(slotRead(wb), std::logic_error);
+  }
+
+  // Without a scope every key can be accessed
+  BOOST_CHECK_EQUAL(slotRead(wb), 1);
+  BOOST_CHECK_EQUAL(mapRead(wb), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests